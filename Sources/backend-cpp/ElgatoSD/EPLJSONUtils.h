@@ -20,6 +20,11 @@
 #include "nlohmann/json.hpp"
 using json = nlohmann::json;
 
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
 class EPLJSONUtils
 {
   public:
@@ -150,4 +155,50 @@ class EPLJSONUtils
         // Return value
         return *iter;
     }
+
+    //! Serialize object with an additional field whose value is json text copied in as-is, so large json text (e.g. a
+    //! mapped json file) can be sent without parsing it. The field path holds the keys of the nested objects leading
+    //! to the field, which are added if missing, ending with the key of the field itself.
+    static std::string
+    DumpWithRawField(const json &inJSON, const std::vector<std::string> &inFieldPath, std::string_view inRawJSON)
+    {
+        if (inFieldPath.empty())
+            return inJSON.dump();
+
+        std::string text;
+        text.reserve(inRawJSON.size() + 256);
+        AppendWithRawField(text, inJSON, inFieldPath.begin(), inFieldPath.end(), inRawJSON);
+        return text;
+    }
+
+  private:
+    static void AppendWithRawField(std::string &outText,
+                                   const json &inJSON,
+                                   std::vector<std::string>::const_iterator inFieldPathBegin,
+                                   std::vector<std::string>::const_iterator inFieldPathEnd,
+                                   std::string_view inRawJSON)
+    {
+        const std::string &key = *inFieldPathBegin;
+        json otherFields = inJSON.is_object() ? inJSON : json::object();
+        otherFields.erase(key);
+        const std::string otherFieldsText = otherFields.dump();
+
+        // Append the other fields without the closing brace, then the raw field and the closing brace
+        outText.append(otherFieldsText, 0, otherFieldsText.size() - 1);
+        if (!otherFields.empty())
+            outText.push_back(',');
+        outText.append(json(key).dump());
+        outText.push_back(':');
+        if (std::next(inFieldPathBegin) == inFieldPathEnd) {
+            outText.append(inRawJSON);
+        } else {
+            const bool hasNestedObject = inJSON.is_object() && inJSON.contains(key);
+            AppendWithRawField(outText,
+                               hasNestedObject ? inJSON.at(key) : json::object(),
+                               std::next(inFieldPathBegin),
+                               inFieldPathEnd,
+                               inRawJSON);
+        }
+        outText.push_back('}');
+    }
 };
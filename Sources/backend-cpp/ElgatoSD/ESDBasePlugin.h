@@ -82,6 +82,13 @@ class ESDBasePlugin
     {
     }
 
+    // Property Inspector events - optional implementation
+    virtual void PropertyInspectorDidDisappear(const std::string &inAction,
+                                               const std::string &inContext,
+                                               const std::string &inDeviceID)
+    {
+    }
+
   protected:
     ESDConnectionManager *mConnectionManager = nullptr;
 };
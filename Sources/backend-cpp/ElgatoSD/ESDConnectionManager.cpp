@@ -88,6 +88,8 @@ void ESDConnectionManager::OnMessage(websocketpp::connection_hdl, WebsocketClien
                 mPlugin->DialUpForAction(action, context, payload, deviceID);
             } else if (event == kESDSDKEventTouchTap) {
                 mPlugin->TouchTapForAction(action, context, payload, deviceID);
+            } else if (event == kESDSDKEventPropertyInspectorDidDisappear) {
+                mPlugin->PropertyInspectorDidDisappear(action, context, deviceID);
             } else if (event == kESDSDKEventDeviceDidConnect) {
                 json deviceInfo;
                 EPLJSONUtils::GetObjectByName(receivedJson, kESDSDKCommonDeviceInfo, deviceInfo);
@@ -297,6 +299,25 @@ void ESDConnectionManager::SendToPropertyInspector(const std::string &inAction,
     mWebsocket.send(mConnectionHandle, jsonObject.dump(), websocketpp::frame::opcode::text, ec);
 }
 
+void ESDConnectionManager::SendRawJsonToPropertyInspector(const std::string &inAction,
+                                                          const std::string &inContext,
+                                                          const json &inPayload,
+                                                          const std::string &inRawJsonField,
+                                                          std::string_view inRawJson)
+{
+    json jsonObject;
+
+    jsonObject[kESDSDKCommonEvent] = kESDSDKEventSendToPropertyInspector;
+    jsonObject[kESDSDKCommonContext] = inContext;
+    jsonObject[kESDSDKCommonAction] = inAction;
+    jsonObject[kESDSDKCommonPayload] = inPayload;
+
+    const std::string message =
+        EPLJSONUtils::DumpWithRawField(jsonObject, {kESDSDKCommonPayload, inRawJsonField}, inRawJson);
+    websocketpp::lib::error_code ec;
+    mWebsocket.send(mConnectionHandle, message, websocketpp::frame::opcode::text, ec);
+}
+
 void ESDConnectionManager::SwitchToProfile(const std::string &inDeviceID, const std::string &inProfileName)
 {
     if (!inDeviceID.empty()) {
@@ -15,6 +15,8 @@
 #include "ESDBasePlugin.h"
 #include "ESDSDKDefines.h"
 
+#include <string_view>
+
 #define ASIO_STANDALONE
 #include <Vendor/websocketpp/websocketpp/client.hpp>
 #include <Vendor/websocketpp/websocketpp/common/memory.hpp>
@@ -47,6 +49,12 @@ class ESDConnectionManager
     void GetGlobalSettings();
     void SetGlobalSettings(const json &inSettings);
     void SendToPropertyInspector(const std::string &inAction, const std::string &inContext, const json &inPayload);
+    // Sends the payload with an additional field of json text copied in as-is, e.g. the contents of a json file.
+    void SendRawJsonToPropertyInspector(const std::string &inAction,
+                                        const std::string &inContext,
+                                        const json &inPayload,
+                                        const std::string &inRawJsonField,
+                                        std::string_view inRawJson);
     void SwitchToProfile(const std::string &inDeviceID, const std::string &inProfileName);
     void LogMessage(const std::string &inMessage);
 
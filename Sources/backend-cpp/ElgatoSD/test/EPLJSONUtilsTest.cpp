@@ -0,0 +1,29 @@
+// Copyright 2026 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "ElgatoSD/EPLJSONUtils.h"
+
+namespace test
+{
+
+TEST(EPLJSONUtilsTest, DumpWithRawField)
+{
+    const std::string raw_json = R"({"FUEL_QTY": {"address": 4340}})";
+    const json message = {{"event", "sendToPropertyInspector"}, {"payload", {{"event", "JsonFile"}}}};
+    const std::string text = EPLJSONUtils::DumpWithRawField(message, {"payload", "jsonFile"}, raw_json);
+    const json expected = {{"event", "sendToPropertyInspector"},
+                           {"payload", {{"event", "JsonFile"}, {"jsonFile", json::parse(raw_json)}}}};
+    EXPECT_EQ(expected, json::parse(text));
+    // The raw json text is copied as-is, including its whitespace.
+    EXPECT_NE(std::string::npos, text.find(raw_json));
+}
+
+TEST(EPLJSONUtilsTest, DumpWithRawFieldInEmptyObjects)
+{
+    EXPECT_EQ(R"({"a":{"b":[1, 2]}})", EPLJSONUtils::DumpWithRawField(json::object(), {"a", "b"}, "[1, 2]"));
+    EXPECT_EQ(R"({"a":[1, 2]})", EPLJSONUtils::DumpWithRawField(json({{"a", 0}}), {"a"}, "[1, 2]"));
+    EXPECT_EQ(R"({"a":0})", EPLJSONUtils::DumpWithRawField(json({{"a", 0}}), {}, "[1, 2]"));
+}
+
+} // namespace test
@@ -0,0 +1,173 @@
+// Copyright 2026 Charles Tytler
+
+#include "CockpitEmulator.h"
+
+#include "Utilities/StringUtilities.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace
+{
+void append_word(std::string &frame, const unsigned int word)
+{
+    frame.push_back(static_cast<char>(word & 0xFF));
+    frame.push_back(static_cast<char>((word >> 8) & 0xFF));
+}
+} // namespace
+
+void CockpitEmulator::add_dcs_bios_control(const std::string &identifier,
+                                           const uint16_t address,
+                                           const uint16_t mask,
+                                           const uint8_t shift)
+{
+    dcs_bios_controls_[identifier] = {address, mask, shift};
+    if (dcs_bios_words_.count(address) == 0) {
+        dcs_bios_words_[address] = 0;
+        changed_dcs_bios_addresses_.insert(address);
+    }
+}
+
+void CockpitEmulator::add_export_script_control(const int device_id, const int button_id, const int export_id)
+{
+    export_id_by_clickable_[{device_id, button_id}] = export_id;
+    set_export_script_value(export_id, "0");
+}
+
+int CockpitEmulator::apply_dcs_bios_commands(std::string_view datagram)
+{
+    int num_applied = 0;
+    std::istringstream commands{std::string(datagram)};
+    std::string identifier;
+    std::string value;
+    while (commands >> identifier >> value) {
+        if (identifier == "SYNC") {
+            dcs_bios_full_state_requested_ = true;
+            continue;
+        }
+        const auto control = dcs_bios_controls_.find(identifier);
+        if (control == dcs_bios_controls_.end()) {
+            continue;
+        }
+        const unsigned int max_value = control->second.mask >> control->second.shift;
+        const unsigned int current_value = dcs_bios_value(identifier);
+        if (value == "INC") {
+            set_dcs_bios_value(control->second, std::min(current_value + 1, max_value));
+        } else if (value == "DEC") {
+            set_dcs_bios_value(control->second, (current_value > 0) ? current_value - 1 : 0);
+        } else if (value == "TOGGLE") {
+            set_dcs_bios_value(control->second, (current_value == 0) ? 1 : 0);
+        } else if (is_integer(value)) {
+            set_dcs_bios_value(control->second, std::min(static_cast<unsigned int>(std::stoul(value)), max_value));
+        } else {
+            continue;
+        }
+        num_applied++;
+    }
+    return num_applied;
+}
+
+int CockpitEmulator::apply_export_script_command(std::string_view datagram)
+{
+    if (datagram == "R") {
+        export_full_state_requested_ = true;
+        return 0;
+    }
+    if (datagram.empty() || datagram[0] != 'C') {
+        return 0;
+    }
+    // Command is of the form "C<device>,<button>,<value>".
+    const auto button_delimiter = datagram.find(',');
+    const auto value_delimiter = datagram.find(',', button_delimiter + 1);
+    if (button_delimiter == std::string_view::npos || value_delimiter == std::string_view::npos) {
+        return 0;
+    }
+    const std::string device(datagram.substr(1, button_delimiter - 1));
+    const std::string button(datagram.substr(button_delimiter + 1, value_delimiter - button_delimiter - 1));
+    if (!is_integer(device) || !is_integer(button)) {
+        return 0;
+    }
+    const auto clickable = export_id_by_clickable_.find({std::stoi(device), std::stoi(button)});
+    if (clickable == export_id_by_clickable_.end()) {
+        return 0;
+    }
+    set_export_script_value(clickable->second, std::string(datagram.substr(value_delimiter + 1)));
+    return 1;
+}
+
+void CockpitEmulator::set_export_script_value(const int export_id, const std::string &value)
+{
+    auto &stored_value = export_values_[export_id];
+    if (stored_value != value) {
+        stored_value = value;
+        changed_export_ids_.insert(export_id);
+    }
+}
+
+std::string CockpitEmulator::next_dcs_bios_frame()
+{
+    std::string frame = "\x55\x55\x55\x55";
+
+    if (dcs_bios_full_state_requested_) {
+        // Aircraft name, null terminated and padded to an even number of bytes.
+        std::string aircraft_name = AIRCRAFT_NAME;
+        aircraft_name.resize(aircraft_name.size() + 2 - aircraft_name.size() % 2, '\0');
+        append_word(frame, 0x0000);
+        append_word(frame, static_cast<unsigned int>(aircraft_name.size()));
+        frame += aircraft_name;
+        for (const auto &word : dcs_bios_words_) {
+            changed_dcs_bios_addresses_.insert(word.first);
+        }
+        dcs_bios_full_state_requested_ = false;
+    }
+
+    for (const auto address : changed_dcs_bios_addresses_) {
+        append_word(frame, address);
+        append_word(frame, 2);
+        append_word(frame, dcs_bios_words_[address]);
+    }
+    changed_dcs_bios_addresses_.clear();
+
+    // End of frame marker.
+    append_word(frame, 0xFFFE);
+    append_word(frame, 2);
+    append_word(frame, frame_count_++);
+    return frame;
+}
+
+std::string CockpitEmulator::next_export_script_datagram()
+{
+    if (export_full_state_requested_) {
+        for (const auto &value : export_values_) {
+            changed_export_ids_.insert(value.first);
+        }
+        export_full_state_requested_ = false;
+    }
+
+    std::string datagram = "Ikarus*";
+    for (const auto export_id : changed_export_ids_) {
+        datagram += std::to_string(export_id) + "=" + export_values_[export_id] + ":";
+    }
+    changed_export_ids_.clear();
+    return datagram;
+}
+
+unsigned int CockpitEmulator::dcs_bios_value(const std::string &identifier) const
+{
+    const auto control = dcs_bios_controls_.find(identifier);
+    if (control == dcs_bios_controls_.end()) {
+        return 0;
+    }
+    const auto word = dcs_bios_words_.find(control->second.address);
+    return (word->second & control->second.mask) >> control->second.shift;
+}
+
+void CockpitEmulator::set_dcs_bios_value(const DcsBiosControl &control, const unsigned int value)
+{
+    uint16_t &word = dcs_bios_words_[control.address];
+    const auto updated_word = static_cast<uint16_t>((word & ~control.mask) | ((value << control.shift) & control.mask));
+    if (updated_word != word) {
+        word = updated_word;
+        changed_dcs_bios_addresses_.insert(control.address);
+    }
+}
@@ -0,0 +1,98 @@
+// Copyright 2026 Charles Tytler
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <string_view>
+#include <utility>
+
+/**
+ * @brief Simulated control model which stands in for a DCS cockpit.
+ *
+ *   Commands sent by the plugin are applied to the controls they address, and the resulting state is exported in the
+ *   next frame of each protocol, closing the loop from a key press through to the state displayed on the Stream Deck.
+ *   Only state which has changed since the previous frame is exported, as DCS-BIOS and the export script do, unless a
+ *   reset command requests the full state. The emulator holds no sockets and is not thread-safe.
+ */
+class CockpitEmulator
+{
+  public:
+    static constexpr const char *AIRCRAFT_NAME = "Harness"; // Module name exported at the DCS-BIOS ACFT_NAME address.
+
+    CockpitEmulator() = default;
+
+    /**
+     * @brief Adds a DCS-BIOS integer control, set by commands to its identifier and exported at its address bits.
+     * @param identifier Control identifier used in DCS-BIOS commands, such as "UFC_1".
+     * @param address    Address of the exported word.
+     * @param mask       Mask of the control's bits within the word.
+     * @param shift      Shift of the control's bits within the word.
+     */
+    void add_dcs_bios_control(const std::string &identifier,
+                              const uint16_t address,
+                              const uint16_t mask,
+                              const uint8_t shift);
+
+    /**
+     * @brief Adds an ExportScript clickable control, set by commands to its device and button and exported at its ID.
+     */
+    void add_export_script_control(const int device_id, const int button_id, const int export_id);
+
+    /**
+     * @brief Applies a DCS-BIOS command datagram of "<identifier> <value>\n" lines.
+     *
+     *   Values may be an integer, or "INC", "DEC" or "TOGGLE". A "SYNC E" line requests the full state be exported.
+     * @return Number of commands applied to known controls.
+     */
+    int apply_dcs_bios_commands(std::string_view datagram);
+
+    /**
+     * @brief Applies an ExportScript command datagram of "C<device>,<button>,<value>", or "R" to request the full
+     *        state.
+     * @return Number of commands applied to known controls.
+     */
+    int apply_export_script_command(std::string_view datagram);
+
+    /**
+     * @brief Sets an exported ExportScript value directly, as though it changed in the cockpit.
+     */
+    void set_export_script_value(const int export_id, const std::string &value);
+
+    /**
+     * @brief Builds the next DCS-BIOS frame, from sync bytes to the end of frame marker.
+     */
+    std::string next_dcs_bios_frame();
+
+    /**
+     * @brief Builds the next ExportScript datagram, of "header*id=value:id=value:...".
+     */
+    std::string next_export_script_datagram();
+
+    /**
+     * @brief Current value of a DCS-BIOS control, or 0 if the identifier is unknown.
+     */
+    unsigned int dcs_bios_value(const std::string &identifier) const;
+
+  private:
+    struct DcsBiosControl {
+        uint16_t address;
+        uint16_t mask;
+        uint8_t shift;
+    };
+
+    void set_dcs_bios_value(const DcsBiosControl &control, const unsigned int value);
+
+    std::map<std::string, DcsBiosControl> dcs_bios_controls_;
+    std::map<uint16_t, uint16_t> dcs_bios_words_;    // Exported words, by address.
+    std::set<uint16_t> changed_dcs_bios_addresses_;  // Words changed since the previous frame.
+    bool dcs_bios_full_state_requested_ = true;
+
+    std::map<std::pair<int, int>, int> export_id_by_clickable_; // Export ID of each (device, button).
+    std::map<int, std::string> export_values_;                  // Exported values, by ID.
+    std::set<int> changed_export_ids_;                          // IDs changed since the previous datagram.
+    bool export_full_state_requested_ = true;
+    uint16_t frame_count_ = 0;
+};
@@ -0,0 +1,622 @@
+// Copyright 2026 Charles Tytler
+
+#include "ElgatoSD/ESDConnectionManager.h"
+#include "Harness/CockpitEmulator.h"
+#include "Harness/MockStreamDeckServer.h"
+#include "StreamdeckInterface/StreamdeckInterface.h"
+#include "Utilities/UdpSocket.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <csignal>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <thread>
+
+/**
+ *  Headless end-to-end harness which runs the plugin against a mock Stream Deck application and an emulated DCS
+ *  cockpit, to soak test whole profiles without either application running:
+ *    StreamDeckDCSHarness [options]
+ *
+ *  A profile of lamp buttons, rotary encoders and optionally DCS-BIOS buttons is made to appear, after which the
+ *  cockpit exports a frame at a fixed rate while keyDown/keyUp and dialRotate events are sent at a fixed rate. Each
+ *  frame updates the IDs shown in the lamps' titles, and echoes back the commands received since the previous frame
+ *  into the state monitored by the buttons' images. Latency is measured:
+ *    - from each frame to the setTitle displaying its value (sim to display),
+ *    - from each input event to the command it produces (input to command),
+ *    - from each key event to the setState showing its echoed state (key to state), the round trip felt by a pilot.
+ */
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+// Ports of the plugin's connections, as seen from the simulator side.
+const std::string EXPORT_SCRIPT_RECEIVE_PORT = "26027";
+const std::string EXPORT_SCRIPT_SEND_PORT = "1725";
+const std::string DCS_BIOS_RECEIVE_PORT = "7778";
+const std::string DCS_BIOS_SEND_PORT = "5010";
+
+const std::string LAMP_ACTION = "com.ctytler.dcs.lamp.button.two-state";
+const std::string ENCODER_ACTION = "com.ctytler.dcs.encoder.rotary";
+const std::string DCS_BIOS_ACTION = "com.ctytler.dcs.dcs-bios";
+constexpr int LAMP_DEVICE_ID = 25;    // ExportScript device of lamp button commands.
+constexpr int ENCODER_DEVICE_ID = 26; // ExportScript device of encoder commands.
+constexpr int FIRST_BUTTON_ID = 3001;
+constexpr uint16_t FIRST_DCS_BIOS_ADDRESS = 0x1000; // Address of the first DCS-BIOS button, packed 16 to a word.
+constexpr int64_t MAX_TRACKED_SIM_VALUES = 1000;    // Simulated values displayed later than this are not measured.
+
+std::atomic<bool> stop_requested{false};
+
+struct HarnessSettings {
+    uint16_t port = 28196;      // Port of the mock Stream Deck application.
+    int num_lamps = 64;         // Number of lamp button contexts in the profile.
+    int num_encoders = 8;       // Number of encoder contexts in the profile.
+    int num_dcs_bios = 0;       // Number of DCS-BIOS button contexts, which need the plugin to join multicast.
+    int first_dcs_id = 2000;    // ExportScript ID monitored by the first lamp, with later lamps counting up.
+    double sim_rate = 50.0;     // Cockpit frames per second.
+    double input_rate = 20.0;   // Input events per second, across all contexts.
+    double warmup_s = 2.0;      // Time allowed for the profile to appear before measurement starts.
+    double duration_s = 30.0;   // Measurement time.
+    std::string output_path;    // Optional path to write the report to as JSON.
+};
+
+/**
+ * @brief Collects latency samples and summarizes their distribution.
+ */
+class LatencyDistribution
+{
+  public:
+    void add(const Clock::duration latency)
+    {
+        samples_us_.push_back(std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+    }
+
+    json summary()
+    {
+        std::sort(samples_us_.begin(), samples_us_.end());
+        json result = {{"count", samples_us_.size()}};
+        if (!samples_us_.empty()) {
+            result["p50_us"] = percentile(0.50);
+            result["p90_us"] = percentile(0.90);
+            result["p99_us"] = percentile(0.99);
+            result["max_us"] = samples_us_.back();
+        }
+        return result;
+    }
+
+  private:
+    int64_t percentile(const double fraction) const
+    {
+        const auto index = static_cast<size_t>(fraction * static_cast<double>(samples_us_.size() - 1) + 0.5);
+        return samples_us_[index];
+    }
+
+    std::vector<int64_t> samples_us_;
+};
+
+/**
+ * @brief Measurements shared between the mock Stream Deck, simulator and driving threads.
+ */
+struct HarnessMeasurements {
+    std::mutex mutex;
+    bool is_measuring = false;
+    std::map<std::string, uint64_t> messages_by_event;                 // Plugin messages received, by event.
+    std::unordered_map<int64_t, Clock::time_point> sim_sent_by_value;  // Send time of recent simulated values.
+    std::unordered_map<std::string, std::deque<Clock::time_point>> pending_inputs_by_address;
+    std::unordered_map<std::string, std::deque<std::pair<Clock::time_point, int>>> pending_states_by_context;
+    LatencyDistribution sim_to_display;
+    LatencyDistribution input_to_command;
+    LatencyDistribution key_to_state;
+    uint64_t num_commands = 0;
+    uint64_t num_unmatched_commands = 0; // Commands received without an outstanding input event for their address.
+    CockpitEmulator cockpit;
+};
+
+double process_cpu_seconds()
+{
+#ifdef _WIN32
+    FILETIME creation_time, exit_time, kernel_time, user_time;
+    GetProcessTimes(GetCurrentProcess(), &creation_time, &exit_time, &kernel_time, &user_time);
+    const auto to_seconds = [](const FILETIME &time) {
+        return static_cast<double>((static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime) * 1e-7;
+    };
+    return to_seconds(kernel_time) + to_seconds(user_time);
+#else
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    const auto to_seconds = [](const timeval &time) { return time.tv_sec + time.tv_usec * 1e-6; };
+    return to_seconds(usage.ru_utime) + to_seconds(usage.ru_stime);
+#endif
+}
+
+std::string send_address(const int device_id, const int index)
+{
+    return std::to_string(device_id) + "," + std::to_string(FIRST_BUTTON_ID + index);
+}
+
+/**
+ * @brief ExportScript ID which the cockpit echoes a lamp's commands into, monitored by the lamp's image state.
+ */
+int lamp_echo_id(const HarnessSettings &settings, const int index)
+{
+    return settings.first_dcs_id + settings.num_lamps + settings.num_encoders + index;
+}
+
+json lamp_settings(const HarnessSettings &settings, const int index)
+{
+    return {{"dcs_id_string_monitor", std::to_string(settings.first_dcs_id + index)},
+            {"string_monitor_passthrough_check", true},
+            {"dcs_id_compare_monitor", std::to_string(lamp_echo_id(settings, index))},
+            {"dcs_id_compare_condition", "EQUAL_TO"},
+            {"dcs_id_comparison_value", "1"},
+            {"send_address", send_address(LAMP_DEVICE_ID, index)},
+            {"press_value", "1"},
+            {"release_value", "0"}};
+}
+
+json encoder_settings(const HarnessSettings &settings, const int index)
+{
+    return {{"dcs_id_increment_monitor", std::to_string(settings.first_dcs_id + settings.num_lamps + index)},
+            {"send_address", send_address(ENCODER_DEVICE_ID, index)},
+            {"increment_cw", "0.1"},
+            {"increment_ccw", "-0.1"},
+            {"increment_min", "0"},
+            {"increment_max", "1"},
+            {"increment_cycle_allowed_check", true}};
+}
+
+std::string dcs_bios_identifier(const int index) { return "HARNESS_BUTTON_" + std::to_string(index); }
+
+json dcs_bios_settings(const int index)
+{
+    return {{"send_address", dcs_bios_identifier(index)},
+            {"press_value", "1"},
+            {"release_value", "0"},
+            {"dcs_id_compare_monitor", "INTEGER"},
+            {"compare_monitor_address", FIRST_DCS_BIOS_ADDRESS + 2 * (index / 16)},
+            {"compare_monitor_mask", 1 << (index % 16)},
+            {"compare_monitor_shift", index % 16},
+            {"dcs_id_compare_condition", "EQUAL_TO"},
+            {"dcs_id_comparison_value", "1"}};
+}
+
+/**
+ * @brief Adds the controls of the profile to the emulated cockpit.
+ */
+void add_cockpit_controls(CockpitEmulator &cockpit, const HarnessSettings &settings)
+{
+    for (int lamp = 0; lamp < settings.num_lamps; lamp++) {
+        cockpit.add_export_script_control(LAMP_DEVICE_ID, FIRST_BUTTON_ID + lamp, lamp_echo_id(settings, lamp));
+    }
+    for (int encoder = 0; encoder < settings.num_encoders; encoder++) {
+        cockpit.add_export_script_control(
+            ENCODER_DEVICE_ID, FIRST_BUTTON_ID + encoder, settings.first_dcs_id + settings.num_lamps + encoder);
+    }
+    for (int button = 0; button < settings.num_dcs_bios; button++) {
+        cockpit.add_dcs_bios_control(dcs_bios_identifier(button),
+                                     static_cast<uint16_t>(FIRST_DCS_BIOS_ADDRESS + 2 * (button / 16)),
+                                     static_cast<uint16_t>(1 << (button % 16)),
+                                     static_cast<uint8_t>(button % 16));
+    }
+}
+
+json action_event(const std::string &event,
+                  const std::string &action,
+                  const std::string &context,
+                  const int index,
+                  json payload)
+{
+    payload["coordinates"] = {{"column", index % 8}, {"row", index / 8}};
+    return {{"event", event}, {"action", action}, {"context", context}, {"device", "HARNESS"}, {"payload", payload}};
+}
+
+/**
+ * @brief Matches outbound plugin messages against the simulated values they display.
+ */
+void handle_plugin_message(HarnessMeasurements &measurements, const MockStreamDeckServer::ReceivedMessage &message)
+{
+    std::lock_guard<std::mutex> lock(measurements.mutex);
+    if (!measurements.is_measuring) {
+        return;
+    }
+    measurements.messages_by_event[message.event]++;
+    if (message.event == kESDSDKEventSetState) {
+        auto &pending_states = measurements.pending_states_by_context[message.context];
+        if (!pending_states.empty() && pending_states.front().second == message.payload.value("state", -1)) {
+            measurements.key_to_state.add(message.time - pending_states.front().first);
+            pending_states.pop_front();
+        }
+    } else if (message.event == kESDSDKEventSetTitle) {
+        const std::string title = message.payload.value("title", "");
+        try {
+            const auto sent = measurements.sim_sent_by_value.find(std::stoll(title));
+            if (sent != measurements.sim_sent_by_value.end()) {
+                measurements.sim_to_display.add(message.time - sent->second);
+            }
+        } catch (const std::exception &) {
+            // Titles not set from a simulated value are not measured.
+        }
+    }
+}
+
+/**
+ * @brief Get the send address of a command sent by the plugin, or an empty string for other messages.
+ */
+std::string command_address(const Protocol protocol, const std::string &message)
+{
+    if (protocol == Protocol::DCS_BIOS) {
+        // Command is of the form "<identifier> <value>\n", where reset commands begin with "SYNC".
+        const auto value_delimiter = message.find(' ');
+        const bool is_command = (value_delimiter != std::string::npos) && (message.rfind("SYNC ", 0) != 0);
+        return is_command ? message.substr(0, value_delimiter) : "";
+    }
+    // Command is of the form "C<device>,<button>,<value>".
+    const auto value_delimiter = message.find_last_of(',');
+    const bool is_command = !message.empty() && (message[0] == 'C') && (value_delimiter != std::string::npos);
+    return is_command ? message.substr(1, value_delimiter - 1) : "";
+}
+
+/**
+ * @brief Receives commands sent by the plugin, applying them to the cockpit and matching them to the input events
+ * that caused them.
+ */
+void receive_commands(UdpSocket &sim_socket, const Protocol protocol, HarnessMeasurements &measurements)
+{
+    while (!stop_requested) {
+        const auto datagram = sim_socket.receive_datagram();
+        const auto receive_time = Clock::now();
+        if (datagram.size() == 0) {
+            continue;
+        }
+        const std::string message(datagram.data(), datagram.size());
+
+        std::lock_guard<std::mutex> lock(measurements.mutex);
+        if (protocol == Protocol::DCS_BIOS) {
+            measurements.cockpit.apply_dcs_bios_commands(message);
+        } else {
+            measurements.cockpit.apply_export_script_command(message);
+        }
+        const std::string address = command_address(protocol, message);
+        if (!measurements.is_measuring || address.empty()) {
+            continue;
+        }
+        measurements.num_commands++;
+        auto &pending_inputs = measurements.pending_inputs_by_address[address];
+        if (pending_inputs.empty()) {
+            measurements.num_unmatched_commands++;
+        } else {
+            measurements.input_to_command.add(receive_time - pending_inputs.front());
+            pending_inputs.pop_front();
+        }
+    }
+}
+
+/**
+ * @brief Sends the next input event of the profile, cycling through each context in turn.
+ */
+void send_input_event(MockStreamDeckServer &stream_deck,
+                      HarnessMeasurements &measurements,
+                      const HarnessSettings &settings,
+                      const uint64_t input_count)
+{
+    const int num_contexts = settings.num_lamps + settings.num_encoders + settings.num_dcs_bios;
+    const int index = static_cast<int>(input_count % num_contexts);
+    // Every other pass through the contexts releases the keys or turns the encoders back.
+    const bool is_second_pass = (input_count / num_contexts) % 2 == 1;
+    const std::string key_event = is_second_pass ? kESDSDKEventKeyUp : kESDSDKEventKeyDown;
+    const int expected_state = is_second_pass ? 0 : 1; // State of the button's image once its command is echoed.
+
+    json event;
+    std::string address;
+    if (index < settings.num_lamps) {
+        event = action_event(key_event,
+                             LAMP_ACTION,
+                             "lamp_" + std::to_string(index),
+                             index,
+                             {{"settings", lamp_settings(settings, index)}, {"state", 0}});
+        address = send_address(LAMP_DEVICE_ID, index);
+    } else if (index >= settings.num_lamps + settings.num_encoders) {
+        const int button = index - settings.num_lamps - settings.num_encoders;
+        event = action_event(key_event,
+                             DCS_BIOS_ACTION,
+                             "dcs_bios_" + std::to_string(button),
+                             index,
+                             {{"settings", dcs_bios_settings(button)}, {"state", 0}});
+        address = dcs_bios_identifier(button);
+    } else {
+        const int encoder = index - settings.num_lamps;
+        event = action_event(kESDSDKEventDialRotate,
+                             ENCODER_ACTION,
+                             "encoder_" + std::to_string(encoder),
+                             index,
+                             {{"settings", encoder_settings(settings, encoder)},
+                              {"ticks", is_second_pass ? -1 : 1},
+                              {"pressed", false}});
+        address = send_address(ENCODER_DEVICE_ID, encoder);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(measurements.mutex);
+        const auto send_time = Clock::now();
+        measurements.pending_inputs_by_address[address].push_back(send_time);
+        if (event[kESDSDKCommonEvent] != kESDSDKEventDialRotate) {
+            measurements.pending_states_by_context[event[kESDSDKCommonContext]].emplace_back(send_time, expected_state);
+        }
+    }
+    stream_deck.send_event(event);
+}
+
+/**
+ * @brief Sends the next cockpit frame of each protocol, with every lamp title ID set to the value.
+ */
+void send_cockpit_frame(UdpSocket &export_script_socket,
+                        UdpSocket *dcs_bios_socket,
+                        HarnessMeasurements &measurements,
+                        const HarnessSettings &settings,
+                        const int64_t value)
+{
+    std::string export_script_datagram;
+    std::string dcs_bios_frame;
+    {
+        std::lock_guard<std::mutex> lock(measurements.mutex);
+        for (int lamp = 0; lamp < settings.num_lamps; lamp++) {
+            measurements.cockpit.set_export_script_value(settings.first_dcs_id + lamp, std::to_string(value));
+        }
+        export_script_datagram = measurements.cockpit.next_export_script_datagram();
+        dcs_bios_frame = measurements.cockpit.next_dcs_bios_frame();
+        measurements.sim_sent_by_value[value] = Clock::now();
+        // Values count up by one each frame, so only the value which is no longer recent needs to be dropped.
+        measurements.sim_sent_by_value.erase(value - MAX_TRACKED_SIM_VALUES);
+    }
+    export_script_socket.send_string(export_script_datagram);
+    if (dcs_bios_socket != nullptr) {
+        dcs_bios_socket->send_string(dcs_bios_frame);
+    }
+}
+
+json run_harness(const HarnessSettings &settings)
+{
+    HarnessMeasurements measurements;
+    add_cockpit_controls(measurements.cockpit, settings);
+    MockStreamDeckServer stream_deck(settings.port,
+                                     [&measurements](const MockStreamDeckServer::ReceivedMessage &message) {
+                                         handle_plugin_message(measurements, message);
+                                     });
+    UdpSocket export_script_socket("127.0.0.1", EXPORT_SCRIPT_RECEIVE_PORT, EXPORT_SCRIPT_SEND_PORT);
+    std::unique_ptr<UdpSocket> dcs_bios_socket;
+    if (settings.num_dcs_bios > 0) {
+        dcs_bios_socket = std::make_unique<UdpSocket>("127.0.0.1", DCS_BIOS_RECEIVE_PORT, DCS_BIOS_SEND_PORT);
+    }
+
+    auto plugin = std::make_unique<StreamdeckInterface>();
+    auto connection_manager =
+        std::make_unique<ESDConnectionManager>(settings.port, "HARNESS_PLUGIN", "registerPlugin", "{}", plugin.get());
+    std::thread plugin_thread([&connection_manager]() { connection_manager->Run(); });
+    std::vector<std::thread> command_threads;
+    command_threads.emplace_back([&export_script_socket, &measurements]() {
+        receive_commands(export_script_socket, Protocol::DCS_ExportScript, measurements);
+    });
+    if (dcs_bios_socket) {
+        command_threads.emplace_back([&dcs_bios_socket, &measurements]() {
+            receive_commands(*dcs_bios_socket, Protocol::DCS_BIOS, measurements);
+        });
+    }
+
+    json report;
+    if (!stream_deck.wait_for_registration(std::chrono::seconds(5))) {
+        report["error"] = "Plugin did not register with the mock Stream Deck application";
+    } else {
+        stream_deck.send_event(
+            {{"event", kESDSDKEventDidReceiveGlobalSettings}, {"payload", {{"settings", json::object()}}}});
+        for (int lamp = 0; lamp < settings.num_lamps; lamp++) {
+            stream_deck.send_event(action_event(kESDSDKEventWillAppear,
+                                                LAMP_ACTION,
+                                                "lamp_" + std::to_string(lamp),
+                                                lamp,
+                                                {{"settings", lamp_settings(settings, lamp)}, {"state", 0}}));
+        }
+        for (int encoder = 0; encoder < settings.num_encoders; encoder++) {
+            stream_deck.send_event(action_event(kESDSDKEventWillAppear,
+                                                ENCODER_ACTION,
+                                                "encoder_" + std::to_string(encoder),
+                                                settings.num_lamps + encoder,
+                                                {{"settings", encoder_settings(settings, encoder)}}));
+        }
+        for (int button = 0; button < settings.num_dcs_bios; button++) {
+            stream_deck.send_event(action_event(kESDSDKEventWillAppear,
+                                                DCS_BIOS_ACTION,
+                                                "dcs_bios_" + std::to_string(button),
+                                                settings.num_lamps + settings.num_encoders + button,
+                                                {{"settings", dcs_bios_settings(button)}, {"state", 0}}));
+        }
+        std::this_thread::sleep_for(std::chrono::duration<double>(settings.warmup_s));
+
+        {
+            std::lock_guard<std::mutex> lock(measurements.mutex);
+            measurements.is_measuring = true;
+        }
+        const double cpu_start_s = process_cpu_seconds();
+        const auto start_time = Clock::now();
+        const auto end_time = start_time + std::chrono::duration_cast<Clock::duration>(
+                                               std::chrono::duration<double>(settings.duration_s));
+        const auto sim_interval = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(1.0 / std::max(settings.sim_rate, 0.001)));
+        const auto input_interval = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(1.0 / std::max(settings.input_rate, 0.001)));
+        const int num_contexts = settings.num_lamps + settings.num_encoders + settings.num_dcs_bios;
+        const bool sends_inputs = settings.input_rate > 0.0 && num_contexts > 0;
+
+        auto next_sim_time = start_time;
+        auto next_input_time = start_time;
+        int64_t sim_value = 0;
+        uint64_t input_count = 0;
+        while (!stop_requested && Clock::now() < end_time) {
+            const auto now = Clock::now();
+            if (settings.sim_rate > 0.0 && now >= next_sim_time) {
+                send_cockpit_frame(export_script_socket, dcs_bios_socket.get(), measurements, settings, ++sim_value);
+                next_sim_time += sim_interval;
+            }
+            if (sends_inputs && now >= next_input_time) {
+                send_input_event(stream_deck, measurements, settings, input_count++);
+                next_input_time += input_interval;
+            }
+            std::this_thread::sleep_until(std::min(std::min(next_sim_time, next_input_time), end_time));
+        }
+        // Allow for the plugin to finish handling the last events sent.
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        const double wall_s = std::chrono::duration<double>(Clock::now() - start_time).count();
+        const double cpu_s = process_cpu_seconds() - cpu_start_s;
+
+        std::lock_guard<std::mutex> lock(measurements.mutex);
+        measurements.is_measuring = false;
+        json messages_per_second = json::object();
+        uint64_t total_messages = 0;
+        for (const auto &event_count : measurements.messages_by_event) {
+            messages_per_second[event_count.first] = event_count.second / wall_s;
+            total_messages += event_count.second;
+        }
+        messages_per_second["total"] = total_messages / wall_s;
+        uint64_t num_unanswered_inputs = 0;
+        for (const auto &pending_inputs : measurements.pending_inputs_by_address) {
+            num_unanswered_inputs += pending_inputs.second.size();
+        }
+        uint64_t num_unechoed_keys = 0;
+        for (const auto &pending_states : measurements.pending_states_by_context) {
+            num_unechoed_keys += pending_states.second.size();
+        }
+
+        report["wall_time_s"] = wall_s;
+        report["cockpit_frames_sent"] = sim_value;
+        report["input_events_sent"] = input_count;
+        report["sim_to_display_latency"] = measurements.sim_to_display.summary();
+        report["input_to_command_latency"] = measurements.input_to_command.summary();
+        report["key_to_state_latency"] = measurements.key_to_state.summary();
+        report["commands_received"] = measurements.num_commands;
+        report["unmatched_commands"] = measurements.num_unmatched_commands;
+        report["unanswered_inputs"] = num_unanswered_inputs;
+        report["unechoed_keys"] = num_unechoed_keys;
+        report["messages_per_second"] = messages_per_second;
+        // CPU time covers the whole process, so includes the mock Stream Deck and simulator threads.
+        report["cpu_time_s"] = cpu_s;
+        report["cpu_percent_of_wall"] = 100.0 * cpu_s / wall_s;
+    }
+
+    stop_requested = true;
+    stream_deck.close_connection();
+    plugin_thread.join();
+    for (auto &command_thread : command_threads) {
+        command_thread.join();
+    }
+    plugin.reset();
+    return report;
+}
+
+void print_report(const json &report)
+{
+    if (report.contains("error")) {
+        std::cout << "Error: " << report["error"].get<std::string>() << std::endl;
+        return;
+    }
+    const auto print_latency = [](const std::string &name, const json &latency) {
+        std::cout << std::left << std::setw(26) << name << " n=" << latency["count"];
+        if (latency.contains("p50_us")) {
+            std::cout << "  p50=" << latency["p50_us"] << "us  p90=" << latency["p90_us"] << "us  p99="
+                      << latency["p99_us"] << "us  max=" << latency["max_us"] << "us";
+        }
+        std::cout << std::endl;
+    };
+    std::cout << std::fixed << std::setprecision(1);
+    print_latency("Sim to display latency:", report["sim_to_display_latency"]);
+    print_latency("Input to command latency:", report["input_to_command_latency"]);
+    print_latency("Key to state latency:", report["key_to_state_latency"]);
+    std::cout << "Commands: " << report["commands_received"] << " received, " << report["unmatched_commands"]
+              << " unmatched, " << report["unanswered_inputs"] << " inputs unanswered, " << report["unechoed_keys"]
+              << " key states not echoed" << std::endl;
+    std::cout << "Plugin messages per second:" << std::endl;
+    for (const auto &rate : report["messages_per_second"].items()) {
+        std::cout << "  " << std::left << std::setw(24) << rate.key() << rate.value().get<double>() << std::endl;
+    }
+    std::cout << "CPU time: " << report["cpu_time_s"].get<double>() << "s ("
+              << report["cpu_percent_of_wall"].get<double>() << "% of " << report["wall_time_s"].get<double>()
+              << "s wall)" << std::endl;
+}
+
+void print_usage()
+{
+    std::cout << "Usage: StreamDeckDCSHarness [--port <n>] [--lamps <n>] [--encoders <n>] [--dcs-bios <n>]\n"
+                 "                            [--first-id <id>] [--sim-rate <hz>] [--input-rate <hz>] [--warmup <s>]\n"
+                 "                            [--duration <s>] [--output <report.json>]"
+              << std::endl;
+}
+} // namespace
+
+void signalInteruptStopHandler(int) { stop_requested = true; }
+
+int main(int argc, char *argv[])
+{
+    HarnessSettings settings;
+    try {
+        for (int i = 1; i < argc; i++) {
+            const std::string arg = argv[i];
+            const bool has_value = i + 1 < argc;
+            if (arg == "--port" && has_value) {
+                settings.port = static_cast<uint16_t>(std::stoi(argv[++i]));
+            } else if (arg == "--lamps" && has_value) {
+                settings.num_lamps = std::max(0, std::stoi(argv[++i]));
+            } else if (arg == "--encoders" && has_value) {
+                settings.num_encoders = std::max(0, std::stoi(argv[++i]));
+            } else if (arg == "--dcs-bios" && has_value) {
+                settings.num_dcs_bios = std::max(0, std::stoi(argv[++i]));
+            } else if (arg == "--first-id" && has_value) {
+                settings.first_dcs_id = std::stoi(argv[++i]);
+            } else if (arg == "--sim-rate" && has_value) {
+                settings.sim_rate = std::stod(argv[++i]);
+            } else if (arg == "--input-rate" && has_value) {
+                settings.input_rate = std::stod(argv[++i]);
+            } else if (arg == "--warmup" && has_value) {
+                settings.warmup_s = std::stod(argv[++i]);
+            } else if (arg == "--duration" && has_value) {
+                settings.duration_s = std::stod(argv[++i]);
+            } else if (arg == "--output" && has_value) {
+                settings.output_path = argv[++i];
+            } else {
+                print_usage();
+                return 1;
+            }
+        }
+    } catch (const std::exception &) {
+        print_usage();
+        return 1;
+    }
+
+    signal(SIGINT, signalInteruptStopHandler);
+
+    json report;
+    try {
+        report = run_harness(settings);
+    } catch (const std::exception &e) {
+        report["error"] = e.what();
+    }
+    report["settings"] = {{"lamps", settings.num_lamps},
+                          {"encoders", settings.num_encoders},
+                          {"dcs_bios", settings.num_dcs_bios},
+                          {"sim_rate", settings.sim_rate},
+                          {"input_rate", settings.input_rate},
+                          {"duration_s", settings.duration_s}};
+    print_report(report);
+    if (!settings.output_path.empty()) {
+        std::ofstream(settings.output_path) << report.dump(4) << std::endl;
+    }
+    return report.contains("error") ? 1 : 0;
+}
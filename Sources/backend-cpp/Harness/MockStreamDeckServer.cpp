@@ -0,0 +1,85 @@
+// Copyright 2026 Charles Tytler
+
+#include "MockStreamDeckServer.h"
+
+#include "ElgatoSD/ESDSDKDefines.h"
+
+MockStreamDeckServer::MockStreamDeckServer(const uint16_t port, std::function<void(const ReceivedMessage &)> handler)
+    : handler_(std::move(handler))
+{
+    server_.clear_access_channels(websocketpp::log::alevel::all);
+    server_.clear_error_channels(websocketpp::log::elevel::all);
+    server_.init_asio();
+    server_.set_reuse_addr(true);
+    server_.set_open_handler([this](websocketpp::connection_hdl connection) { on_open(connection); });
+    server_.set_message_handler([this](websocketpp::connection_hdl connection, Server::message_ptr message) {
+        on_message(connection, message);
+    });
+    server_.listen(asio::ip::tcp::endpoint(asio::ip::address::from_string("127.0.0.1"), port));
+    server_.start_accept();
+    server_thread_ = std::thread([this]() { server_.run(); });
+}
+
+MockStreamDeckServer::~MockStreamDeckServer()
+{
+    close_connection();
+    server_.stop_listening();
+    server_.stop();
+    if (server_thread_.joinable()) {
+        server_thread_.join();
+    }
+}
+
+bool MockStreamDeckServer::wait_for_registration(const std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> lock(connection_mutex_);
+    return registered_.wait_for(lock, timeout, [this]() { return is_registered_; });
+}
+
+void MockStreamDeckServer::send_event(const json &event)
+{
+    std::lock_guard<std::mutex> lock(connection_mutex_);
+    if (is_registered_) {
+        websocketpp::lib::error_code ec;
+        server_.send(connection_, event.dump(), websocketpp::frame::opcode::text, ec);
+    }
+}
+
+void MockStreamDeckServer::close_connection()
+{
+    std::lock_guard<std::mutex> lock(connection_mutex_);
+    if (is_registered_) {
+        websocketpp::lib::error_code ec;
+        server_.close(connection_, websocketpp::close::status::going_away, "Harness finished", ec);
+        is_registered_ = false;
+    }
+}
+
+void MockStreamDeckServer::on_open(websocketpp::connection_hdl connection)
+{
+    std::lock_guard<std::mutex> lock(connection_mutex_);
+    connection_ = connection;
+}
+
+void MockStreamDeckServer::on_message(websocketpp::connection_hdl connection, Server::message_ptr message)
+{
+    const auto receive_time = Clock::now();
+    json message_json;
+    try {
+        message_json = json::parse(message->get_payload());
+    } catch (const json::exception &) {
+        return;
+    }
+    ReceivedMessage received{receive_time,
+                             message_json.value(kESDSDKCommonEvent, ""),
+                             message_json.value(kESDSDKCommonContext, ""),
+                             message_json.value(kESDSDKCommonPayload, json::object())};
+    {
+        std::lock_guard<std::mutex> lock(connection_mutex_);
+        if (!is_registered_ && connection.lock() == connection_.lock()) {
+            is_registered_ = true;
+            registered_.notify_all();
+        }
+    }
+    handler_(received);
+}
@@ -0,0 +1,84 @@
+// Copyright 2026 Charles Tytler
+
+#pragma once
+
+#include "nlohmann/json.hpp"
+using json = nlohmann::json;
+
+#ifndef ASIO_STANDALONE
+#define ASIO_STANDALONE
+#endif
+#include <Vendor/websocketpp/websocketpp/config/asio_no_tls.hpp>
+#include <Vendor/websocketpp/websocketpp/server.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * @brief Local websocket server which stands in for the Stream Deck application.
+ *
+ *   The plugin connects to the server as it would to the Stream Deck application, after which events can be sent to it
+ *   and every message it sends is passed to a handler with the time it was received.
+ */
+class MockStreamDeckServer
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    struct ReceivedMessage {
+        Clock::time_point time; // Time the message was received from the plugin.
+        std::string event;
+        std::string context;
+        json payload;
+    };
+
+    /**
+     * @brief Starts listening on the localhost port in a background thread.
+     * @param handler Called from the server thread for each message received from the plugin.
+     * @throws websocketpp::exception if the port cannot be listened on.
+     */
+    MockStreamDeckServer(const uint16_t port, std::function<void(const ReceivedMessage &)> handler);
+
+    /**
+     * @brief Closes any connection and stops the server thread.
+     */
+    ~MockStreamDeckServer();
+
+    MockStreamDeckServer(const MockStreamDeckServer &) = delete;
+    MockStreamDeckServer &operator=(const MockStreamDeckServer &) = delete;
+
+    /**
+     * @brief Waits for the plugin to connect and send its registration event, which is the first message it sends.
+     * @return True if the plugin registered within the timeout.
+     */
+    bool wait_for_registration(const std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Sends an event to the registered plugin, as the Stream Deck application would.
+     */
+    void send_event(const json &event);
+
+    /**
+     * @brief Closes the connection to the plugin, which ends its connection manager's event loop.
+     */
+    void close_connection();
+
+  private:
+    using Server = websocketpp::server<websocketpp::config::asio>;
+
+    void on_open(websocketpp::connection_hdl connection);
+    void on_message(websocketpp::connection_hdl connection, Server::message_ptr message);
+
+    Server server_;
+    std::thread server_thread_;
+    std::function<void(const ReceivedMessage &)> handler_;
+
+    std::mutex connection_mutex_;
+    std::condition_variable registered_;
+    websocketpp::connection_hdl connection_; // Connection to the plugin, once opened.
+    bool is_registered_ = false;
+};
@@ -0,0 +1,105 @@
+// Copyright 2026 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "Harness/CockpitEmulator.h"
+#include "SimulatorInterface/Protocols/DcsBiosStreamParser.h"
+
+#include <unordered_map>
+
+namespace test
+{
+/**
+ * @brief Parses a DCS-BIOS frame of the emulator, returning the data of each address in the frame.
+ */
+static std::unordered_map<unsigned int, unsigned int> parse_frame(const std::string &frame)
+{
+    DcsBiosStreamParser parser;
+    std::unordered_map<unsigned int, unsigned int> data_by_address;
+    for (const char byte : frame) {
+        parser.processByte(byte, data_by_address);
+    }
+    EXPECT_TRUE(parser.at_end_of_frame());
+    return data_by_address;
+}
+
+TEST(CockpitEmulatorTest, dcs_bios_first_frame_exports_full_state)
+{
+    CockpitEmulator cockpit;
+    cockpit.add_dcs_bios_control("UFC_1", 0x1000, 0x0001, 0);
+    const auto data_by_address = parse_frame(cockpit.next_dcs_bios_frame());
+    // Aircraft name is exported at address 0 along with each control's word.
+    EXPECT_EQ(0x6148, data_by_address.at(0x0000)); // "Ha"
+    EXPECT_EQ(0x0000, data_by_address.at(0x1000));
+
+    // Nothing has changed since the first frame.
+    const auto next_data_by_address = parse_frame(cockpit.next_dcs_bios_frame());
+    EXPECT_EQ(0, next_data_by_address.count(0x1000));
+    EXPECT_EQ(0, next_data_by_address.count(0x0000));
+}
+
+TEST(CockpitEmulatorTest, dcs_bios_commands_change_packed_controls)
+{
+    CockpitEmulator cockpit;
+    cockpit.add_dcs_bios_control("UFC_1", 0x1000, 0x0001, 0);
+    cockpit.add_dcs_bios_control("UFC_KNOB", 0x1000, 0x0070, 4);
+    (void)cockpit.next_dcs_bios_frame();
+
+    EXPECT_EQ(2, cockpit.apply_dcs_bios_commands("UFC_1 TOGGLE\nUFC_KNOB 3\nUNKNOWN 1\n"));
+    EXPECT_EQ(1, cockpit.dcs_bios_value("UFC_1"));
+    EXPECT_EQ(3, cockpit.dcs_bios_value("UFC_KNOB"));
+    EXPECT_EQ(0x0031, parse_frame(cockpit.next_dcs_bios_frame()).at(0x1000));
+
+    // Values are limited to the range of the control's bits.
+    cockpit.apply_dcs_bios_commands("UFC_KNOB 9\n");
+    EXPECT_EQ(7, cockpit.dcs_bios_value("UFC_KNOB"));
+    cockpit.apply_dcs_bios_commands("UFC_KNOB INC\n");
+    EXPECT_EQ(7, cockpit.dcs_bios_value("UFC_KNOB"));
+    cockpit.apply_dcs_bios_commands("UFC_1 DEC\nUFC_1 DEC\n");
+    EXPECT_EQ(0, cockpit.dcs_bios_value("UFC_1"));
+    EXPECT_EQ(0, cockpit.dcs_bios_value("UNKNOWN"));
+}
+
+TEST(CockpitEmulatorTest, dcs_bios_sync_requests_full_state)
+{
+    CockpitEmulator cockpit;
+    cockpit.add_dcs_bios_control("UFC_1", 0x1000, 0x0001, 0);
+    (void)cockpit.next_dcs_bios_frame();
+    EXPECT_EQ(0, cockpit.apply_dcs_bios_commands("SYNC E\n"));
+    const auto data_by_address = parse_frame(cockpit.next_dcs_bios_frame());
+    EXPECT_EQ(1, data_by_address.count(0x0000));
+    EXPECT_EQ(1, data_by_address.count(0x1000));
+}
+
+TEST(CockpitEmulatorTest, export_script_exports_only_changed_values)
+{
+    CockpitEmulator cockpit;
+    cockpit.add_export_script_control(25, 3001, 2000);
+    EXPECT_EQ("Ikarus*2000=0:", cockpit.next_export_script_datagram());
+    EXPECT_EQ("Ikarus*", cockpit.next_export_script_datagram());
+
+    EXPECT_EQ(1, cockpit.apply_export_script_command("C25,3001,1"));
+    cockpit.set_export_script_value(2001, "TEXT");
+    EXPECT_EQ("Ikarus*2000=1:2001=TEXT:", cockpit.next_export_script_datagram());
+
+    // Setting an unchanged value does not export it again.
+    EXPECT_EQ(1, cockpit.apply_export_script_command("C25,3001,1"));
+    EXPECT_EQ("Ikarus*", cockpit.next_export_script_datagram());
+}
+
+TEST(CockpitEmulatorTest, export_script_ignores_unknown_commands)
+{
+    CockpitEmulator cockpit;
+    cockpit.add_export_script_control(25, 3001, 2000);
+    (void)cockpit.next_export_script_datagram();
+    EXPECT_EQ(0, cockpit.apply_export_script_command("C25,3002,1"));
+    EXPECT_EQ(0, cockpit.apply_export_script_command("C25,1"));
+    EXPECT_EQ(0, cockpit.apply_export_script_command("Cx,3001,1"));
+    EXPECT_EQ(0, cockpit.apply_export_script_command(""));
+    EXPECT_EQ("Ikarus*", cockpit.next_export_script_datagram());
+
+    // A reset command requests the full state.
+    EXPECT_EQ(0, cockpit.apply_export_script_command("R"));
+    EXPECT_EQ("Ikarus*2000=0:", cockpit.next_export_script_datagram());
+}
+} // namespace test
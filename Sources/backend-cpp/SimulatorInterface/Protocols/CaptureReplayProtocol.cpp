@@ -0,0 +1,41 @@
+// Copyright 2026 Charles Tytler
+
+#include "CaptureReplayProtocol.h"
+
+CaptureReplaySource::CaptureReplaySource(const std::string &path, const uint8_t channel, const double speed)
+    : capture_file_(path), reader_(capture_file_.data(), capture_file_.size()), channel_(channel), speed_(speed),
+      replay_start_time_(std::chrono::steady_clock::now())
+{
+    due_records_.reserve(MAX_DATAGRAMS_PER_UPDATE);
+}
+
+const std::vector<DatagramCaptureReader::Record> &CaptureReplaySource::next_due_records()
+{
+    due_records_.clear();
+    const uint64_t replay_time = replay_time_ns();
+    while (due_records_.size() < MAX_DATAGRAMS_PER_UPDATE) {
+        if (!pending_record_) {
+            pending_record_ = reader_.next();
+            if (!pending_record_) {
+                // Loop back to the start of the capture from the next update.
+                reader_.rewind();
+                replay_start_time_ = std::chrono::steady_clock::now();
+                break;
+            }
+        }
+        if (speed_ > 0 && pending_record_->timestamp_ns > replay_time) {
+            break;
+        }
+        if (pending_record_->channel == channel_) {
+            due_records_.push_back(pending_record_.value());
+        }
+        pending_record_.reset();
+    }
+    return due_records_;
+}
+
+uint64_t CaptureReplaySource::replay_time_ns() const
+{
+    const auto elapsed = std::chrono::steady_clock::now() - replay_start_time_;
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() * speed_);
+}
@@ -0,0 +1,79 @@
+// Copyright 2026 Charles Tytler
+
+#pragma once
+
+#include "SimulatorInterface/SimulatorInterface.h"
+#include "SimulatorInterface/SimulatorProtocolTypes.h"
+#include "Utilities/DatagramCapture.h"
+#include "Utilities/MappedFile.h"
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Paces the datagrams of one protocol from a memory-mapped capture file for replay.
+ *
+ *   Datagrams are released once the replay clock reaches their capture timestamp, with the clock running at a multiple
+ *   of real time, or are released as fast as possible for a replay speed of 0. The capture loops back to its start
+ *   once all datagrams have been replayed.
+ */
+class CaptureReplaySource
+{
+  public:
+    static constexpr size_t MAX_DATAGRAMS_PER_UPDATE = 64; // Limits the work done by a single update.
+
+    /**
+     * @brief Maps the capture file into memory.
+     * @param path    Capture file written by DatagramCaptureWriter.
+     * @param channel Capture channel of the datagrams to replay.
+     * @param speed   Multiple of real time to replay at, or 0 to replay as fast as possible.
+     * @throws std::runtime_error if the file cannot be mapped or is not a valid capture.
+     */
+    CaptureReplaySource(const std::string &path, const uint8_t channel, const double speed);
+
+    /**
+     * @brief Get the datagrams which have become due since the previous call.
+     * @return Records pointing into the mapped capture, valid until the next call.
+     */
+    const std::vector<DatagramCaptureReader::Record> &next_due_records();
+
+  private:
+    uint64_t replay_time_ns() const;
+
+    MappedFile capture_file_;
+    DatagramCaptureReader reader_;
+    uint8_t channel_;
+    double speed_;
+    std::chrono::steady_clock::time_point replay_start_time_;
+    std::optional<DatagramCaptureReader::Record> pending_record_; // Next record, read but not yet due.
+    std::vector<DatagramCaptureReader::Record> due_records_;      // Reused between updates.
+};
+
+/**
+ * @brief Simulator interface which replays a recorded capture through the parser of the ProtocolT interface, in place
+ *        of datagrams received from the simulator.
+ *
+ *   No socket is opened to the simulator, so a replay does not take the ports of the simulator or of another plugin
+ *   connected to it, and commands are discarded.
+ */
+template <typename ProtocolT> class CaptureReplayProtocol : public ProtocolT
+{
+  public:
+    CaptureReplayProtocol(const SimulatorConnectionSettings &settings, const Protocol protocol)
+        : ProtocolT(settings),
+          replay_source_(settings.replay_capture_path, static_cast<uint8_t>(protocol), settings.replay_speed)
+    {
+    }
+
+    void update_simulator_state() override
+    {
+        for (const auto &record : replay_source_.next_due_records()) {
+            ProtocolT::handle_datagram(record.data, record.size);
+        }
+    }
+
+  private:
+    CaptureReplaySource replay_source_;
+};
@@ -0,0 +1,360 @@
+// Copyright 2026 Charles Tytler
+
+#include "DcsBiosControlCatalog.h"
+
+#include "Utilities/JsonReader.h"
+
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace DcsBiosControlCatalog;
+
+namespace
+{
+void append_fixed(std::vector<char> &buffer, uint64_t value, const size_t num_bytes)
+{
+    for (size_t i = 0; i < num_bytes; i++) {
+        buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+void write_fixed(std::vector<char> &buffer, const size_t offset, uint64_t value, const size_t num_bytes)
+{
+    for (size_t i = 0; i < num_bytes; i++) {
+        buffer[offset + i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+    }
+}
+
+uint64_t read_fixed(const char *data, const size_t num_bytes)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < num_bytes; i++) {
+        value |= static_cast<uint64_t>(static_cast<uint8_t>(data[i])) << (8 * i);
+    }
+    return value;
+}
+
+uint32_t hash_identifier(std::string_view identifier)
+{
+    uint32_t hash = 2166136261u; // FNV-1a
+    for (const char c : identifier) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+    }
+    return hash;
+}
+
+InputInterface input_interface_of(const std::string &name)
+{
+    if (name == "action") {
+        return InputInterface::ACTION;
+    } else if (name == "fixed_step") {
+        return InputInterface::FIXED_STEP;
+    } else if (name == "set_state") {
+        return InputInterface::SET_STATE;
+    } else if (name == "variable_step") {
+        return InputInterface::VARIABLE_STEP;
+    } else if (name == "set_string") {
+        return InputInterface::SET_STRING;
+    }
+    return InputInterface::UNKNOWN;
+}
+
+/**
+ * @brief Builds the string table of a catalog, storing each distinct string once.
+ */
+class StringTableBuilder
+{
+  public:
+    // Appends a reference to the string (offset within the string table, then length) to the record.
+    void append_reference(std::vector<char> &record, const std::string &value)
+    {
+        auto it = offsets_.find(value);
+        if (it == offsets_.end()) {
+            it = offsets_.emplace(value, static_cast<uint32_t>(strings_.size())).first;
+            strings_.insert(strings_.end(), value.begin(), value.end());
+        }
+        append_fixed(record, it->second, 4);
+        append_fixed(record, value.size(), 4);
+    }
+
+    const std::vector<char> &strings() const { return strings_; }
+
+  private:
+    std::unordered_map<std::string, uint32_t> offsets_;
+    std::vector<char> strings_;
+};
+
+std::string string_value(const json &object, const char *key)
+{
+    const auto it = object.find(key);
+    return (it != object.end() && it->is_string()) ? it->get<std::string>() : "";
+}
+
+uint64_t unsigned_value(const json &object, const char *key)
+{
+    const auto it = object.find(key);
+    return (it != object.end() && it->is_number_unsigned()) ? it->get<uint64_t>() : 0;
+}
+} // namespace
+
+SimulatorAddress Output::simulator_address() const
+{
+    if (type == OutputType::STRING) {
+        return SimulatorAddress(address, max_length);
+    }
+    return SimulatorAddress(address, mask, shift);
+}
+
+std::vector<char> DcsBiosControlCatalog::compile(const json &control_reference)
+{
+    StringTableBuilder string_table;
+    std::vector<char> controls;
+    std::vector<char> outputs;
+    std::vector<char> inputs;
+    std::vector<std::string> identifiers;
+    uint32_t num_outputs = 0;
+    uint32_t num_inputs = 0;
+
+    if (control_reference.is_object()) {
+        for (const auto &[category_name, category] : control_reference.items()) {
+            if (!category.is_object()) {
+                continue;
+            }
+            for (const auto &[control_key, control] : category.items()) {
+                if (!control.is_object()) {
+                    continue;
+                }
+                const std::string identifier = control.contains("identifier") ? string_value(control, "identifier")
+                                                                              : control_key;
+                const std::string category_of_control =
+                    control.contains("category") ? string_value(control, "category") : category_name;
+                identifiers.push_back(identifier);
+                string_table.append_reference(controls, identifier);
+                string_table.append_reference(controls, category_of_control);
+                string_table.append_reference(controls, string_value(control, "description"));
+                string_table.append_reference(controls, string_value(control, "control_type"));
+
+                const uint32_t first_output = num_outputs;
+                const uint32_t first_input = num_inputs;
+                const auto control_outputs = control.find("outputs");
+                if (control_outputs != control.end() && control_outputs->is_array()) {
+                    for (const auto &output : *control_outputs) {
+                        const bool is_string = string_value(output, "type") == "string";
+                        outputs.push_back(static_cast<char>(is_string ? OutputType::STRING : OutputType::INTEGER));
+                        outputs.push_back(static_cast<char>(unsigned_value(output, "shift_by")));
+                        append_fixed(outputs, unsigned_value(output, "address"), 2);
+                        append_fixed(outputs, unsigned_value(output, "mask"), 2);
+                        append_fixed(outputs, unsigned_value(output, "max_length"), 2);
+                        append_fixed(outputs, unsigned_value(output, "max_value"), 4);
+                        num_outputs++;
+                    }
+                }
+                const auto control_inputs = control.find("inputs");
+                if (control_inputs != control.end() && control_inputs->is_array()) {
+                    for (const auto &input : *control_inputs) {
+                        inputs.push_back(static_cast<char>(input_interface_of(string_value(input, "interface"))));
+                        append_fixed(inputs, 0, 3);
+                        append_fixed(inputs, unsigned_value(input, "max_value"), 4);
+                        append_fixed(inputs, unsigned_value(input, "suggested_step"), 4);
+                        string_table.append_reference(inputs, string_value(input, "argument"));
+                        num_inputs++;
+                    }
+                }
+                append_fixed(controls, first_output, 4);
+                append_fixed(controls, num_outputs - first_output, 2);
+                append_fixed(controls, num_inputs - first_input, 2);
+                append_fixed(controls, first_input, 4);
+            }
+        }
+    }
+
+    // Size the hash table to at most half full, so lookups rarely probe more than one or two buckets.
+    const auto num_controls = static_cast<uint32_t>(identifiers.size());
+    uint32_t num_buckets = 1;
+    while (num_buckets < 2 * num_controls) {
+        num_buckets *= 2;
+    }
+    std::vector<uint32_t> buckets(num_buckets, 0);
+    for (uint32_t i = 0; i < num_controls; i++) {
+        uint32_t bucket = hash_identifier(identifiers[i]) & (num_buckets - 1);
+        bool is_duplicate = false;
+        while (buckets[bucket] != 0) {
+            if (identifiers[buckets[bucket] - 1] == identifiers[i]) {
+                // Identifiers listed more than once resolve to their first control.
+                is_duplicate = true;
+                break;
+            }
+            bucket = (bucket + 1) & (num_buckets - 1);
+        }
+        if (!is_duplicate) {
+            buckets[bucket] = i + 1;
+        }
+    }
+
+    std::vector<char> catalog(FILE_MAGIC, FILE_MAGIC + sizeof(FILE_MAGIC));
+    catalog.resize(HEADER_SIZE, 0);
+    const size_t controls_offset = catalog.size();
+    catalog.insert(catalog.end(), controls.begin(), controls.end());
+    const size_t outputs_offset = catalog.size();
+    catalog.insert(catalog.end(), outputs.begin(), outputs.end());
+    const size_t inputs_offset = catalog.size();
+    catalog.insert(catalog.end(), inputs.begin(), inputs.end());
+    const size_t buckets_offset = catalog.size();
+    for (const uint32_t bucket : buckets) {
+        append_fixed(catalog, bucket, 4);
+    }
+    const size_t strings_offset = catalog.size();
+    catalog.insert(catalog.end(), string_table.strings().begin(), string_table.strings().end());
+
+    write_fixed(catalog, 8, FORMAT_VERSION, 4);
+    write_fixed(catalog, 12, num_controls, 4);
+    write_fixed(catalog, 16, num_outputs, 4);
+    write_fixed(catalog, 20, num_inputs, 4);
+    write_fixed(catalog, 24, num_buckets, 4);
+    write_fixed(catalog, 28, controls_offset, 4);
+    write_fixed(catalog, 32, outputs_offset, 4);
+    write_fixed(catalog, 36, inputs_offset, 4);
+    write_fixed(catalog, 40, buckets_offset, 4);
+    write_fixed(catalog, 44, strings_offset, 4);
+    return catalog;
+}
+
+void DcsBiosControlCatalog::compile_file(const std::string &json_path, const std::string &catalog_path)
+{
+    std::ifstream json_file(json_path);
+    if (!json_file) {
+        throw std::runtime_error("Unable to open control reference: " + json_path);
+    }
+    const json control_reference = json::parse(json_file, nullptr, false);
+    if (control_reference.is_discarded()) {
+        throw std::runtime_error("Unable to parse control reference: " + json_path);
+    }
+    if (!is_control_reference(control_reference)) {
+        throw std::runtime_error("Not a control reference: " + json_path);
+    }
+
+    const std::vector<char> catalog = compile(control_reference);
+    std::ofstream catalog_file(catalog_path, std::ios::binary | std::ios::trunc);
+    if (!catalog_file.write(catalog.data(), catalog.size())) {
+        throw std::runtime_error("Unable to write control catalog: " + catalog_path);
+    }
+}
+
+DcsBiosControlCatalogReader::DcsBiosControlCatalogReader(const char *data, const size_t size) : data_(data), size_(size)
+{
+    if (size < HEADER_SIZE || std::string_view(data, sizeof(FILE_MAGIC)) !=
+                                  std::string_view(FILE_MAGIC, sizeof(FILE_MAGIC))) {
+        throw std::runtime_error("Not a DCS-BIOS control catalog");
+    }
+    if (read_fixed(data + 8, 4) != FORMAT_VERSION) {
+        throw std::runtime_error("Unsupported DCS-BIOS control catalog version");
+    }
+    num_controls_ = static_cast<uint32_t>(read_fixed(data + 12, 4));
+    num_outputs_ = static_cast<uint32_t>(read_fixed(data + 16, 4));
+    num_inputs_ = static_cast<uint32_t>(read_fixed(data + 20, 4));
+    num_buckets_ = static_cast<uint32_t>(read_fixed(data + 24, 4));
+    controls_offset_ = read_fixed(data + 28, 4);
+    outputs_offset_ = read_fixed(data + 32, 4);
+    inputs_offset_ = read_fixed(data + 36, 4);
+    buckets_offset_ = read_fixed(data + 40, 4);
+    strings_offset_ = read_fixed(data + 44, 4);
+
+    // Sections are stored in order, so each must end by the start of the next.
+    const bool sections_in_bounds =
+        controls_offset_ >= HEADER_SIZE &&
+        controls_offset_ + uint64_t{num_controls_} * CONTROL_RECORD_SIZE <= outputs_offset_ &&
+        outputs_offset_ + uint64_t{num_outputs_} * OUTPUT_RECORD_SIZE <= inputs_offset_ &&
+        inputs_offset_ + uint64_t{num_inputs_} * INPUT_RECORD_SIZE <= buckets_offset_ &&
+        buckets_offset_ + uint64_t{num_buckets_} * 4 <= strings_offset_ && strings_offset_ <= size_;
+    const bool buckets_are_power_of_two = num_buckets_ != 0 && (num_buckets_ & (num_buckets_ - 1)) == 0;
+    if (!sections_in_bounds || !buckets_are_power_of_two) {
+        throw std::runtime_error("Corrupt DCS-BIOS control catalog");
+    }
+}
+
+std::string_view DcsBiosControlCatalogReader::string_at(const size_t reference_offset) const
+{
+    const uint64_t offset = read_fixed(data_ + reference_offset, 4);
+    const uint64_t length = read_fixed(data_ + reference_offset + 4, 4);
+    if (strings_offset_ + offset + length > size_) {
+        return {};
+    }
+    return std::string_view(data_ + strings_offset_ + offset, length);
+}
+
+Control DcsBiosControlCatalogReader::control(const size_t index) const
+{
+    const size_t record = controls_offset_ + index * CONTROL_RECORD_SIZE;
+    Control control;
+    control.identifier = string_at(record);
+    control.category = string_at(record + 8);
+    control.description = string_at(record + 16);
+    control.control_type = string_at(record + 24);
+    control.first_output = static_cast<uint32_t>(read_fixed(data_ + record + 32, 4));
+    control.num_outputs = static_cast<uint32_t>(read_fixed(data_ + record + 36, 2));
+    control.num_inputs = static_cast<uint32_t>(read_fixed(data_ + record + 38, 2));
+    control.first_input = static_cast<uint32_t>(read_fixed(data_ + record + 40, 4));
+    // Ignore outputs or inputs referring beyond their section, so a corrupt record cannot be read out of bounds.
+    if (uint64_t{control.first_output} + control.num_outputs > num_outputs_) {
+        control.num_outputs = 0;
+    }
+    if (uint64_t{control.first_input} + control.num_inputs > num_inputs_) {
+        control.num_inputs = 0;
+    }
+    return control;
+}
+
+std::optional<Control> DcsBiosControlCatalogReader::find(std::string_view identifier) const
+{
+    uint32_t bucket = hash_identifier(identifier) & (num_buckets_ - 1);
+    for (uint32_t num_probes = 0; num_probes < num_buckets_; num_probes++) {
+        const auto control_number = read_fixed(data_ + buckets_offset_ + bucket * 4, 4);
+        if (control_number == 0 || control_number > num_controls_) {
+            return std::nullopt;
+        }
+        Control found = control(control_number - 1);
+        if (found.identifier == identifier) {
+            return found;
+        }
+        bucket = (bucket + 1) & (num_buckets_ - 1);
+    }
+    return std::nullopt;
+}
+
+std::optional<SimulatorAddress> DcsBiosControlCatalogReader::find_address(std::string_view identifier) const
+{
+    const auto found = find(identifier);
+    if (!found || found->num_outputs == 0) {
+        return std::nullopt;
+    }
+    return output(found.value(), 0).simulator_address();
+}
+
+Output DcsBiosControlCatalogReader::output(const Control &control, const size_t index) const
+{
+    const char *record = data_ + outputs_offset_ + (control.first_output + index) * OUTPUT_RECORD_SIZE;
+    Output output;
+    output.type = static_cast<uint8_t>(record[0]) == static_cast<uint8_t>(OutputType::STRING) ? OutputType::STRING
+                                                                                              : OutputType::INTEGER;
+    output.shift = static_cast<uint8_t>(record[1]);
+    output.address = static_cast<uint16_t>(read_fixed(record + 2, 2));
+    output.mask = static_cast<uint16_t>(read_fixed(record + 4, 2));
+    output.max_length = static_cast<uint16_t>(read_fixed(record + 6, 2));
+    output.max_value = static_cast<uint32_t>(read_fixed(record + 8, 4));
+    return output;
+}
+
+Input DcsBiosControlCatalogReader::input(const Control &control, const size_t index) const
+{
+    const size_t record = inputs_offset_ + (control.first_input + index) * INPUT_RECORD_SIZE;
+    Input input;
+    const auto interface_type = static_cast<uint8_t>(data_[record]);
+    input.interface_type = interface_type < static_cast<uint8_t>(InputInterface::UNKNOWN)
+                               ? static_cast<InputInterface>(interface_type)
+                               : InputInterface::UNKNOWN;
+    input.max_value = static_cast<uint32_t>(read_fixed(data_ + record + 4, 4));
+    input.suggested_step = static_cast<uint32_t>(read_fixed(data_ + record + 8, 4));
+    input.argument = string_at(record + 12);
+    return input;
+}
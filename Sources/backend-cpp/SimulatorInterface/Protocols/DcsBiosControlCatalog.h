@@ -0,0 +1,142 @@
+// Copyright 2026 Charles Tytler
+
+#pragma once
+
+#include "SimulatorInterface/SimulatorInterface.h"
+
+#include "nlohmann/json.hpp"
+using json = nlohmann::json;
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Binary catalog format for DCS-BIOS control references.
+ *
+ *   A catalog is compiled from an aircraft's DCS-BIOS control reference json, and holds the identifier, category,
+ *   description and type of each control with its outputs and input interfaces. It is laid out to be used in place,
+ *   e.g. from a memory-mapped file, without parsing:
+ *     [header][control records][output records][input records][hash buckets][string table]
+ *   Controls are located by identifier through an open-addressed hash table of buckets, each holding the index of a
+ *   control plus one (0 for an empty bucket). Strings are stored once in the string table and referred to by offset and
+ *   length, so repeated categories and interface arguments take no extra space.
+ *
+ *   All fixed-width fields are little-endian.
+ */
+namespace DcsBiosControlCatalog
+{
+constexpr char FILE_MAGIC[8] = {'S', 'D', 'C', 'S', 'C', 'A', 'T', '\0'};
+constexpr uint32_t FORMAT_VERSION = 1;
+constexpr size_t HEADER_SIZE = 48;         // Magic, version, record counts and section offsets.
+constexpr size_t CONTROL_RECORD_SIZE = 44; // Four string references, and first index and count of outputs and inputs.
+constexpr size_t OUTPUT_RECORD_SIZE = 12;  // Type, shift, address, mask, max length and max value.
+constexpr size_t INPUT_RECORD_SIZE = 20;   // Interface, max value, suggested step and argument string reference.
+
+enum class OutputType : uint8_t { INTEGER = 0, STRING = 1 };
+
+enum class InputInterface : uint8_t { ACTION = 0, FIXED_STEP, SET_STATE, VARIABLE_STEP, SET_STRING, UNKNOWN };
+
+struct Output {
+    OutputType type;
+    uint16_t address;
+    // Only for INTEGER:
+    uint16_t mask;
+    uint8_t shift;
+    uint32_t max_value;
+    // Only for STRING:
+    uint16_t max_length;
+
+    /**
+     * @brief Address of the output within the DCS-BIOS export stream.
+     */
+    SimulatorAddress simulator_address() const;
+};
+
+struct Input {
+    InputInterface interface_type;
+    uint32_t max_value;        // Only for SET_STATE and VARIABLE_STEP.
+    uint32_t suggested_step;   // Only for VARIABLE_STEP.
+    std::string_view argument; // Only for ACTION, the argument sent with the control identifier (e.g. "TOGGLE").
+};
+
+struct Control {
+    std::string_view identifier;
+    std::string_view category;
+    std::string_view description;
+    std::string_view control_type;
+    uint32_t first_output;
+    uint32_t num_outputs;
+    uint32_t first_input;
+    uint32_t num_inputs;
+};
+
+/**
+ * @brief Compiles a DCS-BIOS control reference into a catalog.
+ * @param control_reference Control reference json, holding an object of controls for each category.
+ * @return Catalog contents.
+ */
+std::vector<char> compile(const json &control_reference);
+
+/**
+ * @brief Compiles a DCS-BIOS control reference json file into a catalog file, overwriting any existing file.
+ * @throws std::runtime_error if the json file cannot be read or parsed or holds no controls, or the catalog file
+ *         cannot be written.
+ */
+void compile_file(const std::string &json_path, const std::string &catalog_path);
+} // namespace DcsBiosControlCatalog
+
+/**
+ * @brief Looks up controls in a catalog held in memory, such as a memory-mapped catalog file.
+ *
+ *   The reader does not copy the catalog; the memory must remain valid for the lifetime of the reader. Strings returned
+ *   by the reader also point into the catalog.
+ */
+class DcsBiosControlCatalogReader
+{
+  public:
+    /**
+     * @brief Validates the catalog header and the bounds of each section.
+     * @throws std::runtime_error if the data is not a valid catalog.
+     */
+    DcsBiosControlCatalogReader(const char *data, const size_t size);
+
+    size_t num_controls() const { return num_controls_; }
+
+    /**
+     * @brief Get a control by its position in the catalog, in the order of the control reference.
+     */
+    DcsBiosControlCatalog::Control control(const size_t index) const;
+
+    /**
+     * @brief Get a control by identifier.
+     * @return Control, or nullopt if the catalog has no control with the identifier.
+     */
+    std::optional<DcsBiosControlCatalog::Control> find(std::string_view identifier) const;
+
+    /**
+     * @brief Get the address of the first output of a control.
+     * @return Address, or nullopt if the catalog has no control with the identifier or the control has no outputs.
+     */
+    std::optional<SimulatorAddress> find_address(std::string_view identifier) const;
+
+    DcsBiosControlCatalog::Output output(const DcsBiosControlCatalog::Control &control, const size_t index) const;
+    DcsBiosControlCatalog::Input input(const DcsBiosControlCatalog::Control &control, const size_t index) const;
+
+  private:
+    std::string_view string_at(const size_t reference_offset) const;
+
+    const char *data_;
+    size_t size_;
+    uint32_t num_controls_;
+    uint32_t num_outputs_;
+    uint32_t num_inputs_;
+    uint32_t num_buckets_;
+    size_t controls_offset_;
+    size_t outputs_offset_;
+    size_t inputs_offset_;
+    size_t buckets_offset_;
+    size_t strings_offset_;
+};
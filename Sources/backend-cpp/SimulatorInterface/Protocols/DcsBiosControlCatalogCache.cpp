@@ -0,0 +1,75 @@
+// Copyright 2026 Charles Tytler
+
+#include "DcsBiosControlCatalogCache.h"
+
+#include <filesystem>
+#include <functional>
+#include <sstream>
+#include <utility>
+
+DcsBiosControlCatalogCache::DcsBiosControlCatalogCache(const std::string &cache_directory)
+    : cache_directory_(cache_directory)
+{
+}
+
+bool DcsBiosControlCatalogCache::load(const std::string &json_path)
+{
+    const std::string module = std::filesystem::path(json_path).stem().string();
+    // Catalogs of the same module in different DCS-BIOS installations are cached apart.
+    std::ostringstream catalog_name;
+    catalog_name << module << "-" << std::hex << std::hash<std::string>{}(json_path) << ".catalog";
+    const std::string catalog_path = (std::filesystem::path(cache_directory_) / catalog_name.str()).string();
+
+    std::error_code error;
+    const auto json_modified_time = std::filesystem::last_write_time(json_path, error);
+    if (error) {
+        return false;
+    }
+    const auto catalog_modified_time = std::filesystem::last_write_time(catalog_path, error);
+    const bool catalog_is_current = !error && catalog_modified_time >= json_modified_time;
+
+    std::unique_ptr<const LoadedCatalog> catalog;
+    if (catalog_is_current) {
+        try {
+            catalog = std::make_unique<const LoadedCatalog>(catalog_path);
+        } catch (const std::exception &) {
+            // Compiled by another format version, so is compiled again.
+        }
+    }
+    // Compiling reads the whole control reference, so is done without the lock and beside the loaded catalog, which
+    // is used until it is replaced.
+    const std::string compiled_catalog_path = catalog_path + ".tmp";
+    if (!catalog) {
+        try {
+            std::filesystem::create_directories(cache_directory_);
+            DcsBiosControlCatalog::compile_file(json_path, compiled_catalog_path);
+        } catch (const std::exception &) {
+            return false;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!catalog) {
+        // A mapped file cannot be replaced on Windows, so the module's loaded catalog is released first.
+        catalogs_.erase(module);
+        try {
+            std::filesystem::rename(compiled_catalog_path, catalog_path);
+            catalog = std::make_unique<const LoadedCatalog>(catalog_path);
+        } catch (const std::exception &) {
+            return false;
+        }
+    }
+    catalogs_[module] = std::move(catalog);
+    return true;
+}
+
+std::optional<SimulatorAddress> DcsBiosControlCatalogCache::find_address(const std::string &module,
+                                                                         std::string_view identifier) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto catalog = catalogs_.find(module);
+    if (catalog == catalogs_.end()) {
+        return std::nullopt;
+    }
+    return catalog->second->reader.find_address(identifier);
+}
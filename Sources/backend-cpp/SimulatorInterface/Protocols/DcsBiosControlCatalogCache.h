@@ -0,0 +1,60 @@
+// Copyright 2026 Charles Tytler
+
+#pragma once
+
+#include "SimulatorInterface/Protocols/DcsBiosControlCatalog.h"
+#include "Utilities/MappedFile.h"
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * @brief Keeps the compiled control catalog of each DCS-BIOS module loaded, to resolve control identifiers to their
+ *        addresses without reading the module's control reference json.
+ *
+ *   Catalogs are compiled once into the cache directory and memory-mapped from there, and are only compiled again when
+ *   the control reference json is modified (e.g. by updating DCS-BIOS). Modules are named as by the Property
+ *   Inspector, by the stem of their control reference json file.
+ *
+ *   The cache may be used from multiple threads.
+ */
+class DcsBiosControlCatalogCache
+{
+  public:
+    /**
+     * @brief Construct a cache which stores its catalogs in the directory, created when the first catalog is compiled.
+     */
+    explicit DcsBiosControlCatalogCache(const std::string &cache_directory);
+
+    /**
+     * @brief Loads the catalog of a control reference json file, compiling it if the cached catalog is missing or
+     *        older than the json file. Replaces any catalog loaded for the same module.
+     * @return True if the catalog is loaded.
+     */
+    bool load(const std::string &json_path);
+
+    /**
+     * @brief Get the address of the first output of a control in the loaded catalog of a module.
+     * @return Address, or nullopt if no catalog of the module is loaded or it has no such control with outputs.
+     */
+    std::optional<SimulatorAddress> find_address(const std::string &module, std::string_view identifier) const;
+
+  private:
+    struct LoadedCatalog {
+        explicit LoadedCatalog(const std::string &catalog_path)
+            : file(catalog_path), reader(file.data(), file.size())
+        {
+        }
+
+        MappedFile file;
+        DcsBiosControlCatalogReader reader;
+    };
+
+    std::string cache_directory_;
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, std::unique_ptr<const LoadedCatalog>> catalogs_; // By module.
+};
@@ -0,0 +1,137 @@
+// Copyright 2026 Charles Tytler
+
+#include "DcsBiosDecoderTable.h"
+
+#include <algorithm>
+
+void DcsBiosDecoderTable::clear()
+{
+    for (auto &field : fields_) {
+        for (auto &subscriber : field.subscribers) {
+            subscriber->subscribed = false;
+        }
+    }
+    fields_.clear();
+    field_indices_by_address_.clear();
+    field_index_by_subscriber_.clear();
+}
+
+std::shared_ptr<DecodedField> DcsBiosDecoderTable::add_field(const SimulatorAddress &address,
+                                                             const DcsBiosStateStore &data_by_address)
+{
+    auto &field_indices = field_indices_by_address_[address.address];
+    Field *field = nullptr;
+    uint32_t field_index = 0;
+    for (const auto index : field_indices) {
+        if (fields_[index].mask == address.mask && fields_[index].shift == address.shift) {
+            field = &fields_[index];
+            field_index = index;
+            break;
+        }
+    }
+    if (field == nullptr) {
+        field_index = static_cast<uint32_t>(fields_.size());
+        field_indices.push_back(field_index);
+        fields_.push_back({address.address, address.mask, address.shift, std::nullopt, {}});
+        field = &fields_.back();
+        decode(*field, data_by_address);
+    }
+
+    auto subscriber = std::make_shared<DecodedField>();
+    subscriber->value = field->value;
+    field->subscribers.push_back(subscriber);
+    field_index_by_subscriber_[subscriber.get()] = field_index;
+    return subscriber;
+}
+
+void DcsBiosDecoderTable::remove_subscriber(const std::shared_ptr<DecodedField> &subscriber)
+{
+    const auto found = field_index_by_subscriber_.find(subscriber.get());
+    if (found == field_index_by_subscriber_.end()) {
+        return;
+    }
+    const uint32_t index = found->second;
+    field_index_by_subscriber_.erase(found);
+    auto &subscribers = fields_[index].subscribers;
+    subscribers.erase(std::find(subscribers.begin(), subscribers.end(), subscriber));
+    subscriber->subscribed = false;
+    if (subscribers.empty()) {
+        remove_field(index);
+    }
+}
+
+void DcsBiosDecoderTable::remove_field(const uint32_t index)
+{
+    const auto remove_index = [this](const unsigned int address, const uint32_t field_index) {
+        auto &field_indices = field_indices_by_address_[address];
+        field_indices.erase(std::find(field_indices.begin(), field_indices.end(), field_index));
+        return &field_indices;
+    };
+    if (remove_index(fields_[index].address, index)->empty()) {
+        field_indices_by_address_.erase(fields_[index].address);
+    }
+
+    const auto last = static_cast<uint32_t>(fields_.size() - 1);
+    if (index != last) {
+        // The last field takes the place of the removed one, so every reference to its index is updated.
+        remove_index(fields_[last].address, last)->push_back(index);
+        for (const auto &subscriber : fields_[last].subscribers) {
+            field_index_by_subscriber_[subscriber.get()] = index;
+        }
+        fields_[index] = std::move(fields_[last]);
+    }
+    fields_.pop_back();
+}
+
+void DcsBiosDecoderTable::decode_addresses(const std::vector<unsigned int> &addresses,
+                                           const DcsBiosStateStore &data_by_address)
+{
+    if (fields_.empty()) {
+        return;
+    }
+    for (const auto address : addresses) {
+        const auto field_indices = field_indices_by_address_.find(address);
+        if (field_indices != field_indices_by_address_.end()) {
+            for (const auto index : field_indices->second) {
+                decode(fields_[index], data_by_address);
+            }
+        }
+    }
+}
+
+void DcsBiosDecoderTable::decode_all(const DcsBiosStateStore &data_by_address)
+{
+    for (auto &field : fields_) {
+        decode(field, data_by_address);
+    }
+}
+
+void DcsBiosDecoderTable::invalidate_values()
+{
+    for (auto &field : fields_) {
+        push_value(field, std::nullopt);
+    }
+}
+
+void DcsBiosDecoderTable::decode(Field &field, const DcsBiosStateStore &data_by_address)
+{
+    const auto data = data_by_address.get(field.address);
+    if (data) {
+        push_value(field, (data.value() & field.mask) >> field.shift);
+    } else {
+        push_value(field, std::nullopt);
+    }
+}
+
+void DcsBiosDecoderTable::push_value(Field &field, const std::optional<unsigned int> value)
+{
+    // A changed word often leaves most of the fields packed in it unchanged, which are not pushed to subscribers.
+    if (value == field.value) {
+        return;
+    }
+    field.value = value;
+    for (auto &subscriber : field.subscribers) {
+        subscriber->value = value;
+        subscriber->changed = true;
+    }
+}
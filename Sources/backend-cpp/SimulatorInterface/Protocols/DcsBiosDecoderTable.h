@@ -0,0 +1,89 @@
+// Copyright 2026 Charles Tytler
+
+#pragma once
+
+#include "SimulatorInterface/Protocols/DcsBiosStateStore.h"
+#include "SimulatorInterface/SimulatorInterface.h"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Decodes subscribed DCS-BIOS integer fields only when the 16-bit word they are packed in changes, pushing each
+ *        changed value to the subscribers of the field.
+ *
+ *   Many DCS-BIOS controls share a single word, each selected by its own mask and shift. Rather than each consumer
+ *   looking up and masking the word every time it is polled, fields are subscribed to once and the table fans out each
+ *   changed word to the fields packed within it. Fields with identical address, mask and shift are decoded once for
+ *   all of their subscribers.
+ */
+class DcsBiosDecoderTable
+{
+  public:
+    DcsBiosDecoderTable() = default;
+
+    /**
+     * @brief Removes all fields, marking each of their subscriptions as no longer subscribed.
+     */
+    void clear();
+
+    /**
+     * @brief Subscribes to an INTEGER field, decoding its initial value from the current game state.
+     * @param address Address, mask and shift of the field.
+     * @param data_by_address Current game state by address.
+     * @return Subscription the field's value is pushed to.
+     */
+    std::shared_ptr<DecodedField> add_field(const SimulatorAddress &address,
+                                            const DcsBiosStateStore &data_by_address);
+
+    /**
+     * @brief Unsubscribes from a field, marking the subscription as no longer subscribed. A field is removed along with
+     *        its last subscriber. Subscriptions not made through this table are ignored.
+     */
+    void remove_subscriber(const std::shared_ptr<DecodedField> &subscriber);
+
+    /**
+     * @brief Re-decodes the fields packed in each of the listed addresses.
+     */
+    void decode_addresses(const std::vector<unsigned int> &addresses,
+                          const DcsBiosStateStore &data_by_address);
+
+    /**
+     * @brief Re-decodes all fields, e.g. after the game state has been replaced.
+     */
+    void decode_all(const DcsBiosStateStore &data_by_address);
+
+    /**
+     * @brief Pushes no value to all fields while keeping their subscriptions.
+     */
+    void invalidate_values();
+
+    /**
+     * @brief Number of distinct subscribed fields.
+     */
+    size_t num_fields() const { return fields_.size(); }
+
+  private:
+    struct Field {
+        unsigned int address;
+        unsigned int mask;
+        uint8_t shift;
+        std::optional<unsigned int> value;
+        std::vector<std::shared_ptr<DecodedField>> subscribers;
+    };
+
+    void decode(Field &field, const DcsBiosStateStore &data_by_address);
+    void push_value(Field &field, const std::optional<unsigned int> value);
+
+    /**
+     * @brief Removes a field by moving the last field into its place.
+     */
+    void remove_field(const uint32_t index);
+
+    std::vector<Field> fields_;
+    std::unordered_map<unsigned int, std::vector<uint32_t>> field_indices_by_address_; // Fan-out from each word.
+    std::unordered_map<const DecodedField *, uint32_t> field_index_by_subscriber_;
+};
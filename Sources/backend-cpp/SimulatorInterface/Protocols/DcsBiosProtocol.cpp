@@ -12,60 +12,63 @@ DcsBiosProtocol::DcsBiosProtocol(const SimulatorConnectionSettings &settings) :
 
 void DcsBiosProtocol::update_simulator_state()
 {
-    constexpr int MAX_UDP_MSG_SIZE = 1024; // Maximum UDP buffer size to read.
-    char message_buffer[MAX_UDP_MSG_SIZE];
-    const int message_size = simulator_socket_.receive_bytes(message_buffer, MAX_UDP_MSG_SIZE);
+    if (simulator_socket_) {
+        const auto datagram = simulator_socket_->receive_datagram();
+        handle_datagram(datagram.data(), datagram.size());
+    }
+}
+
+void DcsBiosProtocol::handle_datagram(const char *data, const size_t size)
+{
+    addresses_changed_in_most_recent_update_.clear();
+    size_t num_changed_addresses_handled = 0;
     // Read byte by byte.
-    for (int i = 0; i < message_size; i++) {
-        protocol_parser_.processByte(message_buffer[i], current_game_state_by_address_);
+    for (size_t i = 0; i < size; i++) {
+        protocol_parser_.processByte(
+            data[i], current_game_state_by_address_, &addresses_changed_in_most_recent_update_);
         if (protocol_parser_.at_end_of_frame()) {
-            monitor_for_module_change();
+            // Cached strings must be current before the aircraft name is read.
+            handle_changed_addresses(num_changed_addresses_handled);
+            num_changed_addresses_handled = addresses_changed_in_most_recent_update_.size();
+            if (aircraft_name_changed_) {
+                monitor_for_module_change();
+                aircraft_name_changed_ = false;
+            }
         }
     }
+    handle_changed_addresses(num_changed_addresses_handled);
+    decoder_table_.decode_addresses(addresses_changed_in_most_recent_update_, current_game_state_by_address_);
 }
 
 void DcsBiosProtocol::send_command(const std::string &control_reference, const std::string &value)
 {
     const std::string message_assembly = control_reference + " " + value + "\n";
-    simulator_socket_.send_string(message_assembly);
+    send_to_simulator(message_assembly);
 }
 
-void DcsBiosProtocol::send_reset_command() { simulator_socket_.send_string("SYNC E\n"); }
+void DcsBiosProtocol::send_reset_command() { send_to_simulator("SYNC E\n"); }
 
 std::optional<std::string> DcsBiosProtocol::get_string_at_addr(const SimulatorAddress &address) const
 {
-    const bool data_exists_at_start_address = current_game_state_by_address_.count(address.address) > 0;
-    if (address.type == AddressType::ADDRESS_ONLY || !data_exists_at_start_address) {
-        return std::nullopt;
-    }
-
-    if (address.type == AddressType::INTEGER) {
-        return std::to_string((current_game_state_by_address_.at(address.address) & address.mask) >> address.shift);
+    const auto maybe_value = get_string_view_at_addr(address);
+    if (maybe_value) {
+        return std::string(maybe_value.value());
     }
+    return std::nullopt;
+}
 
-    std::string assembled_string = "";
-    for (unsigned int loc = address.address; loc < address.address + address.max_length; loc += 2) {
-        if (current_game_state_by_address_.count(loc) > 0) {
-            // Convert 16-bit data at current location to 2 characters.
-            char characters[2];
-            memcpy(characters, &current_game_state_by_address_.at(loc), sizeof(characters));
-            // Append characters to string, returning early if encountering a null character.
-            for (char character : characters) {
-                if (character == '\0') {
-                    return assembled_string;
-                } else {
-                    assembled_string += character;
-                }
-            }
-        }
-    }
-    return assembled_string;
+std::optional<std::string_view> DcsBiosProtocol::get_string_view_at_addr(const SimulatorAddress &address) const
+{
+    return string_cache_.get(address, current_game_state_by_address_);
 }
 
 std::optional<Decimal> DcsBiosProtocol::get_value_at_addr(const SimulatorAddress &address) const
 {
-    if (address.type == AddressType::INTEGER && current_game_state_by_address_.count(address.address) > 0) {
-        return Decimal((current_game_state_by_address_.at(address.address) & address.mask) >> address.shift);
+    if (address.type == AddressType::INTEGER) {
+        const auto data = current_game_state_by_address_.get(address.address);
+        if (data) {
+            return Decimal((data.value() & address.mask) >> address.shift);
+        }
     }
     return std::nullopt;
 }
@@ -73,27 +76,63 @@ std::optional<Decimal> DcsBiosProtocol::get_value_at_addr(const SimulatorAddress
 void DcsBiosProtocol::clear_game_state()
 {
     current_game_state_by_address_.clear();
+    string_cache_.mark_all_dirty();
+    decoder_table_.invalidate_values();
     current_module_ = "";
 }
 
+void DcsBiosProtocol::clear_decoded_fields() { decoder_table_.clear(); }
+
+std::shared_ptr<DecodedField> DcsBiosProtocol::subscribe_decoded_field(const SimulatorAddress &address)
+{
+    if (address.type != AddressType::INTEGER) {
+        return nullptr;
+    }
+    return decoder_table_.add_field(address, current_game_state_by_address_);
+}
+
+void DcsBiosProtocol::unsubscribe_decoded_field(const std::shared_ptr<DecodedField> &field)
+{
+    decoder_table_.remove_subscriber(field);
+}
+
 json DcsBiosProtocol::get_current_state_as_json() const
 {
     json current_game_state_printout;
-    for (const auto &[key, value] : current_game_state_by_address_) {
-        current_game_state_printout[std::to_string(key)] = value;
-    }
+    current_game_state_by_address_.for_each([&current_game_state_printout](unsigned int address, unsigned int data) {
+        current_game_state_printout[std::to_string(address)] = data;
+    });
     return current_game_state_printout;
 }
 
+void DcsBiosProtocol::handle_changed_addresses(const size_t first)
+{
+    string_cache_.mark_dirty(addresses_changed_in_most_recent_update_, first);
+    const unsigned int name_start = ACFT_NAME_ADDRESS_.address;
+    const unsigned int name_end = ACFT_NAME_ADDRESS_.address + ACFT_NAME_ADDRESS_.max_length;
+    for (size_t i = first; i < addresses_changed_in_most_recent_update_.size(); i++) {
+        const unsigned int address = addresses_changed_in_most_recent_update_[i];
+        if (address >= name_start && address < name_end) {
+            aircraft_name_changed_ = true;
+            break;
+        }
+    }
+}
+
 void DcsBiosProtocol::monitor_for_module_change()
 {
-    const auto maybe_aircraft_name = get_string_at_addr(ACFT_NAME_ADDRESS_);
+    const auto maybe_aircraft_name = get_string_view_at_addr(ACFT_NAME_ADDRESS_);
     if (maybe_aircraft_name) {
         if (maybe_aircraft_name.value() != current_module_) {
             // Clear game state when and reset to only data received in the most recent frame when new active aircraft
             // module is detected.
-            current_game_state_by_address_ = protocol_parser_.get_data_by_address_updated_this_frame();
             current_module_ = maybe_aircraft_name.value();
+            current_game_state_by_address_.clear();
+            for (const auto &[address, data] : protocol_parser_.get_words_updated_this_frame()) {
+                current_game_state_by_address_.set(address, data);
+            }
+            string_cache_.mark_all_dirty();
+            decoder_table_.decode_all(current_game_state_by_address_);
         }
     }
-}
\ No newline at end of file
+}
@@ -2,7 +2,10 @@
 
 #pragma once
 
+#include "SimulatorInterface/Protocols/DcsBiosDecoderTable.h"
+#include "SimulatorInterface/Protocols/DcsBiosStateStore.h"
 #include "SimulatorInterface/Protocols/DcsBiosStreamParser.h"
+#include "SimulatorInterface/Protocols/DcsBiosStringCache.h"
 #include "SimulatorInterface/SimulatorInterface.h"
 
 class DcsBiosProtocol : public SimulatorInterface
@@ -12,19 +15,38 @@ class DcsBiosProtocol : public SimulatorInterface
 
     void update_simulator_state();
 
+    /**
+     * @brief Updates the game state from a single datagram of DCS-BIOS export data.
+     */
+    void handle_datagram(const char *data, const size_t size);
+
     void send_command(const std::string &control_reference, const std::string &value);
 
     void send_reset_command();
 
     std::optional<std::string> get_string_at_addr(const SimulatorAddress &address) const;
 
+    std::optional<std::string_view> get_string_view_at_addr(const SimulatorAddress &address) const;
+
     std::optional<Decimal> get_value_at_addr(const SimulatorAddress &address) const;
 
     void clear_game_state();
 
+    void clear_decoded_fields();
+
+    std::shared_ptr<DecodedField> subscribe_decoded_field(const SimulatorAddress &address);
+
+    void unsubscribe_decoded_field(const std::shared_ptr<DecodedField> &field);
+
     json get_current_state_as_json() const;
 
   private:
+    /**
+     * @brief Marks cached strings dirty and flags changes of the aircraft name, for each address changed in the most
+     *        recent update from the given index onwards.
+     */
+    void handle_changed_addresses(const size_t first);
+
     /**
      * @brief Monitors and sets the current game module (aircraft name) from received data
      */
@@ -32,9 +54,16 @@ class DcsBiosProtocol : public SimulatorInterface
 
     DcsBiosStreamParser protocol_parser_;
 
-    // Maps received data to associated addresses.
-    std::unordered_map<unsigned int, unsigned int> current_game_state_by_address_;
-    std::vector<unsigned int> addresses_read_in_most_recent_frame_;
+    // Stores received data by address.
+    DcsBiosStateStore current_game_state_by_address_;
+    std::vector<unsigned int> addresses_changed_in_most_recent_update_;
+    bool aircraft_name_changed_ = false; // Set when the aircraft name data changes, until the end of the frame.
+
+    // Assembled strings, re-assembled on request only after the addresses they span change.
+    mutable DcsBiosStringCache string_cache_;
+
+    // Subscribed integer fields, decoded only when the address they are packed in changes.
+    DcsBiosDecoderTable decoder_table_;
 
     // Default location of ACFT_NAME defined by MetaDataStart category of DCS BIOS json files.
     const SimulatorAddress ACFT_NAME_ADDRESS_{0x0000, 24};
@@ -0,0 +1,33 @@
+// Copyright 2026 Charles Tytler
+
+#include "DcsBiosStateStore.h"
+
+#include <algorithm>
+
+DcsBiosStateStore::DcsBiosStateStore() : data_(ADDRESS_SPACE_SIZE, 0), valid_bits_(ADDRESS_SPACE_SIZE / 64, 0) {}
+
+bool DcsBiosStateStore::set(const unsigned int address, const unsigned int data)
+{
+    if (address >= ADDRESS_SPACE_SIZE) {
+        return false;
+    }
+    uint64_t &block = valid_bits_[address / 64];
+    const uint64_t bit = uint64_t{1} << (address % 64);
+    const auto word = static_cast<uint16_t>(data);
+    if ((block & bit) == 0) {
+        block |= bit;
+        num_valid_++;
+    } else if (data_[address] == word) {
+        return false;
+    }
+    data_[address] = word;
+    return true;
+}
+
+void DcsBiosStateStore::clear()
+{
+    if (num_valid_ > 0) {
+        std::fill(valid_bits_.begin(), valid_bits_.end(), 0);
+        num_valid_ = 0;
+    }
+}
@@ -0,0 +1,81 @@
+// Copyright 2026 Charles Tytler
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+/**
+ * @brief Stores the most recently received 16-bit DCS-BIOS data word at each address.
+ *
+ *   DCS-BIOS addresses span a fixed 16-bit range, so words are held in a flat array indexed by address alongside a
+ *   bitset marking which addresses hold received data. Clearing the store only resets the validity bits, so the state
+ *   can be reset on each change of aircraft module without freeing or reallocating its storage.
+ */
+class DcsBiosStateStore
+{
+  public:
+    static constexpr unsigned int ADDRESS_SPACE_SIZE = 0x10000; // Number of addressable locations.
+
+    DcsBiosStateStore();
+
+    /**
+     * @brief Stores the data received at an address.
+     * @param address DCS-BIOS address, ignored if outside of the address space.
+     * @param data    16-bit data word.
+     * @return True if the address had no data or its data changed.
+     */
+    bool set(const unsigned int address, const unsigned int data);
+
+    /**
+     * @brief Get the data stored at an address, or nullopt if no data has been received.
+     */
+    std::optional<unsigned int> get(const unsigned int address) const
+    {
+        if (!contains(address)) {
+            return std::nullopt;
+        }
+        return data_[address];
+    }
+
+    /**
+     * @brief Returns true if data has been received at the address.
+     */
+    bool contains(const unsigned int address) const
+    {
+        return (address < ADDRESS_SPACE_SIZE) && ((valid_bits_[address / 64] >> (address % 64)) & 1u);
+    }
+
+    /**
+     * @brief Marks all addresses as having no data, keeping storage allocated.
+     */
+    void clear();
+
+    /**
+     * @brief Number of addresses with stored data.
+     */
+    size_t size() const { return num_valid_; }
+
+    /**
+     * @brief Calls func(address, data) for each address with stored data, in order of address.
+     */
+    template <typename Func> void for_each(Func &&func) const
+    {
+        for (unsigned int block = 0; block < valid_bits_.size(); block++) {
+            if (valid_bits_[block] == 0) {
+                continue;
+            }
+            for (unsigned int address = block * 64; address < (block + 1) * 64; address++) {
+                if (contains(address)) {
+                    func(address, static_cast<unsigned int>(data_[address]));
+                }
+            }
+        }
+    }
+
+  private:
+    std::vector<uint16_t> data_;       // Data word at each address.
+    std::vector<uint64_t> valid_bits_; // Bit set for each address which holds received data.
+    size_t num_valid_ = 0;
+};
@@ -16,17 +16,40 @@
 
 #include "DcsBiosStreamParser.h"
 
+namespace
+{
+// Store the data word at an address, returning true if it is new or has changed.
+bool store_data(std::unordered_map<unsigned int, unsigned int> &data_by_address,
+                unsigned int address,
+                unsigned int data)
+{
+    const auto [entry, inserted] = data_by_address.try_emplace(address, data);
+    if (inserted || entry->second != data) {
+        entry->second = data;
+        return true;
+    }
+    return false;
+}
+
+bool store_data(DcsBiosStateStore &data_by_address, unsigned int address, unsigned int data)
+{
+    return data_by_address.set(address, data);
+}
+} // namespace
+
 DcsBiosStreamParser::DcsBiosStreamParser()
 {
     _state = DcsBiosState::WAIT_FOR_SYNC;
     _sync_byte_count = 0;
+    _words_in_current_frame.reserve(MAX_NUM_ADDRESSES_STORED_PER_FRAME);
 }
 
-void DcsBiosStreamParser::processByte(uint8_t c, std::unordered_map<unsigned int, unsigned int> &data_by_address)
+template <typename DataStore>
+void DcsBiosStreamParser::process(uint8_t c, DataStore &data_by_address, std::vector<unsigned int> *changed_addresses)
 {
     // Reset if last byte processed was at end of frame.
     if (_at_end_of_frame) {
-        _data_by_address_in_current_frame.clear();
+        _words_in_current_frame.clear();
         _at_end_of_frame = false;
     }
 
@@ -68,7 +91,13 @@ void DcsBiosStreamParser::processByte(uint8_t c, std::unordered_map<unsigned int
     case DcsBiosState::DATA_HIGH:
         _data = (c << 8u) | _data;
         _count--;
-        fill_data_by_address(data_by_address);
+        if (store_data(data_by_address, _address, _data) && changed_addresses != nullptr) {
+            changed_addresses->push_back(_address);
+        }
+        // Limit size of stored addresses to prevent excessive memory usage if end of frame detection is failing.
+        if (_words_in_current_frame.size() < MAX_NUM_ADDRESSES_STORED_PER_FRAME) {
+            _words_in_current_frame.emplace_back(_address, _data);
+        }
         if (_count == 0) {
             _state = DcsBiosState::ADDRESS_LOW;
 
@@ -96,11 +125,25 @@ void DcsBiosStreamParser::processByte(uint8_t c, std::unordered_map<unsigned int
     }
 }
 
-void DcsBiosStreamParser::fill_data_by_address(std::unordered_map<unsigned int, unsigned int> &data_by_address)
+void DcsBiosStreamParser::processByte(uint8_t c,
+                                      std::unordered_map<unsigned int, unsigned int> &data_by_address,
+                                      std::vector<unsigned int> *changed_addresses)
+{
+    process(c, data_by_address, changed_addresses);
+}
+
+void DcsBiosStreamParser::processByte(uint8_t c,
+                                      DcsBiosStateStore &data_by_address,
+                                      std::vector<unsigned int> *changed_addresses)
 {
-    data_by_address[_address] = _data;
-    // Limit size of stored addresses to prevent excessive memory usage if end of frame detection is failing.
-    if (_data_by_address_in_current_frame.size() < MAX_NUM_ADDRESSES_STORED_PER_FRAME) {
-        _data_by_address_in_current_frame[_address] = _data;
+    process(c, data_by_address, changed_addresses);
+}
+
+std::unordered_map<unsigned int, unsigned int> DcsBiosStreamParser::get_data_by_address_updated_this_frame() const
+{
+    std::unordered_map<unsigned int, unsigned int> data_by_address;
+    for (const auto &[address, data] : _words_in_current_frame) {
+        data_by_address[address] = data;
     }
-}
\ No newline at end of file
+    return data_by_address;
+}
@@ -16,7 +16,12 @@
 
 #pragma once
 
+#include "SimulatorInterface/Protocols/DcsBiosStateStore.h"
+
+#include <cstdint>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 class DcsBiosStreamParser
 {
@@ -27,8 +32,14 @@ class DcsBiosStreamParser
      * @brief Processes a single byte from the export stream at a time, populating data by address.
      * @param [in] c Single byte of DCS BIOS export stream.
      * @param [in,out] data_by_address Map to populate data by address as full address contents are received.
+     * @param [out] changed_addresses Optional list appended with each address whose data is new or has changed.
      */
-    void processByte(uint8_t c, std::unordered_map<unsigned int, unsigned int> &data_by_address);
+    void processByte(uint8_t c,
+                     std::unordered_map<unsigned int, unsigned int> &data_by_address,
+                     std::vector<unsigned int> *changed_addresses = nullptr);
+    void processByte(uint8_t c,
+                     DcsBiosStateStore &data_by_address,
+                     std::vector<unsigned int> *changed_addresses = nullptr);
 
     /**
      * @brief Returns true if most recently processed byte was the end of frame.
@@ -38,13 +49,19 @@ class DcsBiosStreamParser
     /**
      * @brief Get a list of addresses updated this frame.
      */
-    std::unordered_map<unsigned int, unsigned int> get_data_by_address_updated_this_frame()
+    std::unordered_map<unsigned int, unsigned int> get_data_by_address_updated_this_frame() const;
+
+    /**
+     * @brief Get the address and data of each word received this frame, in order of receipt.
+     */
+    const std::vector<std::pair<unsigned int, unsigned int>> &get_words_updated_this_frame() const
     {
-        return _data_by_address_in_current_frame;
-    };
+        return _words_in_current_frame;
+    }
 
   private:
-    void fill_data_by_address(std::unordered_map<unsigned int, unsigned int> &data_by_address);
+    template <typename DataStore>
+    void process(uint8_t c, DataStore &data_by_address, std::vector<unsigned int> *changed_addresses);
 
     // State machine states for parsing protocol.
     enum class DcsBiosState { WAIT_FOR_SYNC, ADDRESS_LOW, ADDRESS_HIGH, COUNT_LOW, COUNT_HIGH, DATA_LOW, DATA_HIGH };
@@ -55,6 +72,6 @@ class DcsBiosStreamParser
     unsigned char _sync_byte_count;
     bool _at_end_of_frame = false;
 
-    std::unordered_map<unsigned int, unsigned int> _data_by_address_in_current_frame;
+    std::vector<std::pair<unsigned int, unsigned int>> _words_in_current_frame;
     const size_t MAX_NUM_ADDRESSES_STORED_PER_FRAME = 1024;
 };
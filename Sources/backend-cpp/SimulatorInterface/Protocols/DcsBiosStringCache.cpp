@@ -0,0 +1,105 @@
+// Copyright 2026 Charles Tytler
+
+#include "DcsBiosStringCache.h"
+
+#include <cstring>
+
+std::optional<std::string_view>
+DcsBiosStringCache::get(const SimulatorAddress &address,
+                        const DcsBiosStateStore &data_by_address)
+{
+    if (address.type == AddressType::ADDRESS_ONLY) {
+        return std::nullopt;
+    }
+
+    const uint64_t key = key_of(address);
+    auto entry_index = entry_index_by_key_.find(key);
+    if (entry_index == entry_index_by_key_.end()) {
+        const auto new_index = static_cast<uint32_t>(entries_.size());
+        entries_.push_back({address, {}, false, true});
+        if (address.type == AddressType::STRING) {
+            entries_.back().value.reserve(address.max_length + 1);
+            for (unsigned int loc = address.address; loc < address.address + address.max_length; loc += 2) {
+                entry_indices_by_address_[loc].push_back(new_index);
+            }
+        } else {
+            entry_indices_by_address_[address.address].push_back(new_index);
+        }
+        entry_index = entry_index_by_key_.emplace(key, new_index).first;
+    }
+
+    Entry &entry = entries_[entry_index->second];
+    if (entry.dirty) {
+        assemble(entry, data_by_address);
+        entry.dirty = false;
+    }
+    if (!entry.has_value) {
+        return std::nullopt;
+    }
+    return std::string_view(entry.value);
+}
+
+void DcsBiosStringCache::mark_dirty(const std::vector<unsigned int> &addresses, const size_t first)
+{
+    if (entries_.empty()) {
+        return;
+    }
+    for (size_t i = first; i < addresses.size(); i++) {
+        const auto entry_indices = entry_indices_by_address_.find(addresses[i]);
+        if (entry_indices != entry_indices_by_address_.end()) {
+            for (const auto index : entry_indices->second) {
+                entries_[index].dirty = true;
+            }
+        }
+    }
+}
+
+void DcsBiosStringCache::mark_all_dirty()
+{
+    for (auto &entry : entries_) {
+        entry.dirty = true;
+    }
+}
+
+uint64_t DcsBiosStringCache::key_of(const SimulatorAddress &address)
+{
+    // Addresses are 16-bit, so the type and its parameters can be packed alongside without collision.
+    const uint64_t parameters = (address.type == AddressType::INTEGER)
+                                    ? ((static_cast<uint64_t>(address.mask) << 8) | address.shift)
+                                    : address.max_length;
+    return (static_cast<uint64_t>(address.type) << 60) | (static_cast<uint64_t>(address.address) << 40) | parameters;
+}
+
+void DcsBiosStringCache::assemble(Entry &entry, const DcsBiosStateStore &data_by_address)
+{
+    const SimulatorAddress &address = entry.address;
+    const auto start_data = data_by_address.get(address.address);
+    entry.has_value = start_data.has_value();
+    if (!entry.has_value) {
+        entry.value.clear();
+        return;
+    }
+
+    if (address.type == AddressType::INTEGER) {
+        entry.value = std::to_string((start_data.value() & address.mask) >> address.shift);
+        return;
+    }
+
+    // Copy the characters of each received word into a contiguous buffer (skipping words not yet received), then find
+    // the string terminator with a single memchr, which the C runtime vectorises.
+    entry.value.resize(address.max_length + 1);
+    char *characters = entry.value.data();
+    size_t length = 0;
+    for (unsigned int loc = address.address; loc < address.address + address.max_length; loc += 2) {
+        const auto data = data_by_address.get(loc);
+        if (data) {
+            characters[length++] = static_cast<char>(data.value() & 0xFF);
+            characters[length++] = static_cast<char>((data.value() >> 8) & 0xFF);
+        }
+    }
+    const void *terminator = memchr(characters, '\0', length);
+    if (terminator != nullptr) {
+        length = static_cast<const char *>(terminator) - characters;
+    }
+    entry.value.resize(length);
+}
@@ -0,0 +1,69 @@
+// Copyright 2026 Charles Tytler
+
+#pragma once
+
+#include "SimulatorInterface/Protocols/DcsBiosStateStore.h"
+#include "SimulatorInterface/SimulatorInterface.h"
+
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Caches the string representation of DCS-BIOS addresses, re-assembling each string only when one of the
+ *        16-bit words in its range has changed.
+ *
+ *   An entry is created for each distinct address on first request. Entries hold a buffer sized to the maximum length
+ *   of the string, so re-assembling a string after its words change does not allocate.
+ */
+class DcsBiosStringCache
+{
+  public:
+    DcsBiosStringCache() = default;
+
+    /**
+     * @brief Get the string value at an address, re-assembling it from the game state only if it is dirty.
+     * @param address STRING or INTEGER address to read.
+     * @param data_by_address Current game state by address.
+     * @return View of the cached string, valid until the entry is next marked dirty, or nullopt if no data has been
+     * received at the start address.
+     */
+    std::optional<std::string_view> get(const SimulatorAddress &address,
+                                        const DcsBiosStateStore &data_by_address);
+
+    /**
+     * @brief Marks cached strings which include any of the listed addresses as needing to be re-assembled.
+     * @param addresses Changed addresses.
+     * @param first Index of the first address in the list to process.
+     */
+    void mark_dirty(const std::vector<unsigned int> &addresses, const size_t first = 0);
+
+    /**
+     * @brief Marks all cached strings as needing to be re-assembled, e.g. after the game state has been replaced.
+     */
+    void mark_all_dirty();
+
+    /**
+     * @brief Number of distinct addresses with a cached string.
+     */
+    size_t num_entries() const { return entries_.size(); }
+
+  private:
+    struct Entry {
+        SimulatorAddress address;
+        std::string value;
+        bool has_value = false;
+        bool dirty = true;
+    };
+
+    static uint64_t key_of(const SimulatorAddress &address);
+    void assemble(Entry &entry, const DcsBiosStateStore &data_by_address);
+
+    std::deque<Entry> entries_; // Deque keeps returned views valid as entries are added.
+    std::unordered_map<uint64_t, uint32_t> entry_index_by_key_;
+    std::unordered_map<unsigned int, std::vector<uint32_t>> entry_indices_by_address_; // Entries covering each word.
+};
@@ -4,6 +4,35 @@
 
 #include "Utilities/StringUtilities.h"
 
+#include <cctype>
+#include <charconv>
+
+namespace
+{
+/**
+ * @brief Parses an object ID key in place, accepting the same keys as is_integer and std::stoi: leading whitespace, an
+ *        optional sign and trailing spaces around the digits.
+ */
+std::optional<int> parse_object_id(std::string_view key)
+{
+    while (!key.empty() && std::isspace(static_cast<unsigned char>(key.front()))) {
+        key.remove_prefix(1);
+    }
+    while (!key.empty() && key.back() == ' ') {
+        key.remove_suffix(1);
+    }
+    if (key.size() > 1 && key.front() == '+' && key[1] != '-') {
+        key.remove_prefix(1); // Not accepted by from_chars.
+    }
+    int id = 0;
+    const auto [key_end, key_error] = std::from_chars(key.data(), key.data() + key.size(), id);
+    if (key.empty() || key_error != std::errc() || key_end != key.data() + key.size()) {
+        return std::nullopt;
+    }
+    return id;
+}
+} // namespace
+
 DcsExportScriptProtocol::DcsExportScriptProtocol(const SimulatorConnectionSettings &settings)
     : SimulatorInterface(settings)
 {
@@ -13,20 +42,32 @@ DcsExportScriptProtocol::DcsExportScriptProtocol(const SimulatorConnectionSettin
 
 void DcsExportScriptProtocol::update_simulator_state()
 {
-    // Receive next UDP message from simulator and strip header.
+    // Receive next UDP message from simulator.
+    if (simulator_socket_) {
+        const auto datagram = simulator_socket_->receive_datagram();
+        handle_datagram(datagram.data(), datagram.size());
+    }
+}
+
+void DcsExportScriptProtocol::handle_datagram(const char *data, const size_t size)
+{
+    // Tokens are read in place as views into the datagram, without copying.
+    std::string_view recv_msg(data, size);
+    if (recv_msg.empty()) {
+        return;
+    }
+
+    // Strip header from message.
     const char header_delimiter = '*'; // Header content ends in an '*'.
-    std::stringstream recv_msg = simulator_socket_.receive_stream();
-
-    std::string token;
-    if (std::getline(recv_msg, token, header_delimiter)) {
-        // Iterate through tokens received from single message.
-        std::optional<std::pair<std::string, std::string>> maybe_token_pair;
-        while (maybe_token_pair = pop_key_and_value(recv_msg, ':', '=')) {
-            // Strip any trailing newline chars from value.
-            auto ending_loc = maybe_token_pair.value().second.find_last_not_of('\n');
-            std::string value = maybe_token_pair.value().second.substr(0, ending_loc + 1);
-            handle_received_token(maybe_token_pair.value().first, value);
-        }
+    const auto header_end = recv_msg.find(header_delimiter);
+    recv_msg = (header_end != std::string_view::npos) ? recv_msg.substr(header_end + 1) : std::string_view();
+
+    // Iterate through tokens received from single message.
+    std::optional<std::pair<std::string_view, std::string_view>> maybe_token_pair;
+    while (maybe_token_pair = pop_key_and_value(recv_msg, ':', '=')) {
+        const auto [key, value] = maybe_token_pair.value();
+        // Strip any trailing newline chars from value.
+        handle_received_token(key, value.substr(0, value.find_last_not_of('\n') + 1));
     }
 }
 
@@ -38,47 +79,50 @@ void DcsExportScriptProtocol::send_command(const std::string &address, const std
                                    is_integer(address_as_components.value().second));
     if (address_is_valid) {
         const std::string message_assembly = "C" + address + "," + value;
-        simulator_socket_.send_string(message_assembly);
+        send_to_simulator(message_assembly);
     }
 }
 
-void DcsExportScriptProtocol::send_reset_command() { simulator_socket_.send_string("R"); }
+void DcsExportScriptProtocol::send_reset_command() { send_to_simulator("R"); }
 
 std::optional<std::string> DcsExportScriptProtocol::get_string_at_addr(const SimulatorAddress &address) const
 {
-    if (current_game_state_by_dcs_id_.count(address.address) > 0) {
-        if (!current_game_state_by_dcs_id_.at(address.address).empty()) {
-            return current_game_state_by_dcs_id_.at(address.address);
-        }
+    const auto maybe_value = get_string_view_at_addr(address);
+    if (maybe_value) {
+        return std::string(maybe_value.value());
     }
     return std::nullopt;
 }
 
-std::optional<Decimal> DcsExportScriptProtocol::get_value_at_addr(const SimulatorAddress &address) const
+std::optional<std::string_view> DcsExportScriptProtocol::get_string_view_at_addr(const SimulatorAddress &address) const
 {
-    if (current_game_state_by_dcs_id_.count(address.address) > 0) {
-        if (is_number(current_game_state_by_dcs_id_.at(address.address))) {
-            return current_game_state_by_dcs_id_.at(address.address);
-        }
+    const auto maybe_value = current_game_state_by_dcs_id_.get(static_cast<int>(address.address));
+    if (maybe_value && !maybe_value.value().empty()) {
+        return maybe_value;
     }
     return std::nullopt;
 }
 
+std::optional<Decimal> DcsExportScriptProtocol::get_value_at_addr(const SimulatorAddress &address) const
+{
+    return current_game_state_by_dcs_id_.get_number(static_cast<int>(address.address));
+}
+
 void DcsExportScriptProtocol::clear_game_state() { current_game_state_by_dcs_id_.clear(); }
 
 json DcsExportScriptProtocol::get_current_state_as_json() const
 {
     json current_game_state_printout;
-    for (const auto &[key, value] : current_game_state_by_dcs_id_) {
-        current_game_state_printout[std::to_string(key)] = value;
-    }
+    current_game_state_by_dcs_id_.for_each([&current_game_state_printout](const int key, std::string_view value) {
+        current_game_state_printout[std::to_string(key)] = std::string(value);
+    });
     return current_game_state_printout;
 }
 
-void DcsExportScriptProtocol::handle_received_token(const std::string &key, const std::string &value)
+void DcsExportScriptProtocol::handle_received_token(std::string_view key, std::string_view value)
 {
-    if (is_integer(key)) {
-        current_game_state_by_dcs_id_.insert_or_assign(std::stoi(key), value);
+    if (const auto id = parse_object_id(key)) {
+        current_game_state_by_dcs_id_.set(id.value(), value);
     } else if (key == "File") {
         current_module_ = value;
     } else if (key == "Ikarus" || key == "DAC" || key == "DCS") {
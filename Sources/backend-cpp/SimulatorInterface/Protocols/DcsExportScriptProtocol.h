@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "SimulatorInterface/Protocols/DcsExportScriptStateStore.h"
 #include "SimulatorInterface/SimulatorInterface.h"
 
 class DcsExportScriptProtocol : public SimulatorInterface
@@ -11,12 +12,19 @@ class DcsExportScriptProtocol : public SimulatorInterface
 
     void update_simulator_state();
 
+    /**
+     * @brief Updates the game state from a single datagram of ExportScript export data.
+     */
+    void handle_datagram(const char *data, const size_t size);
+
     void send_command(const std::string &address, const std::string &value);
 
     void send_reset_command();
 
     std::optional<std::string> get_string_at_addr(const SimulatorAddress &address) const;
 
+    std::optional<std::string_view> get_string_view_at_addr(const SimulatorAddress &address) const;
+
     std::optional<Decimal> get_value_at_addr(const SimulatorAddress &address) const;
 
     void clear_game_state();
@@ -29,8 +37,8 @@ class DcsExportScriptProtocol : public SimulatorInterface
      * @param key Key for updated value
      * @param value Updated value.
      */
-    void handle_received_token(const std::string &key, const std::string &value);
+    void handle_received_token(std::string_view key, std::string_view value);
 
-    // Maps object ID keys of received values to their most recently published values.
-    std::unordered_map<int, std::string> current_game_state_by_dcs_id_;
+    // Stores the most recently published values of received object IDs.
+    DcsExportScriptStateStore current_game_state_by_dcs_id_;
 };
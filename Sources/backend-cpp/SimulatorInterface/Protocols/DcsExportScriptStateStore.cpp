@@ -0,0 +1,99 @@
+// Copyright 2026 Charles Tytler
+
+#include "DcsExportScriptStateStore.h"
+
+#include "Utilities/StringUtilities.h"
+
+#include <cstring>
+
+void DcsExportScriptStateStore::ValueSlot::assign(std::string_view value)
+{
+    if (value.size() <= INLINE_CAPACITY) {
+        memcpy(inline_value, value.data(), value.size());
+        inline_length = static_cast<uint8_t>(value.size());
+        is_long = false;
+    } else {
+        // Reuses the capacity of any previously stored long value.
+        long_value.assign(value.data(), value.size());
+        is_long = true;
+    }
+    dirty = true;
+}
+
+void DcsExportScriptStateStore::set(const int id, std::string_view value)
+{
+    const uint32_t existing_slot = find_slot(id);
+    if (existing_slot != NO_SLOT && slots_[existing_slot].view() == value) {
+        // Repeated values are common in ExportScript datagrams and need not be copied again.
+        return;
+    }
+    slots_[(existing_slot != NO_SLOT) ? existing_slot : create_slot(id)].assign(value);
+}
+
+std::optional<std::string_view> DcsExportScriptStateStore::get(const int id) const
+{
+    const uint32_t slot_index = find_slot(id);
+    if (slot_index == NO_SLOT) {
+        return std::nullopt;
+    }
+    return slots_[slot_index].view();
+}
+
+std::optional<Decimal> DcsExportScriptStateStore::get_number(const int id) const
+{
+    const uint32_t slot_index = find_slot(id);
+    if (slot_index == NO_SLOT) {
+        return std::nullopt;
+    }
+    const ValueSlot &slot = slots_[slot_index];
+    if (slot.dirty) {
+        // Decimal parses from a string, so the value is copied, but only once per change.
+        const std::string value(slot.view());
+        slot.number = is_number(value) ? std::optional<Decimal>(value) : std::nullopt;
+        slot.dirty = false;
+    }
+    return slot.number;
+}
+
+bool DcsExportScriptStateStore::is_dirty(const int id) const
+{
+    const uint32_t slot_index = find_slot(id);
+    return (slot_index != NO_SLOT) && slots_[slot_index].dirty;
+}
+
+void DcsExportScriptStateStore::clear()
+{
+    for (const auto &slot : slots_) {
+        if (slot.id >= 0 && slot.id < DENSE_ID_LIMIT) {
+            slot_by_dense_id_[slot.id] = NO_SLOT;
+        }
+    }
+    slot_by_sparse_id_.clear();
+    slots_.clear();
+}
+
+uint32_t DcsExportScriptStateStore::find_slot(const int id) const
+{
+    if (id >= 0 && id < DENSE_ID_LIMIT) {
+        return (static_cast<size_t>(id) < slot_by_dense_id_.size()) ? slot_by_dense_id_[id] : NO_SLOT;
+    }
+    const auto it = slot_by_sparse_id_.find(id);
+    return (it != slot_by_sparse_id_.end()) ? it->second : NO_SLOT;
+}
+
+uint32_t DcsExportScriptStateStore::create_slot(const int id)
+{
+    const auto new_slot = static_cast<uint32_t>(slots_.size());
+    slots_.emplace_back();
+    slots_.back().id = id;
+    if (id >= 0 && id < DENSE_ID_LIMIT) {
+        if (static_cast<size_t>(id) >= slot_by_dense_id_.size()) {
+            // Grow the dense index lazily, so modules which only export low IDs stay small.
+            slot_by_dense_id_.resize(id + 1, NO_SLOT);
+        }
+        slot_by_dense_id_[id] = new_slot;
+    } else {
+        slot_by_sparse_id_[id] = new_slot;
+    }
+    return new_slot;
+}
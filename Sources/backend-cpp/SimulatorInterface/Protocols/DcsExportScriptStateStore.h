@@ -0,0 +1,100 @@
+// Copyright 2026 Charles Tytler
+
+#pragma once
+
+#include "Utilities/Decimal.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Stores the most recently received DCS ExportScript value of each object ID.
+ *
+ *   ExportScript IDs are small dense integers, so values are located through a flat vector indexed by ID, with a hash
+ *   map fallback only for IDs outside of the dense range. Values are held in fixed-size slots with an inline buffer so
+ *   that updating an existing ID with a short value does not allocate. Each slot also carries a dirty bit, set whenever
+ *   its value changes, so that the numeric value of an ID is parsed once per change rather than each time it is read.
+ */
+class DcsExportScriptStateStore
+{
+  public:
+    DcsExportScriptStateStore() = default;
+
+    /**
+     * @brief Stores the value received for an object ID, marking the ID as dirty if its value changed.
+     * @param id    DCS object ID.
+     * @param value Received value.
+     */
+    void set(const int id, std::string_view value);
+
+    /**
+     * @brief Get the stored value of an object ID.
+     * @return View into the stored value, valid until the next call to set() or clear(), or nullopt if no value has
+     * been received for the ID.
+     */
+    std::optional<std::string_view> get(const int id) const;
+
+    /**
+     * @brief Get the stored value of an object ID as a number, parsing it only if the ID is dirty.
+     * @return Numeric value, or nullopt if no value has been received for the ID or it is not a number.
+     */
+    std::optional<Decimal> get_number(const int id) const;
+
+    /**
+     * @brief Returns true if the value of the object ID has changed since its number was last parsed.
+     */
+    bool is_dirty(const int id) const;
+
+    /**
+     * @brief Removes all stored values while keeping allocated storage for reuse.
+     */
+    void clear();
+
+    /**
+     * @brief Number of object IDs with a stored value.
+     */
+    size_t size() const { return slots_.size(); }
+
+    /**
+     * @brief Calls func(id, value) for each object ID with a stored value.
+     */
+    template <typename Func> void for_each(Func &&func) const
+    {
+        for (const auto &slot : slots_) {
+            func(slot.id, slot.view());
+        }
+    }
+
+    static constexpr int DENSE_ID_LIMIT = 10000; // IDs in the range [0, DENSE_ID_LIMIT) are indexed directly.
+
+  private:
+    static constexpr size_t INLINE_CAPACITY = 22; // Values up to this length are stored without allocation.
+    static constexpr uint32_t NO_SLOT = UINT32_MAX;
+
+    struct ValueSlot {
+        int id;
+        uint8_t inline_length = 0;
+        char inline_value[INLINE_CAPACITY];
+        std::string long_value; // Only used for values longer than INLINE_CAPACITY.
+        bool is_long = false;
+        mutable bool dirty = true;             // Set when the value changes, until the number is next parsed.
+        mutable std::optional<Decimal> number; // Numeric value, parsed when read while dirty.
+
+        std::string_view view() const
+        {
+            return is_long ? std::string_view(long_value) : std::string_view(inline_value, inline_length);
+        }
+        void assign(std::string_view value);
+    };
+
+    uint32_t find_slot(const int id) const;
+    uint32_t create_slot(const int id);
+
+    std::vector<uint32_t> slot_by_dense_id_;              // Slot index of each ID below DENSE_ID_LIMIT.
+    std::unordered_map<int, uint32_t> slot_by_sparse_id_; // Slot index of IDs outside of the dense range.
+    std::vector<ValueSlot> slots_;                        // Stored values, in order of first receipt.
+};
@@ -0,0 +1,108 @@
+// Copyright 2026 Charles Tytler
+
+#include "benchmark/benchmark.h"
+
+#include "SimulatorInterface/Protocols/DcsBiosProtocol.h"
+#include "SimulatorInterface/Protocols/DcsBiosStreamParser.h"
+#include "SimulatorInterface/SimulatorProtocolTypes.h"
+#include "Utilities/DatagramCapture.h"
+#include "Utilities/MappedFile.h"
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace bench
+{
+
+/**
+ * @brief Builds a DCS-BIOS frame of num_blocks 32-byte writes spread across the address space, following an aircraft
+ *        name write, as exported each frame by DCS-BIOS.
+ */
+static std::string make_dcs_bios_frame(const int num_blocks, const uint16_t data_seed)
+{
+    std::string frame = "\x55\x55\x55\x55";
+    const auto append_word = [&frame](const uint16_t word) {
+        frame.push_back(static_cast<char>(word & 0xFF));
+        frame.push_back(static_cast<char>(word >> 8));
+    };
+    append_word(0x0000);
+    append_word(8);
+    frame.append("FA-18C_h", 8);
+    for (int block = 0; block < num_blocks; block++) {
+        append_word(static_cast<uint16_t>(0x1000 + block * 0x80));
+        append_word(32);
+        for (int word = 0; word < 16; word++) {
+            // Only some words change between frames, as with a real cockpit.
+            append_word(static_cast<uint16_t>((word % 4 == 0) ? data_seed + block : block * 16 + word));
+        }
+    }
+    append_word(0xFFFE);
+    append_word(2);
+    append_word(0x0000);
+    return frame;
+}
+
+/**
+ * @brief Get DCS-BIOS datagrams to benchmark with, read from the capture file named by the DCS_BENCHMARK_CAPTURE
+ *        environment variable if set, otherwise generated.
+ */
+static std::vector<std::string> benchmark_datagrams()
+{
+    std::vector<std::string> datagrams;
+    const char *capture_path = std::getenv("DCS_BENCHMARK_CAPTURE");
+    if (capture_path != nullptr) {
+        MappedFile capture_file(capture_path);
+        DatagramCaptureReader reader(capture_file.data(), capture_file.size());
+        while (const auto record = reader.next()) {
+            if (record->channel == static_cast<uint8_t>(Protocol::DCS_BIOS)) {
+                datagrams.emplace_back(record->data, record->size);
+            }
+        }
+    }
+    if (datagrams.empty()) {
+        for (uint16_t seed = 0; seed < 8; seed++) {
+            datagrams.push_back(make_dcs_bios_frame(48, seed));
+        }
+    }
+    return datagrams;
+}
+
+static void DcsBiosStreamParser_ProcessFrames(benchmark::State &state)
+{
+    const auto datagrams = benchmark_datagrams();
+    DcsBiosStreamParser parser;
+    DcsBiosStateStore game_state;
+    std::vector<unsigned int> changed_addresses;
+    size_t num_bytes = 0;
+    size_t i = 0;
+    for (auto _ : state) {
+        const std::string &datagram = datagrams[i++ % datagrams.size()];
+        changed_addresses.clear();
+        for (const char c : datagram) {
+            parser.processByte(static_cast<uint8_t>(c), game_state, &changed_addresses);
+        }
+        num_bytes += datagram.size();
+        benchmark::DoNotOptimize(changed_addresses.data());
+    }
+    state.SetBytesProcessed(num_bytes);
+}
+BENCHMARK(DcsBiosStreamParser_ProcessFrames);
+
+static void DcsBiosProtocol_HandleDatagram(benchmark::State &state)
+{
+    const auto datagrams = benchmark_datagrams();
+    DcsBiosProtocol simulator_interface({"1938", "1939", "127.0.0.1", ""});
+    size_t num_bytes = 0;
+    size_t i = 0;
+    for (auto _ : state) {
+        const std::string &datagram = datagrams[i++ % datagrams.size()];
+        simulator_interface.handle_datagram(datagram.data(), datagram.size());
+        num_bytes += datagram.size();
+    }
+    state.SetBytesProcessed(num_bytes);
+}
+BENCHMARK(DcsBiosProtocol_HandleDatagram);
+
+} // namespace bench
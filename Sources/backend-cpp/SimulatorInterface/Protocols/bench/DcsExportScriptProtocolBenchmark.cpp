@@ -0,0 +1,45 @@
+// Copyright 2026 Charles Tytler
+
+#include "benchmark/benchmark.h"
+
+#include "SimulatorInterface/Protocols/DcsExportScriptProtocol.h"
+
+#include <string>
+
+namespace bench
+{
+
+/**
+ * @brief Builds an ExportScript datagram of num_tokens "id=value" tokens, in the format sent by the export script.
+ */
+static std::string make_export_script_datagram(const int num_tokens, const int value_seed)
+{
+    std::string datagram = "File*";
+    for (int id = 0; id < num_tokens; id++) {
+        if (id > 0) {
+            datagram += ":";
+        }
+        const int value = (id % 5 == 0) ? value_seed : id;
+        datagram += std::to_string(100 + id) + "=" + std::to_string(value) + ".00";
+    }
+    return datagram + "\n";
+}
+
+static void DcsExportScriptProtocol_HandleDatagram(benchmark::State &state)
+{
+    const std::string datagrams[] = {make_export_script_datagram(static_cast<int>(state.range(0)), 0),
+                                     make_export_script_datagram(static_cast<int>(state.range(0)), 1)};
+    DcsExportScriptProtocol simulator_interface({"1948", "1949", "127.0.0.1", ""});
+    size_t num_bytes = 0;
+    size_t i = 0;
+    for (auto _ : state) {
+        const std::string &datagram = datagrams[i++ % 2];
+        simulator_interface.handle_datagram(datagram.data(), datagram.size());
+        num_bytes += datagram.size();
+    }
+    state.SetBytesProcessed(num_bytes);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(DcsExportScriptProtocol_HandleDatagram)->Arg(16)->Arg(256);
+
+} // namespace bench
@@ -0,0 +1,109 @@
+// Copyright 2026 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "SimulatorInterface/Protocols/CaptureReplayProtocol.h"
+#include "SimulatorInterface/Protocols/DcsBiosProtocol.h"
+#include "SimulatorInterface/Protocols/DcsExportScriptProtocol.h"
+
+#include <cstdio>
+#include <thread>
+
+namespace test
+{
+#define SIZE_OF(x) (sizeof(x) / sizeof((x)[0]))
+
+// clang-format off
+const char dcs_bios_frame[] = {0x55, 0x55, 0x55, 0x55,                          // Sync frame
+                               0x00, 0x00, 0x08, 0x00,                          // Addr 0x0000 (8 bytes)
+                               'A', 'V', '8', 'B', 'N', 'A', '\0', 0x20,        // String contents
+                               0x0A, 0x00, 0x02, 0x00, 0x34, 0x12,              // Addr 0x000A = 0x1234
+                               (char)0xFE, (char)0xFF, 0x02, 0x00, 0x00, 0x00}; // End of frame
+// clang-format on
+
+class CaptureReplayProtocolTestFixture : public ::testing::Test
+{
+  public:
+    CaptureReplayProtocolTestFixture()
+    {
+        connection_settings.replay_capture_path = "capture_replay_test.sdcap";
+        DatagramCaptureWriter writer(connection_settings.replay_capture_path, 0);
+        writer.write(static_cast<uint8_t>(Protocol::DCS_BIOS), dcs_bios_frame, SIZE_OF(dcs_bios_frame), 0);
+        writer.write(static_cast<uint8_t>(Protocol::DCS_ExportScript), "header*761=1", 12, 1'000'000'000);
+        writer.write(static_cast<uint8_t>(Protocol::DCS_ExportScript), "header*761=0", 12, 100'000'000'000);
+    }
+    ~CaptureReplayProtocolTestFixture() { std::remove(connection_settings.replay_capture_path.c_str()); }
+
+    SimulatorConnectionSettings connection_settings = {"1918", "1919", "127.0.0.1", ""};
+};
+
+TEST_F(CaptureReplayProtocolTestFixture, replay_dcs_bios_through_parser)
+{
+    connection_settings.replay_speed = 0.0;
+    CaptureReplayProtocol<DcsBiosProtocol> simulator_interface(connection_settings, Protocol::DCS_BIOS);
+    simulator_interface.update_simulator_state();
+    EXPECT_EQ("AV8BNA", simulator_interface.get_current_module());
+    EXPECT_EQ(Decimal(0x34), simulator_interface.get_value_at_addr(SimulatorAddress(0x000A, 0x00FF, 0)));
+}
+
+TEST_F(CaptureReplayProtocolTestFixture, replay_as_fast_as_possible)
+{
+    CaptureReplaySource replay_source(
+        connection_settings.replay_capture_path, static_cast<uint8_t>(Protocol::DCS_ExportScript), 0.0);
+    // Only datagrams of the requested channel are replayed, without waiting for their timestamps.
+    const auto &records = replay_source.next_due_records();
+    ASSERT_EQ(2, records.size());
+    EXPECT_EQ("header*761=1", std::string(records[0].data, records[0].size));
+    EXPECT_EQ("header*761=0", std::string(records[1].data, records[1].size));
+}
+
+TEST_F(CaptureReplayProtocolTestFixture, replay_in_real_time)
+{
+    connection_settings.replay_speed = 1.0;
+    CaptureReplayProtocol<DcsExportScriptProtocol> simulator_interface(connection_settings,
+                                                                       Protocol::DCS_ExportScript);
+    // Datagrams recorded after the start of the capture are not replayed until their time is reached.
+    simulator_interface.update_simulator_state();
+    EXPECT_FALSE(simulator_interface.get_value_at_addr(761));
+}
+
+TEST_F(CaptureReplayProtocolTestFixture, replay_at_multiple_of_real_time)
+{
+    CaptureReplaySource replay_source(
+        connection_settings.replay_capture_path, static_cast<uint8_t>(Protocol::DCS_ExportScript), 1000.0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    // Replay clock has passed the first record at 1s but not the second at 100s.
+    const auto &records = replay_source.next_due_records();
+    ASSERT_EQ(1, records.size());
+    EXPECT_EQ("header*761=1", std::string(records[0].data, records[0].size));
+}
+
+TEST_F(CaptureReplayProtocolTestFixture, replay_loops_to_start_of_capture)
+{
+    CaptureReplaySource replay_source(
+        connection_settings.replay_capture_path, static_cast<uint8_t>(Protocol::DCS_BIOS), 0.0);
+    EXPECT_EQ(1, replay_source.next_due_records().size());
+    // Capture restarts after the update in which its end is reached.
+    EXPECT_EQ(1, replay_source.next_due_records().size());
+}
+
+TEST_F(CaptureReplayProtocolTestFixture, replay_opens_no_simulator_socket)
+{
+    // A socket bound to the port commands are sent to receives neither the initial reset command nor other commands.
+    UdpSocket mock_dcs(connection_settings.ip_address, connection_settings.tx_port, connection_settings.rx_port);
+    CaptureReplayProtocol<DcsBiosProtocol> simulator_interface(connection_settings, Protocol::DCS_BIOS);
+    simulator_interface.send_command("AAP_CDUPWR", "1");
+    EXPECT_EQ("", mock_dcs.receive_stream().str());
+
+    // The receive port is left free for another socket.
+    EXPECT_NO_THROW(UdpSocket(connection_settings.ip_address, connection_settings.rx_port));
+}
+
+TEST(CaptureReplayProtocolTest, missing_capture_throws)
+{
+    SimulatorConnectionSettings connection_settings = {"1918", "1919", "127.0.0.1", ""};
+    connection_settings.replay_capture_path = "nonexistent_capture.sdcap";
+    EXPECT_THROW(CaptureReplayProtocol<DcsBiosProtocol>(connection_settings, Protocol::DCS_BIOS), std::runtime_error);
+}
+
+} // namespace test
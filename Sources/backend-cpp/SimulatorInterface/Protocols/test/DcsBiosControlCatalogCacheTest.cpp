@@ -0,0 +1,99 @@
+// Copyright 2026 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "SimulatorInterface/Protocols/DcsBiosControlCatalogCache.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
+namespace test
+{
+class DcsBiosControlCatalogCacheTest : public ::testing::Test
+{
+  protected:
+    DcsBiosControlCatalogCacheTest()
+    {
+        std::filesystem::remove_all(root);
+        std::filesystem::create_directories(root / "json");
+        write_control_reference(4332);
+    }
+
+    ~DcsBiosControlCatalogCacheTest() { std::filesystem::remove_all(root); }
+
+    void write_control_reference(const int address)
+    {
+        const json control_reference = {
+            {"Fuel Panel",
+             {{"FUEL_SYS_MASTER",
+               {{"category", "Fuel Panel"},
+                {"identifier", "FUEL_SYS_MASTER"},
+                {"outputs", {{{"address", address}, {"mask", 256}, {"shift_by", 8}, {"type", "integer"}}}}}}}}};
+        std::ofstream(json_path) << control_reference.dump();
+    }
+
+    const std::filesystem::path root = "control_catalog_cache_test";
+    const std::string json_path = (root / "json" / "A-10C.json").string();
+    const std::string cache_directory = (root / "cache").string();
+};
+
+TEST_F(DcsBiosControlCatalogCacheTest, find_address_of_loaded_module)
+{
+    DcsBiosControlCatalogCache cache(cache_directory);
+    EXPECT_FALSE(cache.find_address("A-10C", "FUEL_SYS_MASTER"));
+
+    EXPECT_TRUE(cache.load(json_path));
+    const auto address = cache.find_address("A-10C", "FUEL_SYS_MASTER");
+    ASSERT_TRUE(address);
+    EXPECT_EQ(4332, address->address);
+    EXPECT_EQ(256, address->mask);
+    EXPECT_EQ(8, address->shift);
+    EXPECT_FALSE(cache.find_address("A-10C", "NOT_A_CONTROL"));
+    EXPECT_FALSE(cache.find_address("F-16C_50", "FUEL_SYS_MASTER"));
+}
+
+TEST_F(DcsBiosControlCatalogCacheTest, catalog_persists_on_disk)
+{
+    DcsBiosControlCatalogCache(cache_directory).load(json_path);
+    // Once compiled, the catalog is loaded without reading the control reference again.
+    write_control_reference(5000);
+    std::filesystem::last_write_time(json_path,
+                                     std::filesystem::last_write_time(json_path) - std::chrono::hours(1));
+
+    DcsBiosControlCatalogCache cache(cache_directory);
+    EXPECT_TRUE(cache.load(json_path));
+    EXPECT_EQ(4332, cache.find_address("A-10C", "FUEL_SYS_MASTER")->address);
+}
+
+TEST_F(DcsBiosControlCatalogCacheTest, modified_control_reference_is_compiled_again)
+{
+    DcsBiosControlCatalogCache cache(cache_directory);
+    cache.load(json_path);
+
+    write_control_reference(5000);
+    std::filesystem::last_write_time(json_path,
+                                     std::filesystem::last_write_time(json_path) + std::chrono::hours(1));
+    EXPECT_TRUE(cache.load(json_path));
+    EXPECT_EQ(5000, cache.find_address("A-10C", "FUEL_SYS_MASTER")->address);
+}
+
+TEST_F(DcsBiosControlCatalogCacheTest, unreadable_control_reference_is_not_loaded)
+{
+    DcsBiosControlCatalogCache cache(cache_directory);
+    EXPECT_FALSE(cache.load((root / "json" / "missing.json").string()));
+
+    std::ofstream(json_path) << "{\"Fuel Panel\": ";
+    EXPECT_FALSE(cache.load(json_path));
+    EXPECT_FALSE(cache.find_address("A-10C", "FUEL_SYS_MASTER"));
+}
+
+TEST_F(DcsBiosControlCatalogCacheTest, json_without_controls_is_not_loaded)
+{
+    const std::string aliases_path = (root / "json" / "AircraftAliases.json").string();
+    std::ofstream(aliases_path) << R"({"A-10C": ["CommonData", "MetadataStart", "A-10C"]})";
+    DcsBiosControlCatalogCache cache(cache_directory);
+    EXPECT_FALSE(cache.load(aliases_path));
+    EXPECT_FALSE(std::filesystem::exists(cache_directory) && !std::filesystem::is_empty(cache_directory));
+}
+} // namespace test
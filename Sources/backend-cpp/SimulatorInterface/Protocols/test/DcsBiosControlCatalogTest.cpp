@@ -0,0 +1,181 @@
+// Copyright 2026 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "SimulatorInterface/Protocols/DcsBiosControlCatalog.h"
+#include "Utilities/MappedFile.h"
+
+#include <filesystem>
+#include <fstream>
+
+namespace test
+{
+using namespace DcsBiosControlCatalog;
+
+static const json control_reference = json::parse(R"({
+    "Fuel Panel": {
+        "FUEL_SYS_MASTER": {
+            "category": "Fuel Panel",
+            "control_type": "selector",
+            "description": "Fuel System Master Switch",
+            "identifier": "FUEL_SYS_MASTER",
+            "inputs": [
+                {"interface": "fixed_step", "description": "switch to previous or next state"},
+                {"interface": "set_state", "max_value": 1, "description": "set position"},
+                {"interface": "action", "argument": "TOGGLE", "description": "Toggle switch state"}
+            ],
+            "outputs": [
+                {"address": 4332, "mask": 256, "shift_by": 8, "max_value": 1, "type": "integer", "suffix": ""}
+            ]
+        },
+        "FUEL_QTY": {
+            "category": "Fuel Panel",
+            "control_type": "analog_gauge",
+            "description": "Fuel Quantity",
+            "identifier": "FUEL_QTY",
+            "inputs": [],
+            "outputs": [
+                {"address": 4340, "mask": 65535, "shift_by": 0, "max_value": 65535, "type": "integer", "suffix": ""}
+            ]
+        }
+    },
+    "UFC": {
+        "UFC_SCRATCHPAD": {
+            "category": "UFC",
+            "control_type": "display",
+            "description": "Scratchpad Display",
+            "identifier": "UFC_SCRATCHPAD",
+            "inputs": [],
+            "outputs": [{"address": 4400, "max_length": 12, "type": "string", "suffix": ""}]
+        },
+        "UFC_ENT": {
+            "category": "UFC",
+            "control_type": "selector",
+            "description": "UFC Enter",
+            "identifier": "UFC_ENT",
+            "inputs": [{"interface": "variable_step", "max_value": 65535, "suggested_step": 3200}],
+            "outputs": []
+        }
+    }
+})");
+
+TEST(DcsBiosControlCatalogTest, find_controls_by_identifier)
+{
+    const std::vector<char> catalog = compile(control_reference);
+    const DcsBiosControlCatalogReader reader(catalog.data(), catalog.size());
+    EXPECT_EQ(4, reader.num_controls());
+
+    const auto fuel_master = reader.find("FUEL_SYS_MASTER");
+    ASSERT_TRUE(fuel_master);
+    EXPECT_EQ("FUEL_SYS_MASTER", fuel_master->identifier);
+    EXPECT_EQ("Fuel Panel", fuel_master->category);
+    EXPECT_EQ("Fuel System Master Switch", fuel_master->description);
+    EXPECT_EQ("selector", fuel_master->control_type);
+    EXPECT_EQ(1, fuel_master->num_outputs);
+    EXPECT_EQ(3, fuel_master->num_inputs);
+
+    const auto scratchpad = reader.find("UFC_SCRATCHPAD");
+    ASSERT_TRUE(scratchpad);
+    EXPECT_EQ("UFC", scratchpad->category);
+    EXPECT_EQ("display", scratchpad->control_type);
+}
+
+TEST(DcsBiosControlCatalogTest, unknown_identifier_is_not_found)
+{
+    const std::vector<char> catalog = compile(control_reference);
+    const DcsBiosControlCatalogReader reader(catalog.data(), catalog.size());
+    EXPECT_FALSE(reader.find("FUEL_SYS"));
+    EXPECT_FALSE(reader.find(""));
+    EXPECT_FALSE(reader.find_address("NOT_A_CONTROL"));
+    // A control without outputs has no address.
+    EXPECT_TRUE(reader.find("UFC_ENT"));
+    EXPECT_FALSE(reader.find_address("UFC_ENT"));
+}
+
+TEST(DcsBiosControlCatalogTest, find_address_of_outputs)
+{
+    const std::vector<char> catalog = compile(control_reference);
+    const DcsBiosControlCatalogReader reader(catalog.data(), catalog.size());
+
+    const auto integer_address = reader.find_address("FUEL_SYS_MASTER");
+    ASSERT_TRUE(integer_address);
+    EXPECT_EQ(AddressType::INTEGER, integer_address->type);
+    EXPECT_EQ(4332, integer_address->address);
+    EXPECT_EQ(256, integer_address->mask);
+    EXPECT_EQ(8, integer_address->shift);
+
+    const auto string_address = reader.find_address("UFC_SCRATCHPAD");
+    ASSERT_TRUE(string_address);
+    EXPECT_EQ(AddressType::STRING, string_address->type);
+    EXPECT_EQ(4400, string_address->address);
+    EXPECT_EQ(12, string_address->max_length);
+
+    const auto scratchpad = reader.find("UFC_SCRATCHPAD").value();
+    const Output output = reader.output(scratchpad, 0);
+    EXPECT_EQ(OutputType::STRING, output.type);
+    EXPECT_EQ(12, output.max_length);
+}
+
+TEST(DcsBiosControlCatalogTest, read_inputs_of_control)
+{
+    const std::vector<char> catalog = compile(control_reference);
+    const DcsBiosControlCatalogReader reader(catalog.data(), catalog.size());
+
+    const auto fuel_master = reader.find("FUEL_SYS_MASTER").value();
+    EXPECT_EQ(InputInterface::FIXED_STEP, reader.input(fuel_master, 0).interface_type);
+    EXPECT_EQ(InputInterface::SET_STATE, reader.input(fuel_master, 1).interface_type);
+    EXPECT_EQ(1, reader.input(fuel_master, 1).max_value);
+    EXPECT_EQ(InputInterface::ACTION, reader.input(fuel_master, 2).interface_type);
+    EXPECT_EQ("TOGGLE", reader.input(fuel_master, 2).argument);
+
+    const auto enter = reader.find("UFC_ENT").value();
+    ASSERT_EQ(1, enter.num_inputs);
+    EXPECT_EQ(InputInterface::VARIABLE_STEP, reader.input(enter, 0).interface_type);
+    EXPECT_EQ(65535, reader.input(enter, 0).max_value);
+    EXPECT_EQ(3200, reader.input(enter, 0).suggested_step);
+}
+
+TEST(DcsBiosControlCatalogTest, empty_control_reference)
+{
+    const std::vector<char> catalog = compile(json::object());
+    const DcsBiosControlCatalogReader reader(catalog.data(), catalog.size());
+    EXPECT_EQ(0, reader.num_controls());
+    EXPECT_FALSE(reader.find("FUEL_SYS_MASTER"));
+}
+
+TEST(DcsBiosControlCatalogTest, invalid_catalog_throws)
+{
+    const std::string not_a_catalog = "{\"Fuel Panel\": {}}";
+    EXPECT_THROW(DcsBiosControlCatalogReader(not_a_catalog.data(), not_a_catalog.size()), std::runtime_error);
+
+    std::vector<char> catalog = compile(control_reference);
+    EXPECT_THROW(DcsBiosControlCatalogReader(catalog.data(), HEADER_SIZE - 1), std::runtime_error);
+    // Truncating the catalog leaves sections out of bounds.
+    EXPECT_THROW(DcsBiosControlCatalogReader(catalog.data(), HEADER_SIZE + 10), std::runtime_error);
+
+    catalog[8] = static_cast<char>(FORMAT_VERSION + 1);
+    EXPECT_THROW(DcsBiosControlCatalogReader(catalog.data(), catalog.size()), std::runtime_error);
+}
+
+TEST(DcsBiosControlCatalogTest, compile_file_and_read_mapped_catalog)
+{
+    const std::string json_path = "control_catalog_test.json";
+    const std::string catalog_path = "control_catalog_test.bin";
+    std::ofstream(json_path) << control_reference.dump();
+
+    compile_file(json_path, catalog_path);
+    {
+        const MappedFile mapped_catalog(catalog_path);
+        const DcsBiosControlCatalogReader reader(mapped_catalog.data(), mapped_catalog.size());
+        EXPECT_EQ(4, reader.num_controls());
+        const auto fuel_quantity_address = reader.find_address("FUEL_QTY");
+        ASSERT_TRUE(fuel_quantity_address);
+        EXPECT_EQ(4340, fuel_quantity_address->address);
+        EXPECT_EQ(65535, fuel_quantity_address->mask);
+    }
+    std::filesystem::remove(json_path);
+    std::filesystem::remove(catalog_path);
+
+    EXPECT_THROW(compile_file("missing_control_reference.json", catalog_path), std::runtime_error);
+}
+} // namespace test
@@ -0,0 +1,132 @@
+// Copyright 2026 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "SimulatorInterface/Protocols/DcsBiosDecoderTable.h"
+
+namespace test
+{
+static DcsBiosStateStore make_state(std::initializer_list<std::pair<unsigned int, unsigned int>> data_by_address)
+{
+    DcsBiosStateStore state;
+    for (const auto &[address, data] : data_by_address) {
+        state.set(address, data);
+    }
+    return state;
+}
+
+TEST(DcsBiosDecoderTableTest, decode_initial_value_on_add)
+{
+    const DcsBiosStateStore data_by_address = make_state({{0x1000, 0x0A05}});
+    DcsBiosDecoderTable table;
+    const auto received = table.add_field(SimulatorAddress(0x1000, 0x00FF, 0), data_by_address);
+    const auto not_received = table.add_field(SimulatorAddress(0x2000, 0x00FF, 0), data_by_address);
+    EXPECT_EQ(0x05, received->value.value());
+    EXPECT_TRUE(received->changed);
+    EXPECT_TRUE(received->subscribed);
+    EXPECT_FALSE(not_received->value.has_value());
+}
+
+TEST(DcsBiosDecoderTableTest, identical_fields_decoded_once_for_all_subscribers)
+{
+    DcsBiosStateStore data_by_address;
+    DcsBiosDecoderTable table;
+    const auto first = table.add_field(SimulatorAddress(0x1000, 0x0F00, 8), data_by_address);
+    const auto second = table.add_field(SimulatorAddress(0x1000, 0x0F00, 8), data_by_address);
+    (void)table.add_field(SimulatorAddress(0x1000, 0x00F0, 4), data_by_address);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(2, table.num_fields());
+
+    data_by_address.set(0x1000, 0x0300);
+    table.decode_addresses({0x1000}, data_by_address);
+    EXPECT_EQ(0x03, first->value.value());
+    EXPECT_EQ(0x03, second->value.value());
+}
+
+TEST(DcsBiosDecoderTableTest, push_only_changed_fields)
+{
+    DcsBiosStateStore data_by_address = make_state({{0x1000, 0x0000}, {0x2000, 0x0000}});
+    DcsBiosDecoderTable table;
+    const auto low = table.add_field(SimulatorAddress(0x1000, 0x00FF, 0), data_by_address);
+    const auto high = table.add_field(SimulatorAddress(0x1000, 0xFF00, 8), data_by_address);
+    const auto other = table.add_field(SimulatorAddress(0x2000, 0xFFFF, 0), data_by_address);
+    for (const auto &field : {low, high, other}) {
+        field->changed = false;
+    }
+
+    data_by_address.set(0x1000, 0x0300);
+    data_by_address.set(0x2000, 0x0001);
+    table.decode_addresses({0x1000}, data_by_address);
+    EXPECT_FALSE(low->changed);
+    EXPECT_TRUE(high->changed);
+    EXPECT_EQ(0x03, high->value.value());
+    // Field in an address not listed as changed keeps its previously decoded value.
+    EXPECT_FALSE(other->changed);
+    EXPECT_EQ(0x00, other->value.value());
+
+    table.decode_all(data_by_address);
+    EXPECT_TRUE(other->changed);
+    EXPECT_EQ(0x01, other->value.value());
+}
+
+TEST(DcsBiosDecoderTableTest, invalidate_values_keeps_subscriptions)
+{
+    DcsBiosStateStore data_by_address = make_state({{0x1000, 0x0001}});
+    DcsBiosDecoderTable table;
+    const auto field = table.add_field(SimulatorAddress(0x1000, 0xFFFF, 0), data_by_address);
+    field->changed = false;
+    table.invalidate_values();
+    EXPECT_TRUE(field->subscribed);
+    EXPECT_TRUE(field->changed);
+    EXPECT_FALSE(field->value.has_value());
+
+    table.decode_addresses({0x1000}, data_by_address);
+    EXPECT_EQ(0x01, field->value.value());
+}
+
+TEST(DcsBiosDecoderTableTest, clear_unsubscribes_fields)
+{
+    DcsBiosStateStore data_by_address = make_state({{0x1000, 0x0001}});
+    DcsBiosDecoderTable table;
+    const auto old_field = table.add_field(SimulatorAddress(0x1000, 0xFFFF, 0), data_by_address);
+    table.clear();
+    EXPECT_FALSE(old_field->subscribed);
+    EXPECT_EQ(0, table.num_fields());
+
+    // Values are no longer pushed to the cleared field.
+    data_by_address.set(0x1000, 0x0002);
+    const auto new_field = table.add_field(SimulatorAddress(0x1000, 0xFFFF, 0), data_by_address);
+    table.decode_addresses({0x1000}, data_by_address);
+    EXPECT_EQ(0x01, old_field->value.value());
+    EXPECT_EQ(0x02, new_field->value.value());
+}
+
+TEST(DcsBiosDecoderTableTest, remove_subscriber_keeps_other_fields)
+{
+    DcsBiosStateStore data_by_address = make_state({{0x1000, 0x0000}, {0x2000, 0x0000}});
+    DcsBiosDecoderTable table;
+    const auto first = table.add_field(SimulatorAddress(0x1000, 0x00FF, 0), data_by_address);
+    const auto shared = table.add_field(SimulatorAddress(0x1000, 0x00FF, 0), data_by_address);
+    const auto last = table.add_field(SimulatorAddress(0x2000, 0x00FF, 0), data_by_address);
+
+    // A field is kept while it has other subscribers.
+    table.remove_subscriber(first);
+    EXPECT_FALSE(first->subscribed);
+    EXPECT_EQ(2, table.num_fields());
+
+    // Removing the field moves the last field into its place, which is still decoded and can itself be removed.
+    table.remove_subscriber(shared);
+    EXPECT_EQ(1, table.num_fields());
+    data_by_address.set(0x1000, 0x0001);
+    data_by_address.set(0x2000, 0x0002);
+    table.decode_addresses({0x1000, 0x2000}, data_by_address);
+    EXPECT_EQ(0x00, shared->value.value());
+    EXPECT_EQ(0x02, last->value.value());
+    table.remove_subscriber(last);
+    EXPECT_EQ(0, table.num_fields());
+
+    // Unknown subscriptions are ignored.
+    table.remove_subscriber(last);
+    table.remove_subscriber(std::make_shared<DecodedField>());
+}
+} // namespace test
@@ -137,6 +137,27 @@ TEST_F(DcsBiosProtocolTestFixture, get_string_value_null_terminated)
     EXPECT_EQ("TestStr", simulator_interface.get_string_at_addr(SimulatorAddress(0x1234, 8)));
 }
 
+TEST_F(DcsBiosProtocolTestFixture, get_string_view_updates_on_change)
+{
+    // clang-format off
+    const char mock_dcs_message[] = {0x55, 0x55, 0x55, 0x55,                          // Sync frame
+                                     0x00, 0x10, 0x04, 0x00, 'A', 'B', 'C', 'D',      // Addr 0x1000 (4 bytes)
+                                     (char)0xFE, (char)0xFF, 0x02, 0x00, 0x00, 0x00}; // End of frame
+    const char mock_dcs_update[] = {0x55, 0x55, 0x55, 0x55,                           // Sync frame
+                                    0x02, 0x10, 0x02, 0x00, 'Y', '\0',               // Addr 0x1002 (2 bytes)
+                                    (char)0xFE, (char)0xFF, 0x02, 0x00, 0x00, 0x00};  // End of frame
+    // clang-format on
+    const SimulatorAddress address(0x1000, 4);
+    mock_dcs.send_bytes(mock_dcs_message, SIZE_OF(mock_dcs_message));
+    simulator_interface.update_simulator_state();
+    EXPECT_EQ("ABCD", simulator_interface.get_string_view_at_addr(address).value());
+
+    mock_dcs.send_bytes(mock_dcs_update, SIZE_OF(mock_dcs_update));
+    simulator_interface.update_simulator_state();
+    EXPECT_EQ("ABY", simulator_interface.get_string_view_at_addr(address).value());
+    EXPECT_EQ("ABY", simulator_interface.get_string_at_addr(address).value());
+}
+
 TEST_F(DcsBiosProtocolTestFixture, update_simulator_state_overwrites_values)
 {
     // TEST 1 - Received values are stored and retrievable.
@@ -181,6 +202,22 @@ TEST_F(DcsBiosProtocolTestFixture, update_simulator_state_handle_incomplete_mess
     EXPECT_TRUE(data_at_0x0008.value() == Decimal(0x726F));
 }
 
+TEST_F(DcsBiosProtocolTestFixture, update_simulator_state_large_datagram)
+{
+    // Build a single datagram much larger than 1 KiB, writing the value 0x0101 to a 3000 byte block at 0x1000.
+    constexpr int BLOCK_SIZE = 3000;
+    std::vector<char> mock_dcs_message = {0x55, 0x55, 0x55, 0x55, 0x00, 0x10, (char)(BLOCK_SIZE & 0xFF),
+                                          (char)(BLOCK_SIZE >> 8)};
+    mock_dcs_message.insert(mock_dcs_message.end(), BLOCK_SIZE, 0x01);
+    mock_dcs_message.insert(mock_dcs_message.end(), {(char)0xFE, (char)0xFF, 0x02, 0x00, 0x00, 0x00});
+    mock_dcs.send_bytes(mock_dcs_message.data(), static_cast<int>(mock_dcs_message.size()));
+    simulator_interface.update_simulator_state();
+
+    // Expect the last word of the block to have been received.
+    const auto last_address = SimulatorAddress{0x1000 + BLOCK_SIZE - 2, 0xFFFF, 0};
+    EXPECT_TRUE(Decimal(0x0101) == simulator_interface.get_value_at_addr(last_address));
+}
+
 TEST_F(DcsBiosProtocolTestFixture, update_simulator_state_handle_change_of_module)
 {
     // Send a message with module name "ACFT".
@@ -227,6 +264,29 @@ TEST_F(DcsBiosProtocolTestFixture, update_simulator_state_handle_change_of_modul
     EXPECT_FALSE(simulator_interface.get_value_at_addr(address_0x1110));
 }
 
+TEST_F(DcsBiosProtocolTestFixture, module_detected_again_after_clear_game_state)
+{
+    // clang-format off
+    const char mock_dcs_message[] = {0x55,       0x55,       0x55, 0x55,              //
+                                     0x00,       0x00,       0x06, 0x00,              //
+                                     'A',        'C',        'F',  'T',  '\0', 0x20,  // ACFT_NAME = "ACFT"
+                                     0x10,       0x11,       0x02, 0x00, 0x01, 0x23,  // Data at Address 0x1110
+                                     (char)0xFE, (char)0xFF, 0x02, 0x00, 0x00, 0x00}; // End of frame
+    // clang-format on
+    mock_dcs.send_bytes(mock_dcs_message, SIZE_OF(mock_dcs_message));
+    simulator_interface.update_simulator_state();
+    EXPECT_EQ("ACFT", simulator_interface.get_current_module());
+
+    simulator_interface.clear_game_state();
+    EXPECT_EQ("", simulator_interface.get_current_module());
+
+    // Resending identical data is treated as new data after the game state is cleared.
+    mock_dcs.send_bytes(mock_dcs_message, SIZE_OF(mock_dcs_message));
+    simulator_interface.update_simulator_state();
+    EXPECT_EQ("ACFT", simulator_interface.get_current_module());
+    EXPECT_TRUE(simulator_interface.get_value_at_addr(SimulatorAddress{0x1110, 0xFFFF, 0}));
+}
+
 TEST_F(DcsBiosProtocolTestFixture, send_command)
 {
     const std::string control_reference = "BIOS_HANDLE";
@@ -271,6 +331,52 @@ TEST_F(DcsBiosProtocolTestFixture, clear_game_state)
     EXPECT_EQ(0, current_game_state.size());
 }
 
+TEST_F(DcsBiosProtocolTestFixture, push_decoded_values_of_packed_fields)
+{
+    const auto low_field = simulator_interface.subscribe_decoded_field(SimulatorAddress(0x5678, 0x00FF, 0));
+    const auto high_field = simulator_interface.subscribe_decoded_field(SimulatorAddress(0x5678, 0xFF00, 8));
+    ASSERT_TRUE(low_field);
+    ASSERT_TRUE(high_field);
+    EXPECT_FALSE(low_field->value.has_value());
+
+    // clang-format off
+    const char mock_dcs_message[] = {0x55, 0x55, 0x55, 0x55,                          // Sync frame
+                                     0x78, 0x56, 0x02, 0x00, 0x07, 0x03,              // Addr 0x5678 (2 bytes)
+                                     (char)0xFE, (char)0xFF, 0x02, 0x00, 0x00, 0x00}; // End of frame
+    // clang-format on
+    mock_dcs.send_bytes(mock_dcs_message, SIZE_OF(mock_dcs_message));
+    simulator_interface.update_simulator_state();
+    EXPECT_EQ(7, low_field->value.value());
+    EXPECT_EQ(3, high_field->value.value());
+
+    // Decoded values are invalidated along with the game state.
+    low_field->changed = false;
+    simulator_interface.clear_game_state();
+    EXPECT_TRUE(low_field->changed);
+    EXPECT_FALSE(low_field->value.has_value());
+}
+
+TEST_F(DcsBiosProtocolTestFixture, clear_decoded_fields_unsubscribes)
+{
+    // clang-format off
+    const char mock_dcs_message[] = {0x55, 0x55, 0x55, 0x55,                          // Sync frame
+                                     0x78, 0x56, 0x02, 0x00, 0x07, 0x03,              // Addr 0x5678 (2 bytes)
+                                     (char)0xFE, (char)0xFF, 0x02, 0x00, 0x00, 0x00}; // End of frame
+    // clang-format on
+    mock_dcs.send_bytes(mock_dcs_message, SIZE_OF(mock_dcs_message));
+    simulator_interface.update_simulator_state();
+
+    const auto field = simulator_interface.subscribe_decoded_field(SimulatorAddress(0x5678, 0xFF00, 8));
+    ASSERT_TRUE(field);
+    EXPECT_EQ(3, field->value.value());
+
+    simulator_interface.clear_decoded_fields();
+    EXPECT_FALSE(field->subscribed);
+
+    // Only integer addresses can be decoded.
+    EXPECT_FALSE(simulator_interface.subscribe_decoded_field(SimulatorAddress(0x5678, 2)));
+}
+
 TEST_F(DcsBiosProtocolTestFixture, debug_print_format)
 {
     // Send a single message from mock DCS that contains updates for multiple IDs.
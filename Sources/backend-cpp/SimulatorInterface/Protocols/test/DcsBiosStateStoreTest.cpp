@@ -0,0 +1,66 @@
+// Copyright 2026 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "SimulatorInterface/Protocols/DcsBiosStateStore.h"
+
+namespace test
+{
+TEST(DcsBiosStateStoreTest, empty_on_construction)
+{
+    DcsBiosStateStore store;
+    EXPECT_EQ(0, store.size());
+    EXPECT_FALSE(store.contains(0x1000));
+    EXPECT_FALSE(store.get(0x1000).has_value());
+}
+
+TEST(DcsBiosStateStoreTest, set_reports_new_or_changed_data)
+{
+    DcsBiosStateStore store;
+    EXPECT_TRUE(store.set(0x1000, 0x1234));
+    EXPECT_FALSE(store.set(0x1000, 0x1234));
+    EXPECT_TRUE(store.set(0x1000, 0x0000));
+    EXPECT_EQ(0x0000, store.get(0x1000).value());
+    EXPECT_EQ(1, store.size());
+
+    // A value of zero received at a new address is still new data.
+    EXPECT_TRUE(store.set(0x2000, 0x0000));
+    EXPECT_EQ(2, store.size());
+}
+
+TEST(DcsBiosStateStoreTest, ignore_addresses_outside_address_space)
+{
+    DcsBiosStateStore store;
+    EXPECT_TRUE(store.set(0xFFFF, 0x0001));
+    EXPECT_FALSE(store.set(DcsBiosStateStore::ADDRESS_SPACE_SIZE, 0x0001));
+    EXPECT_FALSE(store.contains(DcsBiosStateStore::ADDRESS_SPACE_SIZE));
+    EXPECT_EQ(1, store.size());
+}
+
+TEST(DcsBiosStateStoreTest, clear_resets_validity)
+{
+    DcsBiosStateStore store;
+    store.set(0x1000, 0x1234);
+    store.set(0x2000, 0x5678);
+    store.clear();
+    EXPECT_EQ(0, store.size());
+    EXPECT_FALSE(store.contains(0x1000));
+
+    // Receiving the previously stored value after a clear is reported as new data.
+    EXPECT_TRUE(store.set(0x1000, 0x1234));
+    EXPECT_EQ(0x1234, store.get(0x1000).value());
+}
+
+TEST(DcsBiosStateStoreTest, for_each_visits_data_in_address_order)
+{
+    DcsBiosStateStore store;
+    store.set(0x740C, 0x0200);
+    store.set(0x0008, 0x726F);
+    store.set(0x0402, 0x3031);
+    std::vector<std::pair<unsigned int, unsigned int>> visited;
+    store.for_each([&visited](unsigned int address, unsigned int data) { visited.emplace_back(address, data); });
+    const std::vector<std::pair<unsigned int, unsigned int>> expected = {
+        {0x0008, 0x726F}, {0x0402, 0x3031}, {0x740C, 0x0200}};
+    EXPECT_EQ(expected, visited);
+}
+} // namespace test
@@ -155,4 +155,33 @@ TEST(DcsBiosStreamParserTest, ResetCurrentFrameDataWithNextFrame)
     EXPECT_EQ(data_by_address[0x740C], 0x0200);
     EXPECT_EQ(stored_data_two[0xFFFE], 0x0000);
 }
+
+TEST(DcsBiosStreamParserTest, ReportOnlyChangedAddresses)
+{
+    // clang-format off
+    const char sample_stream_one[] = {0x55, 0x55, 0x55, 0x55,                          // Sync frame
+                                      0x02, 0x04, 0x04, 0x00, 0x31, 0x30, 0x2E, 0x30,  // Addr 0x0402 (4 bytes)
+                                      (char)0xFE, (char)0xFF, 0x02, 0x00, 0x00, 0x00}; // End of frame
+    const char sample_stream_two[] = {0x55, 0x55, 0x55, 0x55,                          // Sync frame
+                                      0x02, 0x04, 0x04, 0x00, 0x31, 0x30, 0x2F, 0x30,  // Addr 0x0402 (4 bytes)
+                                      (char)0xFE, (char)0xFF, 0x02, 0x00, 0x00, 0x00}; // End of frame
+    // clang-format on
+    std::unordered_map<unsigned int, unsigned int> data_by_address;
+    std::vector<unsigned int> changed_addresses;
+    DcsBiosStreamParser parser;
+
+    // All addresses are reported when first received.
+    for (int i = 0; i < SIZE_OF(sample_stream_one); i++) {
+        parser.processByte(sample_stream_one[i], data_by_address, &changed_addresses);
+    }
+    EXPECT_EQ(std::vector<unsigned int>({0x0402, 0x0404, 0xFFFE}), changed_addresses);
+
+    // Only the address with a different value is reported when received again.
+    changed_addresses.clear();
+    for (int i = 0; i < SIZE_OF(sample_stream_two); i++) {
+        parser.processByte(sample_stream_two[i], data_by_address, &changed_addresses);
+    }
+    EXPECT_EQ(std::vector<unsigned int>({0x0404}), changed_addresses);
+    EXPECT_EQ(data_by_address[0x0404], 0x302F);
+}
 } // namespace test
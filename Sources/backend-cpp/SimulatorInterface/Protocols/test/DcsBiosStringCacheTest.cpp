@@ -0,0 +1,84 @@
+// Copyright 2026 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "SimulatorInterface/Protocols/DcsBiosStringCache.h"
+
+namespace test
+{
+static DcsBiosStateStore make_state(std::initializer_list<std::pair<unsigned int, unsigned int>> data_by_address)
+{
+    DcsBiosStateStore state;
+    for (const auto &[address, data] : data_by_address) {
+        state.set(address, data);
+    }
+    return state;
+}
+
+TEST(DcsBiosStringCacheTest, no_value_before_start_address_received)
+{
+    const DcsBiosStateStore data_by_address = make_state({{0x1002, 0x4443}});
+    DcsBiosStringCache cache;
+    EXPECT_FALSE(cache.get(SimulatorAddress(0x1000, 4), data_by_address).has_value());
+    EXPECT_FALSE(cache.get(SimulatorAddress(0x1000), data_by_address).has_value());
+}
+
+TEST(DcsBiosStringCacheTest, assemble_string_to_terminator)
+{
+    // Characters are stored little-endian within each 16-bit word.
+    const DcsBiosStateStore data_by_address = make_state({{0x1000, 0x4241}, {0x1002, 0x0043}, {0x1004, 0x4645}});
+    DcsBiosStringCache cache;
+    EXPECT_EQ("ABC", cache.get(SimulatorAddress(0x1000, 6), data_by_address).value());
+    EXPECT_EQ("AB", cache.get(SimulatorAddress(0x1000, 2), data_by_address).value());
+    EXPECT_EQ(2, cache.num_entries());
+}
+
+TEST(DcsBiosStringCacheTest, skip_words_not_received)
+{
+    const DcsBiosStateStore data_by_address = make_state({{0x1000, 0x4241}, {0x1004, 0x4645}});
+    DcsBiosStringCache cache;
+    EXPECT_EQ("ABEF", cache.get(SimulatorAddress(0x1000, 6), data_by_address).value());
+}
+
+TEST(DcsBiosStringCacheTest, integer_as_string)
+{
+    const DcsBiosStateStore data_by_address = make_state({{0x1000, 0x0A05}});
+    DcsBiosStringCache cache;
+    EXPECT_EQ("5", cache.get(SimulatorAddress(0x1000, 0x00FF, 0), data_by_address).value());
+    EXPECT_EQ("10", cache.get(SimulatorAddress(0x1000, 0xFF00, 8), data_by_address).value());
+}
+
+TEST(DcsBiosStringCacheTest, reassemble_only_when_dirty)
+{
+    DcsBiosStateStore data_by_address = make_state({{0x1000, 0x4241}, {0x1002, 0x4443}});
+    DcsBiosStringCache cache;
+    const SimulatorAddress address(0x1000, 4);
+    EXPECT_EQ("ABCD", cache.get(address, data_by_address).value());
+
+    // Cached value is returned until a word in the range of the string is marked dirty.
+    data_by_address.set(0x1002, 0x5A59);
+    EXPECT_EQ("ABCD", cache.get(address, data_by_address).value());
+    cache.mark_dirty({0x2000});
+    EXPECT_EQ("ABCD", cache.get(address, data_by_address).value());
+    cache.mark_dirty({0x1002});
+    EXPECT_EQ("ABYZ", cache.get(address, data_by_address).value());
+
+    data_by_address.clear();
+    cache.mark_all_dirty();
+    EXPECT_FALSE(cache.get(address, data_by_address).has_value());
+}
+
+TEST(DcsBiosStringCacheTest, mark_dirty_from_first_index)
+{
+    DcsBiosStateStore data_by_address = make_state({{0x1000, 0x4241}});
+    DcsBiosStringCache cache;
+    const SimulatorAddress address(0x1000, 2);
+    EXPECT_EQ("AB", cache.get(address, data_by_address).value());
+
+    data_by_address.set(0x1000, 0x4443);
+    cache.mark_dirty({0x1000, 0x2000}, 1);
+    EXPECT_EQ("AB", cache.get(address, data_by_address).value());
+    cache.mark_dirty({0x1000, 0x2000}, 0);
+    EXPECT_EQ("CD", cache.get(address, data_by_address).value());
+}
+} // namespace test
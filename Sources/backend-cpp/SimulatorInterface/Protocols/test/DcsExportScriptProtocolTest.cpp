@@ -89,6 +89,20 @@ TEST_F(DcsExportScriptProtocolTestFixture, update_simulator_state_handle_newline
     EXPECT_EQ("4", simulator_interface.get_string_at_addr(2027).value());
 }
 
+TEST_F(DcsExportScriptProtocolTestFixture, update_simulator_state_with_signed_or_padded_ids)
+{
+    // IDs are parsed as by std::stoi, allowing a plus sign and surrounding spaces.
+    std::string mock_dcs_message = "header*+761=1: 765 =2.00:2026  =TEXT_STR:+-2027=4:27a=5";
+    mock_dcs.send_string(mock_dcs_message);
+    simulator_interface.update_simulator_state();
+
+    EXPECT_EQ("1", simulator_interface.get_string_at_addr(761).value());
+    EXPECT_EQ("2.00", simulator_interface.get_string_at_addr(765).value());
+    EXPECT_EQ("TEXT_STR", simulator_interface.get_string_at_addr(2026).value());
+    EXPECT_FALSE(simulator_interface.get_string_at_addr(2027));
+    EXPECT_FALSE(simulator_interface.get_string_at_addr(27));
+}
+
 TEST_F(DcsExportScriptProtocolTestFixture, update_simulator_state_end_of_mission)
 {
     // Send a single message from mock DCS that contains updates for multiple IDs.
@@ -0,0 +1,119 @@
+// Copyright 2026 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "SimulatorInterface/Protocols/DcsExportScriptStateStore.h"
+
+namespace test
+{
+TEST(DcsExportScriptStateStoreTest, empty_on_construction)
+{
+    DcsExportScriptStateStore store;
+    EXPECT_EQ(0, store.size());
+    EXPECT_FALSE(store.get(761));
+    EXPECT_FALSE(store.get_number(761));
+    EXPECT_FALSE(store.is_dirty(761));
+}
+
+TEST(DcsExportScriptStateStoreTest, set_and_get_dense_ids)
+{
+    DcsExportScriptStateStore store;
+    store.set(761, "1");
+    store.set(2026, "TEXT_STR");
+    EXPECT_EQ(2, store.size());
+    EXPECT_EQ("1", store.get(761).value());
+    EXPECT_EQ("TEXT_STR", store.get(2026).value());
+    EXPECT_FALSE(store.get(762));
+}
+
+TEST(DcsExportScriptStateStoreTest, set_and_get_sparse_ids)
+{
+    DcsExportScriptStateStore store;
+    const int large_id = DcsExportScriptStateStore::DENSE_ID_LIMIT + 12345;
+    store.set(large_id, "2.00");
+    store.set(-5, "neg");
+    EXPECT_EQ("2.00", store.get(large_id).value());
+    EXPECT_EQ("neg", store.get(-5).value());
+    EXPECT_FALSE(store.get(DcsExportScriptStateStore::DENSE_ID_LIMIT));
+}
+
+TEST(DcsExportScriptStateStoreTest, overwrite_short_and_long_values)
+{
+    DcsExportScriptStateStore store;
+    const std::string long_value = "A value which is longer than the inline capacity of a slot";
+    store.set(100, "short");
+    store.set(100, long_value);
+    EXPECT_EQ(long_value, store.get(100).value());
+    store.set(100, "short again");
+    EXPECT_EQ("short again", store.get(100).value());
+    EXPECT_EQ(1, store.size());
+}
+
+TEST(DcsExportScriptStateStoreTest, empty_value_is_stored)
+{
+    DcsExportScriptStateStore store;
+    store.set(100, "");
+    EXPECT_TRUE(store.get(100));
+    EXPECT_EQ("", store.get(100).value());
+}
+
+TEST(DcsExportScriptStateStoreTest, repeated_value_keeps_stored_value)
+{
+    DcsExportScriptStateStore store;
+    const std::string long_value = "A value which is longer than the inline capacity of a slot";
+    store.set(761, long_value);
+    store.set(761, long_value);
+    EXPECT_EQ(long_value, store.get(761).value());
+    EXPECT_EQ(1, store.size());
+}
+
+TEST(DcsExportScriptStateStoreTest, number_parsed_only_while_dirty)
+{
+    DcsExportScriptStateStore store;
+    store.set(761, "2.50");
+    store.set(2026, "TEXT_STR");
+    EXPECT_TRUE(store.is_dirty(761));
+    EXPECT_EQ(Decimal("2.5"), store.get_number(761).value());
+    EXPECT_FALSE(store.is_dirty(761));
+    EXPECT_FALSE(store.get_number(2026));
+    EXPECT_FALSE(store.is_dirty(2026));
+
+    // Receiving the same value again leaves the ID clean.
+    store.set(761, "2.50");
+    EXPECT_FALSE(store.is_dirty(761));
+
+    // A changed value is parsed again when next read.
+    store.set(761, "-1");
+    EXPECT_TRUE(store.is_dirty(761));
+    EXPECT_EQ(Decimal(-1), store.get_number(761).value());
+    store.set(2026, "3");
+    EXPECT_EQ(Decimal(3), store.get_number(2026).value());
+}
+
+TEST(DcsExportScriptStateStoreTest, clear_removes_all_values)
+{
+    DcsExportScriptStateStore store;
+    store.set(761, "1");
+    store.set(20000, "2");
+    store.clear();
+    EXPECT_EQ(0, store.size());
+    EXPECT_FALSE(store.get(761));
+    EXPECT_FALSE(store.get(20000));
+
+    // Store is usable again after being cleared.
+    store.set(761, "3");
+    EXPECT_EQ("3", store.get(761).value());
+}
+
+TEST(DcsExportScriptStateStoreTest, for_each_visits_all_values)
+{
+    DcsExportScriptStateStore store;
+    store.set(761, "1");
+    store.set(20000, "2");
+    std::unordered_map<int, std::string> visited;
+    store.for_each([&visited](const int id, std::string_view value) { visited[id] = std::string(value); });
+    EXPECT_EQ(2, visited.size());
+    EXPECT_EQ("1", visited[761]);
+    EXPECT_EQ("2", visited[20000]);
+}
+} // namespace test
@@ -2,6 +2,7 @@
 
 #include "SimConnectionManager.h"
 
+#include "SimulatorInterface/Protocols/CaptureReplayProtocol.h"
 #include "SimulatorInterface/Protocols/DcsBiosProtocol.h"
 #include "SimulatorInterface/Protocols/DcsExportScriptProtocol.h"
 
@@ -15,6 +16,10 @@ bool SimConnectionManager::is_connected_with_settings(const Protocol protocol,
 
 void SimConnectionManager::connect_to_protocol(const Protocol protocol, const SimulatorConnectionSettings &settings)
 {
+    if (!settings.replay_capture_path.empty()) {
+        connect_to_capture_replay(protocol, settings);
+        return;
+    }
     switch (protocol) {
     case Protocol::DCS_BIOS:
         simulator_interfaces_[protocol] = std::make_unique<DcsBiosProtocol>(settings);
@@ -25,6 +30,20 @@ void SimConnectionManager::connect_to_protocol(const Protocol protocol, const Si
     }
 }
 
+void SimConnectionManager::connect_to_capture_replay(const Protocol protocol,
+                                                     const SimulatorConnectionSettings &settings)
+{
+    switch (protocol) {
+    case Protocol::DCS_BIOS:
+        simulator_interfaces_[protocol] = std::make_unique<CaptureReplayProtocol<DcsBiosProtocol>>(settings, protocol);
+        break;
+    case Protocol::DCS_ExportScript:
+        simulator_interfaces_[protocol] =
+            std::make_unique<CaptureReplayProtocol<DcsExportScriptProtocol>>(settings, protocol);
+        break;
+    }
+}
+
 void SimConnectionManager::disconnect_protocol(const Protocol protocol) { simulator_interfaces_.erase(protocol); }
 
 SimulatorInterface *SimConnectionManager::get_interface(const Protocol protocol)
@@ -20,6 +20,8 @@ class SimConnectionManager
 
     /**
      * @brief Connect to protocol with specified settings. Will overwrite any existing connection to that protocol.
+     *        If the settings name a replay capture file, its recorded datagrams are replayed in place of those received
+     *        from the simulator.
      */
     void connect_to_protocol(const Protocol protocol, const SimulatorConnectionSettings &settings);
 
@@ -39,5 +41,7 @@ class SimConnectionManager
     void update_all();
 
   private:
+    void connect_to_capture_replay(const Protocol protocol, const SimulatorConnectionSettings &settings);
+
     std::unordered_map<Protocol, std::unique_ptr<SimulatorInterface>> simulator_interfaces_;
 };
@@ -14,17 +14,29 @@ SimulatorAddress::SimulatorAddress(unsigned int address, unsigned int max_length
 {
 }
 
-SimulatorInterface::SimulatorInterface(const SimulatorConnectionSettings &settings)
-    : simulator_socket_(settings.ip_address, settings.rx_port, settings.tx_port, settings.multicast_address),
-      connection_settings_(settings)
+SimulatorInterface::SimulatorInterface(const SimulatorConnectionSettings &settings) : connection_settings_(settings)
 {
+    // A replayed capture stands in for the simulator, so its ports are left free for the simulator or another plugin.
+    if (settings.replay_capture_path.empty()) {
+        simulator_socket_ = std::make_unique<UdpSocket>(
+            settings.ip_address, settings.rx_port, settings.tx_port, settings.multicast_address);
+    }
 }
 
 bool SimulatorInterface::connection_settings_match(const SimulatorConnectionSettings &settings) const
 {
     return ((settings.rx_port == connection_settings_.rx_port) && (settings.tx_port == connection_settings_.tx_port) &&
             (settings.ip_address == connection_settings_.ip_address) &&
-            (settings.multicast_address == connection_settings_.multicast_address));
+            (settings.multicast_address == connection_settings_.multicast_address) &&
+            (settings.replay_capture_path == connection_settings_.replay_capture_path) &&
+            (settings.replay_speed == connection_settings_.replay_speed));
 }
 
 std::string SimulatorInterface::get_current_module() const { return current_module_; }
+
+void SimulatorInterface::send_to_simulator(const std::string &message)
+{
+    if (simulator_socket_) {
+        simulator_socket_->send_string(message);
+    }
+}
@@ -7,16 +7,22 @@
 #include "nlohmann/json.hpp"
 using json = nlohmann::json;
 
+#include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
-using SimulatorConnectionSettings = struct {
+struct SimulatorConnectionSettings {
     std::string rx_port;           // UDP port to receive updates from simulator.
     std::string tx_port;           // UDP port to send commands to simulator.
     std::string ip_address;        //  UDP IP address to send commands to simulator (Default is LocalHost).
     std::string multicast_address; //  UDP Multicast address group to join.
+    // Only for replay of a recorded capture:
+    std::string replay_capture_path = ""; // Capture file to replay in place of data received from simulator.
+    double replay_speed = 1.0;            // Multiple of real time to replay at, or 0 to replay as fast as possible.
 };
 
 enum class AddressType { ADDRESS_ONLY, INTEGER, STRING };
@@ -35,10 +41,19 @@ struct SimulatorAddress {
     SimulatorAddress(unsigned int address, unsigned int max_length);
 };
 
+// Value of an INTEGER field subscribed with SimulatorInterface::subscribe_decoded_field(), pushed by the simulator
+// interface each time the data word it is packed in changes.
+struct DecodedField {
+    std::optional<unsigned int> value; // Nullopt until data has been received at the field's address.
+    bool changed = true;               // Set each time the value is pushed, until reset by the subscriber.
+    bool subscribed = true;            // Reset when the simulator interface stops pushing values to the field.
+};
+
 class SimulatorInterface
 {
   public:
     SimulatorInterface(const SimulatorConnectionSettings &settings);
+    virtual ~SimulatorInterface() = default;
 
     /**
      * @brief Checks if the provided connection settings match the internally stored settings.
@@ -81,6 +96,13 @@ class SimulatorInterface
         return get_string_at_addr(SimulatorAddress(address));
     }
 
+    /**
+     * @brief Get the string value of object from current game state without copying it.
+     * @return Optional view of the value is returned if a value has been logged, valid until the next call to
+     * update_simulator_state() or clear_game_state().
+     */
+    virtual std::optional<std::string_view> get_string_view_at_addr(const SimulatorAddress &address) const = 0;
+
     /**
      * @brief Get the value as Decimal of object from current game state.
      * @return Optional value of object is returned if a value has been logged that is a Decimal.
@@ -92,6 +114,26 @@ class SimulatorInterface
         return get_value_at_addr(SimulatorAddress(address));
     }
 
+    /**
+     * @brief Stops pushing values to all subscribed fields.
+     */
+    virtual void clear_decoded_fields() {}
+
+    /**
+     * @brief Subscribes to the value of an INTEGER address, which is decoded and pushed to the subscription once per
+     *        received change of the data word it is packed in, rather than read each time it is needed.
+     * @return Subscribed field, or nullptr if not supported by the protocol.
+     */
+    virtual std::shared_ptr<DecodedField> subscribe_decoded_field(const SimulatorAddress & /*address*/)
+    {
+        return nullptr;
+    }
+
+    /**
+     * @brief Stops pushing values to a field subscribed with subscribe_decoded_field().
+     */
+    virtual void unsubscribe_decoded_field(const std::shared_ptr<DecodedField> & /*field*/) {}
+
     /**
      * @brief For debugging purposes, outputs all logged object key value pairs stored in current game state.
      * @return Json representation of object IDs and their values in current game state.
@@ -99,7 +141,13 @@ class SimulatorInterface
     virtual json get_current_state_as_json() const = 0;
 
   protected:
-    UdpSocket simulator_socket_; // UDP Socket connection for communicating with simulator.
+    /**
+     * @brief Sends a message to the simulator, or discards it if there is no connection to the simulator.
+     */
+    void send_to_simulator(const std::string &message);
+
+    // UDP Socket connection for communicating with simulator, or nullptr when replaying a capture in its place.
+    std::unique_ptr<UdpSocket> simulator_socket_;
     std::string current_module_; // Stores the current module name being used in simulator.
 
   private:
@@ -15,6 +15,10 @@ class SimulatorInterfaceDerivedClass : public SimulatorInterface
     void send_command(const std::string &address, const std::string &value){};
     void send_reset_command(){};
     std::optional<std::string> get_string_at_addr(const SimulatorAddress &address) const { return std::nullopt; }
+    std::optional<std::string_view> get_string_view_at_addr(const SimulatorAddress &address) const
+    {
+        return std::nullopt;
+    }
     std::optional<Decimal> get_value_at_addr(const SimulatorAddress &address) const { return std::nullopt; }
     json get_current_state_as_json() const { return json{}; };
 };
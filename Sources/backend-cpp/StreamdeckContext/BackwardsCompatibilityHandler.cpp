@@ -2,16 +2,13 @@
 
 #include "BackwardsCompatibilityHandler.h"
 
-#include <iostream>
-json backwardsCompatibilityHandler(const json &prevVersionPayload)
+json backwardsCompatibleSettings(const json &prevVersionSettings)
 {
-    json payload = prevVersionPayload;
-    const auto prevSettings = prevVersionPayload["settings"];
-    if (!prevSettings.contains("send_address") && prevSettings.contains("device_id") &&
-        prevSettings.contains("button_id")) {
-        const std::string device_id = prevSettings["device_id"];
-        const std::string button_id = prevSettings["button_id"];
-        payload["settings"]["send_address"] = device_id + "," + button_id;
+    json settings = prevVersionSettings;
+    if (!settings.contains("send_address") && settings.contains("device_id") && settings.contains("button_id")) {
+        const std::string device_id = settings["device_id"];
+        const std::string button_id = settings["button_id"];
+        settings["send_address"] = device_id + "," + button_id;
     }
-    return payload;
+    return settings;
 }
@@ -3,4 +3,8 @@
 #include "nlohmann/json.hpp"
 using json = nlohmann::json;
 
-json backwardsCompatibilityHandler(const json &prevVersionPayload);
+/**
+ * @brief Migrates the settings of a context saved by a previous plugin version to the current settings format.
+ *        Meant to be called once when settings are received, rather than on each event of the context.
+ */
+json backwardsCompatibleSettings(const json &prevVersionSettings);
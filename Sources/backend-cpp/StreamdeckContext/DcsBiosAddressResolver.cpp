@@ -0,0 +1,61 @@
+// Copyright 2026 Charles Tytler
+
+#include "DcsBiosAddressResolver.h"
+
+#include "ElgatoSD/EPLJSONUtils.h"
+
+#include <optional>
+#include <string>
+#include <utility>
+
+namespace
+{
+// Splits a monitored control into its module and identifier. Module names may contain '-' (e.g. "FA-18C_hornet")
+// but DCS-BIOS identifiers do not, so the compare monitor's separator is the last '-'.
+std::optional<std::pair<std::string, std::string>> split_monitor_identifier(const std::string &monitor_identifier)
+{
+    const auto module_separator = monitor_identifier.find("::");
+    if (module_separator != std::string::npos) {
+        return std::make_pair(monitor_identifier.substr(0, module_separator),
+                              monitor_identifier.substr(module_separator + 2));
+    }
+    const auto last_hyphen = monitor_identifier.rfind('-');
+    if (last_hyphen != std::string::npos) {
+        return std::make_pair(monitor_identifier.substr(0, last_hyphen), monitor_identifier.substr(last_hyphen + 1));
+    }
+    return std::nullopt;
+}
+
+void resolve_monitor_address(json &settings, const std::string &monitor, const DcsBiosControlCatalogCache &catalogs)
+{
+    const std::string address_type = EPLJSONUtils::GetStringByName(settings, "dcs_id_" + monitor);
+    if (address_type != "INTEGER" && address_type != "STRING") {
+        return;
+    }
+    const auto module_and_identifier =
+        split_monitor_identifier(EPLJSONUtils::GetStringByName(settings, monitor + "_identifier"));
+    if (!module_and_identifier) {
+        return;
+    }
+    const auto address = catalogs.find_address(module_and_identifier->first, module_and_identifier->second);
+    if (!address) {
+        return;
+    }
+    if (address_type == "INTEGER" && address->type == AddressType::INTEGER) {
+        settings[monitor + "_address"] = address->address;
+        settings[monitor + "_mask"] = address->mask;
+        settings[monitor + "_shift"] = address->shift;
+    } else if (address_type == "STRING" && address->type == AddressType::STRING) {
+        settings[monitor + "_address"] = address->address;
+        settings[monitor + "_max_length"] = address->max_length;
+    }
+}
+} // namespace
+
+json resolveDcsBiosMonitorAddresses(const json &settings, const DcsBiosControlCatalogCache &catalogs)
+{
+    json resolved_settings = settings;
+    resolve_monitor_address(resolved_settings, "string_monitor", catalogs);
+    resolve_monitor_address(resolved_settings, "compare_monitor", catalogs);
+    return resolved_settings;
+}
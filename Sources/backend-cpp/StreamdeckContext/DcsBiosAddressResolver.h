@@ -0,0 +1,18 @@
+// Copyright 2026 Charles Tytler
+
+#pragma once
+
+#include "SimulatorInterface/Protocols/DcsBiosControlCatalogCache.h"
+
+#include "nlohmann/json.hpp"
+using json = nlohmann::json;
+
+/**
+ * @brief Updates the addresses of the DCS-BIOS controls monitored by a context's settings to those of the installed
+ *        DCS-BIOS, so monitors keep working when a DCS-BIOS update moves their controls.
+ *
+ *   The Property Inspector stores each monitored control with its module, as "<module>::<identifier>" for the title
+ *   monitor and "<module>-<identifier>" for the compare monitor, alongside the address it had when it was selected.
+ *   Monitors whose module catalog is not loaded, or whose control is not found, keep their stored address.
+ */
+json resolveDcsBiosMonitorAddresses(const json &settings, const DcsBiosControlCatalogCache &catalogs);
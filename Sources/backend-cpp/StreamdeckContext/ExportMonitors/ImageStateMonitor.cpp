@@ -13,6 +13,8 @@ void ImageStateMonitor::update_settings(const json &settings)
         EPLJSONUtils::GetStringByName(settings, "dcs_id_compare_condition");
     const std::string dcs_id_comparison_value_raw = EPLJSONUtils::GetStringByName(settings, "dcs_id_comparison_value");
 
+    decoded_field_.reset();
+
     const bool compare_monitor_is_populated = !dcs_id_compare_monitor_raw.empty();
     const bool comparison_value_is_populated = is_number(dcs_id_comparison_value_raw);
     settings_are_filled_ = compare_monitor_is_populated && comparison_value_is_populated;
@@ -46,6 +48,15 @@ void ImageStateMonitor::update_settings(const json &settings)
 int ImageStateMonitor::determineContextState(SimulatorInterface *simulator_interface) const
 {
     if (settings_are_filled_) {
+        if (decoded_field_ && decoded_field_->subscribed) {
+            // Only compare again once the simulator interface pushes a changed value.
+            if (decoded_field_->changed) {
+                decoded_field_->changed = false;
+                const auto &maybe_value = decoded_field_->value;
+                decoded_field_state_ = (maybe_value && comparison_is_satisfied(Decimal(maybe_value.value()))) ? 1 : 0;
+            }
+            return decoded_field_state_;
+        }
         const auto maybe_current_game_value = simulator_interface->get_value_at_addr(dcs_id_compare_monitor_);
         if (maybe_current_game_value.has_value()) {
             return comparison_is_satisfied(maybe_current_game_value.value()) ? 1 : 0;
@@ -54,6 +65,22 @@ int ImageStateMonitor::determineContextState(SimulatorInterface *simulator_inter
     return 0;
 }
 
+void ImageStateMonitor::registerDecodedField(SimulatorInterface *simulator_interface)
+{
+    unregisterDecodedField(simulator_interface);
+    if (settings_are_filled_ && dcs_id_compare_monitor_.type == AddressType::INTEGER) {
+        decoded_field_ = simulator_interface->subscribe_decoded_field(dcs_id_compare_monitor_);
+    }
+}
+
+void ImageStateMonitor::unregisterDecodedField(SimulatorInterface *simulator_interface)
+{
+    if (decoded_field_) {
+        simulator_interface->unsubscribe_decoded_field(decoded_field_);
+        decoded_field_.reset();
+    }
+}
+
 bool ImageStateMonitor::comparison_is_satisfied(Decimal current_game_value) const
 {
     bool comparison_result = false;
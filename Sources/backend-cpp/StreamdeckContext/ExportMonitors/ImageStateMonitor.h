@@ -6,7 +6,9 @@
 #include "SimulatorInterface/SimulatorInterface.h"
 #include "Utilities/Decimal.h"
 
+#include <memory>
 #include <optional>
+
 class ImageStateMonitor
 {
   public:
@@ -28,6 +30,21 @@ class ImageStateMonitor
      */
     int determineContextState(SimulatorInterface *simulator_interface) const;
 
+    /**
+     * @brief Subscribes to the monitored address being decoded by the simulator interface as its data is received.
+     *
+     * @param simulator_interface Interface which the monitor will request the current game state from.
+     */
+    void registerDecodedField(SimulatorInterface *simulator_interface);
+
+    /**
+     * @brief Unsubscribes from the monitored address registered with registerDecodedField, if any. Must be called
+     *        before the monitor's settings are updated.
+     *
+     * @param simulator_interface Interface the monitored address was registered with.
+     */
+    void unregisterDecodedField(SimulatorInterface *simulator_interface);
+
   private:
     enum class Comparison { GREATER_THAN, EQUAL_TO, LESS_THAN };
 
@@ -45,4 +62,6 @@ class ImageStateMonitor
     SimulatorAddress dcs_id_compare_monitor_{0};                     // Simulator address to monitor for state change.
     Comparison dcs_id_compare_condition_ = Comparison::GREATER_THAN; // Comparison to use for DCS ID compare monitor.
     Decimal dcs_id_comparison_value_; // Value to compare DCS ID compare monitor value to.
+    std::shared_ptr<DecodedField> decoded_field_; // Populated if the simulator pushes the monitored address' value.
+    mutable int decoded_field_state_ = 0;         // State determined from the most recently pushed value.
 };
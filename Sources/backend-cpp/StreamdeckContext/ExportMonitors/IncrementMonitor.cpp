@@ -4,6 +4,9 @@
 
 #include "Utilities/StringUtilities.h"
 
+#include <algorithm>
+#include <iterator>
+
 IncrementMonitor::IncrementMonitor(const json &settings) { update_settings(settings); }
 
 void IncrementMonitor::update_settings(const json &settings)
@@ -16,25 +19,69 @@ void IncrementMonitor::update_settings(const json &settings)
 
     // Update internal settings of class instance.
     if (increment_monitor_is_set_) {
-        dcs_id_increment_monitor_ = std::stoi(dcs_id_increment_monitor_raw);
+        const int dcs_id_increment_monitor = std::stoi(dcs_id_increment_monitor_raw);
+        if (dcs_id_increment_monitor != dcs_id_increment_monitor_) {
+            // Commands to a different DCS ID will never be confirmed.
+            pending_commands_.clear();
+            last_game_value_.reset();
+        }
+        dcs_id_increment_monitor_ = dcs_id_increment_monitor;
+    } else {
+        pending_commands_.clear();
     }
 }
 
-void IncrementMonitor::update(SimulatorInterface *simulator_interface)
+void IncrementMonitor::update(SimulatorInterface *simulator_interface, const std::chrono::steady_clock::time_point now)
 {
     if (increment_monitor_is_set_) {
         const std::optional<Decimal> maybe_current_game_value =
             simulator_interface->get_value_at_addr(dcs_id_increment_monitor_);
+        const bool game_value_changed =
+            maybe_current_game_value.has_value() && maybe_current_game_value != last_game_value_;
+        if (maybe_current_game_value.has_value()) {
+            last_game_value_ = maybe_current_game_value;
+        }
+
+        if (!pending_commands_.empty()) {
+            if (game_value_changed) {
+                // Confirm the oldest command with the newly reported value, and all commands before it. An unchanged
+                // value may predate the commands, so it confirms none of them.
+                const auto confirmed_command = std::find_if(
+                    pending_commands_.begin(), pending_commands_.end(), [&](const PendingCommand &command) {
+                        return command.value == maybe_current_game_value.value();
+                    });
+                if (confirmed_command != pending_commands_.end()) {
+                    pending_commands_.erase(pending_commands_.begin(), std::next(confirmed_command));
+                }
+            }
+            if (!pending_commands_.empty() && (now - pending_commands_.front().sent_time) > PREDICTION_TIMEOUT) {
+                pending_commands_.clear();
+            }
+            if (!pending_commands_.empty()) {
+                // Game state has not caught up with the commands, so keep the predicted value.
+                return;
+            }
+        }
+
         if (maybe_current_game_value.has_value()) {
             current_increment_value_ = maybe_current_game_value.value();
         }
     }
 }
 
+std::optional<Decimal> IncrementMonitor::predicted_value() const
+{
+    if (pending_commands_.empty()) {
+        return std::nullopt;
+    }
+    return current_increment_value_;
+}
+
 Decimal IncrementMonitor::get_increment_after_command(const Decimal &delta_cmd,
                                                       const Decimal &increment_min,
                                                       const Decimal &increment_max,
-                                                      const bool cycling_is_allowed)
+                                                      const bool cycling_is_allowed,
+                                                      const std::chrono::steady_clock::time_point now)
 {
     if (increment_monitor_is_set_) {
         current_increment_value_ += delta_cmd;
@@ -44,6 +91,11 @@ Decimal IncrementMonitor::get_increment_after_command(const Decimal &delta_cmd,
         } else if (current_increment_value_ > increment_max) {
             current_increment_value_ = cycling_is_allowed ? increment_min : increment_max;
         }
+
+        if (pending_commands_.size() >= MAX_PENDING_COMMANDS) {
+            pending_commands_.pop_front();
+        }
+        pending_commands_.push_back({current_increment_value_, now});
         return current_increment_value_;
     } else {
         return Decimal("0");
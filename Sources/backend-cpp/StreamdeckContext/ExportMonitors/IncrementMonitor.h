@@ -6,11 +6,28 @@
 #include "SimulatorInterface/SimulatorInterface.h"
 #include "Utilities/Decimal.h"
 
+#include <chrono>
+#include <deque>
+#include <optional>
 #include <string>
 
+/**
+ * @brief Tracks the value of an incremental switch, predicting the value from the commands sent to the simulator.
+ *
+ *   A command takes at least one round-trip before the simulator reports its result, so each commanded value is kept
+ *   in a ledger of pending commands and the increment continues from the predicted value rather than the older game
+ *   state. A command is confirmed once the simulator reports a new value equal to it (confirming any earlier commands
+ *   too). Only a change of the reported value confirms commands, matched from the oldest command, so a stale value
+ *   which happens to equal a later command does not confirm it. If the oldest pending command is not confirmed within
+ *   PREDICTION_TIMEOUT, e.g. because the simulator limited or ignored it, the prediction is dropped in favor of the
+ *   game state.
+ */
 class IncrementMonitor
 {
   public:
+    static constexpr std::chrono::milliseconds PREDICTION_TIMEOUT{1000};
+    static constexpr size_t MAX_PENDING_COMMANDS = 64;
+
     IncrementMonitor() = default;
     IncrementMonitor(const json &settings);
 
@@ -22,11 +39,18 @@ class IncrementMonitor
     void update_settings(const json &settings);
 
     /**
-     * @brief Keeps the increment status up to date with game state.
+     * @brief Keeps the increment status up to date with game state, reconciling pending commands with it.
      *
      * @param simulator_interface Interface to request current game state from.
+     * @param now Current time, compared to the time pending commands were sent.
      */
-    void update(SimulatorInterface *simulator_interface);
+    void update(SimulatorInterface *simulator_interface,
+                const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+
+    /**
+     * @brief Get the predicted value of the increment while commands are pending, or nullopt if none are pending.
+     */
+    std::optional<Decimal> predicted_value() const;
 
     /**
      * @brief Applies a commanded delta to the internal increment and returns the new current value.
@@ -36,12 +60,15 @@ class IncrementMonitor
      * @param increment_max The maximum value to clamp the increment to.
      * @param cycling_is_allowed Flag to indicate that if the min/max is reached, the increment should wrap around to
      * other end of range.
+     * @param now Time the command is sent, recorded in the ledger of pending commands.
      * @return Updated current value of the increment.
      */
     Decimal get_increment_after_command(const Decimal &delta_cmd,
                                         const Decimal &increment_min,
                                         const Decimal &increment_max,
-                                        const bool cycling_is_allowed);
+                                        const bool cycling_is_allowed,
+                                        const std::chrono::steady_clock::time_point now =
+                                            std::chrono::steady_clock::now());
 
   private:
     // Status of user-filled fields.
@@ -51,4 +78,11 @@ class IncrementMonitor
 
     // Stored settings extracted from user-filled fields.
     int dcs_id_increment_monitor_ = 0; // DCS ID to monitor for updating current increment value from game state.
+
+    struct PendingCommand {
+        Decimal value;                                   // Value commanded.
+        std::chrono::steady_clock::time_point sent_time; // Time the command was sent.
+    };
+    std::deque<PendingCommand> pending_commands_; // Commands not yet confirmed by game state, oldest first.
+    std::optional<Decimal> last_game_value_;      // Game value most recently reported, to detect when it changes.
 };
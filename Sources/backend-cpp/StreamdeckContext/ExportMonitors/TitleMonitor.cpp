@@ -17,6 +17,8 @@ void TitleMonitor::update_settings(const json &settings)
     string_monitor_mapping_raw << EPLJSONUtils::GetStringByName(settings, "string_monitor_mapping");
 
     string_monitor_is_set_ = !dcs_id_string_monitor_raw.empty();
+    decoded_field_.reset();
+    last_title_conversion_valid_ = false;
 
     if (string_monitor_is_set_) {
         if (is_integer(dcs_id_string_monitor_raw)) {
@@ -51,16 +53,48 @@ std::string TitleMonitor::determineTitle(SimulatorInterface *simulator_interface
     std::string updated_title = "";
 
     if (string_monitor_is_set_) {
-        const std::optional<std::string> maybe_current_game_value =
-            simulator_interface->get_string_at_addr(dcs_id_string_monitor_);
-        if (maybe_current_game_value.has_value()) {
-            updated_title = convertGameStateToTitle(maybe_current_game_value.value());
+        if (decoded_field_ && decoded_field_->subscribed) {
+            // Only convert again once the simulator interface pushes a changed value.
+            if (decoded_field_->changed) {
+                decoded_field_->changed = false;
+                const auto &maybe_value = decoded_field_->value;
+                last_title_ = maybe_value ? convertGameStateToTitle(Decimal(maybe_value.value()).str()) : "";
+                last_title_conversion_valid_ = false; // Title is not converted from last_game_value_.
+            }
+            updated_title = last_title_;
+        } else {
+            const auto maybe_current_game_value = simulator_interface->get_string_view_at_addr(dcs_id_string_monitor_);
+            if (maybe_current_game_value.has_value()) {
+                // Titles change far less often than they are polled, so only convert on a change of game value.
+                if (!last_title_conversion_valid_ || maybe_current_game_value.value() != last_game_value_) {
+                    last_game_value_.assign(maybe_current_game_value.value());
+                    last_title_ = convertGameStateToTitle(last_game_value_);
+                    last_title_conversion_valid_ = true;
+                }
+                updated_title = last_title_;
+            }
         }
     }
 
     return updated_title;
 }
 
+void TitleMonitor::registerDecodedField(SimulatorInterface *simulator_interface)
+{
+    unregisterDecodedField(simulator_interface);
+    if (string_monitor_is_set_ && dcs_id_string_monitor_.type == AddressType::INTEGER) {
+        decoded_field_ = simulator_interface->subscribe_decoded_field(dcs_id_string_monitor_);
+    }
+}
+
+void TitleMonitor::unregisterDecodedField(SimulatorInterface *simulator_interface)
+{
+    if (decoded_field_) {
+        simulator_interface->unsubscribe_decoded_field(decoded_field_);
+        decoded_field_.reset();
+    }
+}
+
 std::string TitleMonitor::convertGameStateToTitle(const std::string &current_game_value)
 {
     std::string title;
@@ -5,6 +5,8 @@
 #include "ElgatoSD/EPLJSONUtils.h"
 #include "SimulatorInterface/SimulatorInterface.h"
 
+#include <memory>
+#include <optional>
 #include <string>
 
 class TitleMonitor
@@ -28,6 +30,21 @@ class TitleMonitor
      */
     std::string determineTitle(SimulatorInterface *simulator_interface);
 
+    /**
+     * @brief Subscribes to the monitored address being decoded by the simulator interface as its data is received.
+     *
+     * @param simulator_interface Interface which the monitor will request the current game state from.
+     */
+    void registerDecodedField(SimulatorInterface *simulator_interface);
+
+    /**
+     * @brief Unsubscribes from the monitored address registered with registerDecodedField, if any. Must be called
+     *        before the monitor's settings are updated.
+     *
+     * @param simulator_interface Interface the monitored address was registered with.
+     */
+    void unregisterDecodedField(SimulatorInterface *simulator_interface);
+
   private:
     /**
      * @brief Converts game string value to a title according to settings.
@@ -43,4 +60,10 @@ class TitleMonitor
     bool string_monitor_passthrough_ = true;    // Flag set by user to passthrough string to title unaltered.
     std::unordered_map<std::string, std::string>
         string_monitor_mapping_; // Map of received values to title text to display on context.
+    std::shared_ptr<DecodedField> decoded_field_; // Populated if the simulator pushes the monitored address' value.
+
+    // Most recent conversion of a game value to a title.
+    bool last_title_conversion_valid_ = false;
+    std::string last_game_value_;
+    std::string last_title_;
 };
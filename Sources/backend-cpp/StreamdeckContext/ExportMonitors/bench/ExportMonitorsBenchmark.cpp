@@ -0,0 +1,83 @@
+// Copyright 2026 Charles Tytler
+
+#include "benchmark/benchmark.h"
+
+#include "SimulatorInterface/Protocols/DcsExportScriptProtocol.h"
+#include "StreamdeckContext/ExportMonitors/EncoderDisplayMonitor.h"
+#include "StreamdeckContext/ExportMonitors/ImageStateMonitor.h"
+#include "StreamdeckContext/ExportMonitors/TitleMonitor.h"
+#include "StreamdeckContext/SendActions/EncoderAction.h"
+
+#include <string>
+
+namespace bench
+{
+
+/**
+ * @brief ExportScript interface holding values for the monitored IDs, which alternate between two sets of values.
+ */
+class MonitoredGameState
+{
+  public:
+    MonitoredGameState() : simulator_interface({"1958", "1959", "127.0.0.1", ""}) { update(); }
+
+    void update()
+    {
+        const std::string datagram = (frame_++ % 2 == 0) ? "File*123=0.25:2026=0.1:100=50.0"
+                                                         : "File*123=1.75:2026=0.2:100=51.0";
+        simulator_interface.handle_datagram(datagram.data(), datagram.size());
+    }
+
+    DcsExportScriptProtocol simulator_interface;
+
+  private:
+    int frame_ = 0;
+};
+
+static void ImageStateMonitor_DetermineContextState(benchmark::State &state)
+{
+    MonitoredGameState game_state;
+    ImageStateMonitor monitor({{"dcs_id_compare_monitor", "123"},
+                               {"dcs_id_compare_condition", "GREATER_THAN"},
+                               {"dcs_id_comparison_value", "1.5"}});
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(monitor.determineContextState(&game_state.simulator_interface));
+    }
+}
+BENCHMARK(ImageStateMonitor_DetermineContextState);
+
+static void TitleMonitor_DetermineTitle(benchmark::State &state)
+{
+    MonitoredGameState game_state;
+    TitleMonitor monitor({{"dcs_id_string_monitor", "2026"},
+                          {"string_monitor_vertical_spacing", "1"},
+                          {"string_monitor_mapping", "0.0=OFF,0.1=STBY,0.2=ON"},
+                          {"string_monitor_passthrough_check", false}});
+    // Alternate game state between evaluations when requested, so that the title must be converted each time.
+    const bool changing_value = state.range(0) != 0;
+    for (auto _ : state) {
+        if (changing_value) {
+            game_state.update();
+        }
+        benchmark::DoNotOptimize(monitor.determineTitle(&game_state.simulator_interface));
+    }
+}
+BENCHMARK(TitleMonitor_DetermineTitle)->ArgName("changing")->Arg(0)->Arg(1);
+
+static void EncoderDisplayMonitor_DetermineEncoderDisplay(benchmark::State &state)
+{
+    MonitoredGameState game_state;
+    const json settings = {{"dcs_id_increment_monitor", "100"},
+                           {"increment_step_size", "1"},
+                           {"increment_min", "0"},
+                           {"increment_max", "100"}};
+    const EncoderDisplayMonitor monitor(settings);
+    EncoderAction encoder_action;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            monitor.determineEncoderDisplay(&encoder_action, &game_state.simulator_interface, settings));
+    }
+}
+BENCHMARK(EncoderDisplayMonitor_DetermineEncoderDisplay);
+
+} // namespace bench
@@ -189,4 +189,53 @@ TEST_F(ImageStateMonitorTestFixture, InvalidComparisonValueSetting)
     EXPECT_EQ(0, context_with_flot_id.determineContextState(simulator_interface));
 }
 
+TEST(ImageStateMonitorTest, RegisteredDecodedFieldOfDcsBiosInteger)
+{
+    SimulatorConnectionSettings connection_settings{"1908", "1909", "127.0.0.1", ""};
+    UdpSocket mock_dcs(connection_settings.ip_address, connection_settings.tx_port, connection_settings.rx_port);
+    SimConnectionManager sim_connection_manager;
+    sim_connection_manager.connect_to_protocol(Protocol::DCS_BIOS, connection_settings);
+    SimulatorInterface *simulator_interface = sim_connection_manager.get_interface(Protocol::DCS_BIOS);
+    (void)mock_dcs.receive_stream();
+
+    ImageStateMonitor monitor{json{{"dcs_id_compare_monitor", "INTEGER"},
+                                   {"compare_monitor_address", 0x1000},
+                                   {"compare_monitor_mask", 0x0F00},
+                                   {"compare_monitor_shift", 8},
+                                   {"dcs_id_compare_condition", "EQUAL_TO"},
+                                   {"dcs_id_comparison_value", "2"}}};
+    monitor.registerDecodedField(simulator_interface);
+
+    // clang-format off
+    const char mock_dcs_message[] = {0x55, 0x55, 0x55, 0x55,                          // Sync frame
+                                     0x00, 0x10, 0x02, 0x00, 0x01, 0x02,              // Addr 0x1000 (2 bytes)
+                                     (char)0xFE, (char)0xFF, 0x02, 0x00, 0x00, 0x00}; // End of frame
+    // clang-format on
+    mock_dcs.send_bytes(mock_dcs_message, sizeof(mock_dcs_message));
+    simulator_interface->update_simulator_state();
+    EXPECT_EQ(1, monitor.determineContextState(simulator_interface));
+
+    // Monitor continues to read the address after the decoded fields of the simulator interface are cleared.
+    simulator_interface->clear_decoded_fields();
+    EXPECT_EQ(1, monitor.determineContextState(simulator_interface));
+
+    // Changed values pushed to a subscribed monitor are compared again.
+    monitor.registerDecodedField(simulator_interface);
+    EXPECT_EQ(1, monitor.determineContextState(simulator_interface));
+    // clang-format off
+    const char changed_dcs_message[] = {0x55, 0x55, 0x55, 0x55,                          // Sync frame
+                                        0x00, 0x10, 0x02, 0x00, 0x01, 0x03,              // Addr 0x1000 (2 bytes)
+                                        (char)0xFE, (char)0xFF, 0x02, 0x00, 0x00, 0x00}; // End of frame
+    // clang-format on
+    mock_dcs.send_bytes(changed_dcs_message, sizeof(changed_dcs_message));
+    simulator_interface->update_simulator_state();
+    EXPECT_EQ(0, monitor.determineContextState(simulator_interface));
+
+    // Monitor continues to read the address once unregistered.
+    monitor.unregisterDecodedField(simulator_interface);
+    mock_dcs.send_bytes(mock_dcs_message, sizeof(mock_dcs_message));
+    simulator_interface->update_simulator_state();
+    EXPECT_EQ(1, monitor.determineContextState(simulator_interface));
+}
+
 } // namespace test
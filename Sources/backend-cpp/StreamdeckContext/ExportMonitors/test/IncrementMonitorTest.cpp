@@ -233,4 +233,113 @@ TEST_F(IncrementMonitorTestFixture, IncrementBeyondMinCyclingOn)
     EXPECT_EQ(Decimal("1.0"), monitor.get_increment_after_command(delta, min, max, cycling_is_allowed));
 }
 
+TEST_F(IncrementMonitorTestFixture, IncrementFromPredictedValueBeforeGameStateCatchesUp)
+{
+    IncrementMonitor monitor{{{"dcs_id_increment_monitor", monitor_id_value}}};
+    set_current_dcs_id_value("0");
+    monitor.update(simulator_interface);
+    const Decimal delta{"0.1"};
+    const Decimal min{"-1"};
+    const Decimal max{"1"};
+    const bool cycling_is_allowed = false;
+    EXPECT_FALSE(monitor.predicted_value());
+
+    // Game state still reports 0 after each command, but no step is lost.
+    EXPECT_EQ(Decimal("0.1"), monitor.get_increment_after_command(delta, min, max, cycling_is_allowed));
+    monitor.update(simulator_interface);
+    EXPECT_EQ(Decimal("0.2"), monitor.get_increment_after_command(delta, min, max, cycling_is_allowed));
+    monitor.update(simulator_interface);
+    EXPECT_EQ(Decimal("0.2"), monitor.predicted_value());
+}
+
+TEST_F(IncrementMonitorTestFixture, GameStateConfirmsPendingCommands)
+{
+    IncrementMonitor monitor{{{"dcs_id_increment_monitor", monitor_id_value}}};
+    const Decimal delta{"0.1"};
+    const Decimal min{"-1"};
+    const Decimal max{"1"};
+    const bool cycling_is_allowed = false;
+    monitor.get_increment_after_command(delta, min, max, cycling_is_allowed);
+    monitor.get_increment_after_command(delta, min, max, cycling_is_allowed);
+    monitor.get_increment_after_command(delta, min, max, cycling_is_allowed);
+
+    // Confirming the first command keeps the prediction of the later ones.
+    set_current_dcs_id_value("0.1");
+    monitor.update(simulator_interface);
+    EXPECT_EQ(Decimal("0.3"), monitor.predicted_value());
+
+    // Game state may skip commands, confirming all commands before the reported one.
+    set_current_dcs_id_value("0.3");
+    monitor.update(simulator_interface);
+    EXPECT_FALSE(monitor.predicted_value());
+    EXPECT_EQ(Decimal("0.4"), monitor.get_increment_after_command(delta, min, max, cycling_is_allowed));
+}
+
+TEST_F(IncrementMonitorTestFixture, StaleGameValueDoesNotConfirmLaterCommand)
+{
+    IncrementMonitor monitor{{{"dcs_id_increment_monitor", monitor_id_value}}};
+    set_current_dcs_id_value("0.5");
+    monitor.update(simulator_interface);
+    const Decimal min{"-1"};
+    const Decimal max{"1"};
+    const bool cycling_is_allowed = false;
+    monitor.get_increment_after_command(Decimal("0.1"), min, max, cycling_is_allowed);
+    monitor.get_increment_after_command(Decimal("-0.1"), min, max, cycling_is_allowed);
+
+    // Game state still reports the value from before the commands, which equals the last command.
+    monitor.update(simulator_interface);
+    EXPECT_EQ(Decimal("0.5"), monitor.predicted_value());
+
+    set_current_dcs_id_value("0.6");
+    monitor.update(simulator_interface);
+    EXPECT_EQ(Decimal("0.5"), monitor.predicted_value());
+    set_current_dcs_id_value("0.5");
+    monitor.update(simulator_interface);
+    EXPECT_FALSE(monitor.predicted_value());
+}
+
+TEST_F(IncrementMonitorTestFixture, RepeatedValueConfirmsOldestCommand)
+{
+    IncrementMonitor monitor{{{"dcs_id_increment_monitor", monitor_id_value}}};
+    set_current_dcs_id_value("0");
+    monitor.update(simulator_interface);
+    const Decimal min{"-1"};
+    const Decimal max{"1"};
+    const bool cycling_is_allowed = false;
+    monitor.get_increment_after_command(Decimal("0.1"), min, max, cycling_is_allowed);
+    monitor.get_increment_after_command(Decimal("0.1"), min, max, cycling_is_allowed);
+    monitor.get_increment_after_command(Decimal("-0.1"), min, max, cycling_is_allowed);
+
+    // The first command is confirmed, while the commands after it remain pending.
+    set_current_dcs_id_value("0.1");
+    monitor.update(simulator_interface);
+    EXPECT_EQ(Decimal("0.1"), monitor.predicted_value());
+    set_current_dcs_id_value("0.2");
+    monitor.update(simulator_interface);
+    EXPECT_EQ(Decimal("0.1"), monitor.predicted_value());
+    set_current_dcs_id_value("0.1");
+    monitor.update(simulator_interface);
+    EXPECT_FALSE(monitor.predicted_value());
+}
+
+TEST_F(IncrementMonitorTestFixture, UnconfirmedPredictionTimesOut)
+{
+    IncrementMonitor monitor{{{"dcs_id_increment_monitor", monitor_id_value}}};
+    set_current_dcs_id_value("0.5");
+    monitor.update(simulator_interface);
+    const Decimal delta{"0.1"};
+    const Decimal min{"-1"};
+    const Decimal max{"1"};
+    const bool cycling_is_allowed = false;
+    const auto sent_time = std::chrono::steady_clock::now();
+    EXPECT_EQ(Decimal("0.6"), monitor.get_increment_after_command(delta, min, max, cycling_is_allowed, sent_time));
+
+    // Simulator did not apply the command, so game state is used once the prediction times out.
+    monitor.update(simulator_interface, sent_time + IncrementMonitor::PREDICTION_TIMEOUT);
+    EXPECT_EQ(Decimal("0.6"), monitor.predicted_value());
+    monitor.update(simulator_interface, sent_time + IncrementMonitor::PREDICTION_TIMEOUT * 2);
+    EXPECT_FALSE(monitor.predicted_value());
+    EXPECT_EQ(Decimal("0.6"), monitor.get_increment_after_command(delta, min, max, cycling_is_allowed));
+}
+
 } // namespace test
@@ -114,4 +114,42 @@ TEST_F(TitleMonitorTestFixture, UpdateSettings)
     EXPECT_EQ("TEXT_STR", monitor.determineTitle(simulator_interface));
 }
 
+TEST(TitleMonitorTest, RegisteredDecodedFieldOfDcsBiosInteger)
+{
+    SimulatorConnectionSettings connection_settings{"1908", "1909", "127.0.0.1", ""};
+    UdpSocket mock_dcs(connection_settings.ip_address, connection_settings.tx_port, connection_settings.rx_port);
+    SimConnectionManager sim_connection_manager;
+    sim_connection_manager.connect_to_protocol(Protocol::DCS_BIOS, connection_settings);
+    SimulatorInterface *simulator_interface = sim_connection_manager.get_interface(Protocol::DCS_BIOS);
+    (void)mock_dcs.receive_stream();
+
+    TitleMonitor monitor{{{"dcs_id_string_monitor", "INTEGER"},
+                          {"string_monitor_address", 0x1000},
+                          {"string_monitor_mask", 0x0F00},
+                          {"string_monitor_shift", 8},
+                          {"string_monitor_passthrough_check", false},
+                          {"string_monitor_mapping", "2=ON,3=OFF"}}};
+    monitor.registerDecodedField(simulator_interface);
+    EXPECT_EQ("", monitor.determineTitle(simulator_interface));
+
+    // clang-format off
+    const char on_dcs_message[] = {0x55, 0x55, 0x55, 0x55,                          // Sync frame
+                                   0x00, 0x10, 0x02, 0x00, 0x01, 0x02,              // Addr 0x1000 (2 bytes)
+                                   (char)0xFE, (char)0xFF, 0x02, 0x00, 0x00, 0x00}; // End of frame
+    const char off_dcs_message[] = {0x55, 0x55, 0x55, 0x55,                          // Sync frame
+                                    0x00, 0x10, 0x02, 0x00, 0x01, 0x03,              // Addr 0x1000 (2 bytes)
+                                    (char)0xFE, (char)0xFF, 0x02, 0x00, 0x00, 0x00}; // End of frame
+    // clang-format on
+    mock_dcs.send_bytes(on_dcs_message, sizeof(on_dcs_message));
+    simulator_interface->update_simulator_state();
+    EXPECT_EQ("ON", monitor.determineTitle(simulator_interface));
+    mock_dcs.send_bytes(off_dcs_message, sizeof(off_dcs_message));
+    simulator_interface->update_simulator_state();
+    EXPECT_EQ("OFF", monitor.determineTitle(simulator_interface));
+
+    // Monitor continues to read the address after the decoded fields of the simulator interface are cleared.
+    simulator_interface->clear_decoded_fields();
+    EXPECT_EQ("OFF", monitor.determineTitle(simulator_interface));
+}
+
 } // namespace test
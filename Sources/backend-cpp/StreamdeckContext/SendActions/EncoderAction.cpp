@@ -6,22 +6,35 @@
 
 #include "ElgatoSD/EPLJSONUtils.h"
 
-#include <sstream>
+#include <algorithm>
 #include <cmath>
+#include <sstream>
 
 void EncoderAction::handleButtonPressedEvent(SimulatorInterface *simulator_interface,
                                              ESDConnectionManager *mConnectionManager,
-                                             const json &inPayload)
+                                             const json &settings,
+                                             const int state)
 {
     // Touch events handled on release
 }
 
 void EncoderAction::handleButtonReleasedEvent(SimulatorInterface *simulator_interface,
                                               ESDConnectionManager *mConnectionManager,
-                                              const json &inPayload)
+                                              const json &settings,
+                                              const int state)
 {
     // Touch on encoder LCD screen - treat same as encoder physical press
-    handleEncoderPress(simulator_interface, mConnectionManager, inPayload);
+    handleEncoderPress(simulator_interface, mConnectionManager, settings);
+}
+
+std::optional<Decimal> EncoderAction::getCurrentValue(SimulatorInterface *simulator_interface, const int dcs_id)
+{
+    // Show the value predicted from rotation already sent, rather than the game state which has yet to catch up.
+    const std::optional<Decimal> maybe_predicted_value = increment_monitor_.predicted_value();
+    if (maybe_predicted_value.has_value()) {
+        return maybe_predicted_value;
+    }
+    return simulator_interface->get_value_at_addr(dcs_id);
 }
 
 std::string EncoderAction::getCurrentDisplayValue(SimulatorInterface *simulator_interface, const json &settings)
@@ -30,7 +43,7 @@ std::string EncoderAction::getCurrentDisplayValue(SimulatorInterface *simulator_
     
     if (is_integer(dcs_id_increment_monitor_str)) {
         const int dcs_id = std::stoi(dcs_id_increment_monitor_str);
-        const std::optional<Decimal> maybe_value = simulator_interface->get_value_at_addr(dcs_id);
+        const std::optional<Decimal> maybe_value = getCurrentValue(simulator_interface, dcs_id);
         
         if (maybe_value.has_value()) {
             const std::string raw_value = maybe_value.value().str();
@@ -91,7 +104,7 @@ std::string EncoderAction::getCurrentImagePath(SimulatorInterface *simulator_int
     
     if (is_integer(dcs_id_increment_monitor_str)) {
         const int dcs_id = std::stoi(dcs_id_increment_monitor_str);
-        const std::optional<Decimal> maybe_value = simulator_interface->get_value_at_addr(dcs_id);
+        const std::optional<Decimal> maybe_value = getCurrentValue(simulator_interface, dcs_id);
         
         if (maybe_value.has_value()) {
             const std::string raw_value = maybe_value.value().str();
@@ -144,10 +157,68 @@ std::string EncoderAction::getCurrentImagePath(SimulatorInterface *simulator_int
 
 void EncoderAction::handleEncoderRotation(SimulatorInterface *simulator_interface,
                                          ESDConnectionManager *mConnectionManager,
-                                         const json &inPayload,
+                                         const json &settings,
                                          int ticks)
 {
-    const auto settings = inPayload["settings"];
+    if (ticks == 0) {
+        // No rotation
+        return;
+    }
+
+    // Estimate rotation velocity from the time since the previous rotation event.
+    const auto now = std::chrono::steady_clock::now();
+    if (last_rotation_time_) {
+        const double seconds = std::chrono::duration<double>(now - last_rotation_time_.value()).count();
+        if (seconds < ROTATION_IDLE_SECONDS) {
+            const double ticks_per_second = std::abs(ticks) / std::max(seconds, 0.001);
+            rotation_velocity_ = 0.5 * (rotation_velocity_ + ticks_per_second);
+        } else {
+            rotation_velocity_ = 0.0;
+        }
+    }
+    last_rotation_time_ = now;
+
+    // Rotation in the other direction uses the other increment value, so is not combined with pending rotation.
+    if ((pending_ticks_ > 0 && ticks < 0) || (pending_ticks_ < 0 && ticks > 0)) {
+        sendPendingCommands(simulator_interface, settings);
+    }
+
+    const auto acceleration_str = EPLJSONUtils::GetStringByName(settings, "encoder_acceleration");
+    const double acceleration = is_number(acceleration_str) ? std::stod(acceleration_str) : 0.0;
+    pending_ticks_ += accelerated_ticks(ticks, rotation_velocity_, acceleration);
+}
+
+void EncoderAction::sendPendingCommands(SimulatorInterface *simulator_interface, const json &settings)
+{
+    if (pending_ticks_ != 0) {
+        const int ticks = pending_ticks_;
+        pending_ticks_ = 0;
+        sendRotation(simulator_interface, settings, ticks);
+    } else if (increment_monitor_.predicted_value().has_value()) {
+        // Reconcile the predicted value with game state each frame, so the display follows the game once caught up.
+        increment_monitor_.update(simulator_interface);
+    }
+}
+
+void EncoderAction::clearPendingCommands()
+{
+    pending_ticks_ = 0;
+    rotation_velocity_ = 0.0;
+    last_rotation_time_.reset();
+}
+
+int EncoderAction::accelerated_ticks(const int ticks, const double ticks_per_second, const double acceleration)
+{
+    if (acceleration <= 0.0 || ticks_per_second <= ACCELERATION_START_TICKS_PER_SECOND) {
+        return ticks;
+    }
+    const double excess_velocity = ticks_per_second / ACCELERATION_START_TICKS_PER_SECOND - 1.0;
+    const double scale = std::min(1.0 + acceleration * excess_velocity, MAX_ACCELERATION_SCALE);
+    return static_cast<int>(std::lround(ticks * scale));
+}
+
+void EncoderAction::sendRotation(SimulatorInterface *simulator_interface, const json &settings, const int ticks)
+{
     const auto send_address = EPLJSONUtils::GetStringByName(settings, "send_address");
     const auto increment_cw_str = EPLJSONUtils::GetStringByName(settings, "increment_cw");
     const auto increment_ccw_str = EPLJSONUtils::GetStringByName(settings, "increment_ccw");
@@ -160,23 +231,13 @@ void EncoderAction::handleEncoderRotation(SimulatorInterface *simulator_interfac
     increment_monitor_.update(simulator_interface);
 
     // Choose the appropriate increment value based on rotation direction
-    std::string increment_value_str;
-    if (ticks > 0) {
-        // Clockwise rotation
-        increment_value_str = increment_cw_str;
-    } else if (ticks < 0) {
-        // Counter-clockwise rotation
-        increment_value_str = increment_ccw_str;
-    } else {
-        // No rotation
-        return;
-    }
+    const std::string increment_value_str = (ticks > 0) ? increment_cw_str : increment_ccw_str;
 
     if (is_number(increment_value_str) && is_number(increment_min_str) && is_number(increment_max_str)) {
         const Decimal increment_value(increment_value_str);
         
         // Use absolute value of ticks since direction is already handled by choosing CW or CCW value
-        const Decimal delta_cmd = increment_value * Decimal(std::to_string(std::abs(ticks)));
+        const Decimal delta_cmd = increment_value * Decimal(std::abs(ticks));
         
         const auto value = increment_monitor_.get_increment_after_command(delta_cmd,
                                                                           Decimal(increment_min_str),
@@ -188,9 +249,11 @@ void EncoderAction::handleEncoderRotation(SimulatorInterface *simulator_interfac
 
 void EncoderAction::handleEncoderPress(SimulatorInterface *simulator_interface,
                                       ESDConnectionManager *mConnectionManager,
-                                      const json &inPayload)
+                                      const json &settings)
 {
-    const auto settings = inPayload["settings"];
+    // Send rotation made before the press first, so the pressed value is not overridden.
+    sendPendingCommands(simulator_interface, settings);
+
     const auto send_address = EPLJSONUtils::GetStringByName(settings, "send_address");
     
     // Verify send_address is not empty
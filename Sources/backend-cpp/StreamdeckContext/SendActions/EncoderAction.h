@@ -5,6 +5,7 @@
 #include "StreamdeckContext/ExportMonitors/IncrementMonitor.h"
 #include "StreamdeckContext/SendActions/SendActionInterface.h"
 
+#include <chrono>
 #include <optional>
 #include <string>
 
@@ -18,23 +19,29 @@ class EncoderAction : public SendActionInterface
      */
     void handleButtonPressedEvent(SimulatorInterface *simulator_interface,
                                   ESDConnectionManager *mConnectionManager,
-                                  const json &inPayload) override;
+                                  const json &settings,
+                                  const int state) override;
 
     void handleButtonReleasedEvent(SimulatorInterface *simulator_interface,
                                    ESDConnectionManager *mConnectionManager,
-                                   const json &inPayload) override;
+                                   const json &settings,
+                                   const int state) override;
 
     /**
      * @brief Handles encoder rotation event with direction (positive = clockwise, negative = counter-clockwise).
      *
+     *   Rotation is accumulated rather than sent at once, so the ticks of all rotation events received within an update
+     *   frame are sent as a single command by sendPendingCommands. If the "encoder_acceleration" setting is a positive
+     *   number, ticks of fast rotation are scaled up according to the rotation velocity (see accelerated_ticks).
+     *
      * @param simulator_interface Interface to simulator containing current game state.
      * @param mConnectionManager Interface to StreamDeck.
-     * @param inPayload Json payload received with encoder rotation callback.
+     * @param settings Settings of the context, migrated to the current version.
      * @param ticks Number of rotation ticks (positive = clockwise, negative = counter-clockwise).
      */
     void handleEncoderRotation(SimulatorInterface *simulator_interface,
                               ESDConnectionManager *mConnectionManager,
-                              const json &inPayload,
+                              const json &settings,
                               int ticks);
 
     /**
@@ -42,11 +49,37 @@ class EncoderAction : public SendActionInterface
      *
      * @param simulator_interface Interface to simulator containing current game state.
      * @param mConnectionManager Interface to StreamDeck.
-     * @param inPayload Json payload received with encoder press callback.
+     * @param settings Settings of the context, migrated to the current version.
      */
     void handleEncoderPress(SimulatorInterface *simulator_interface,
                            ESDConnectionManager *mConnectionManager,
-                           const json &inPayload);
+                           const json &settings);
+
+    /**
+     * @brief Sends a single command for the rotation accumulated since the last frame, if any.
+     */
+    void sendPendingCommands(SimulatorInterface *simulator_interface, const json &settings) override;
+
+    /**
+     * @brief Drops the rotation accumulated since the last frame, and the rotation velocity.
+     */
+    void clearPendingCommands() override;
+
+    /**
+     * @brief Scales the ticks of a rotation event according to the rotation velocity. Rotation slower than
+     *        ACCELERATION_START_TICKS_PER_SECOND is not scaled; above it, each multiple of that velocity adds
+     *        `acceleration` to the scale, up to MAX_ACCELERATION_SCALE.
+     *
+     * @param ticks Number of rotation ticks of the event.
+     * @param ticks_per_second Rotation velocity.
+     * @param acceleration Scale added per multiple of the starting velocity, or 0 for no acceleration.
+     * @return Scaled number of ticks, with the same direction as ticks.
+     */
+    static int accelerated_ticks(const int ticks, const double ticks_per_second, const double acceleration);
+
+    static constexpr double ACCELERATION_START_TICKS_PER_SECOND = 10.0;
+    static constexpr double MAX_ACCELERATION_SCALE = 10.0;
+    static constexpr double ROTATION_IDLE_SECONDS = 0.25; // Pause after which rotation restarts from zero velocity.
 
     /**
      * @brief Returns the current display value for the encoder LCD.
@@ -67,5 +100,20 @@ class EncoderAction : public SendActionInterface
     std::string getCurrentImagePath(SimulatorInterface *simulator_interface, const json &settings);
 
   private:
+    /**
+     * @brief Get the value of the monitored DCS ID, predicted from rotation sent until game state confirms it.
+     */
+    std::optional<Decimal> getCurrentValue(SimulatorInterface *simulator_interface, const int dcs_id);
+
+    /**
+     * @brief Sends the command for a number of rotation ticks, starting from the predicted value if rotation sent
+     *        earlier is not yet confirmed by game state, or else from the current game state.
+     */
+    void sendRotation(SimulatorInterface *simulator_interface, const json &settings, const int ticks);
+
     IncrementMonitor increment_monitor_{}; // Monitors DCS ID to track current state for incremental changes.
+
+    int pending_ticks_ = 0;          // Rotation ticks received but not yet sent, after acceleration.
+    double rotation_velocity_ = 0.0; // Smoothed rotation velocity, in ticks per second.
+    std::optional<std::chrono::steady_clock::time_point> last_rotation_time_;
 };
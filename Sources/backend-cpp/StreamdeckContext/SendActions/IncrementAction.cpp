@@ -8,9 +8,9 @@
 
 void IncrementAction::handleButtonPressedEvent(SimulatorInterface *simulator_interface,
                                                ESDConnectionManager *mConnectionManager,
-                                               const json &inPayload)
+                                               const json &settings,
+                                               const int state)
 {
-    const auto settings = inPayload["settings"];
     const auto send_address = EPLJSONUtils::GetStringByName(settings, "send_address");
 
     // TODO: simplify increment monitor interface as this is currently the only user.
@@ -25,7 +25,8 @@ void IncrementAction::handleButtonPressedEvent(SimulatorInterface *simulator_int
 
 void IncrementAction::handleButtonReleasedEvent(SimulatorInterface *simulator_interface,
                                                 ESDConnectionManager *mConnectionManager,
-                                                const json &inPayload)
+                                                const json &settings,
+                                                const int state)
 {
     // Nothing sent to DCS on release.
 }
@@ -6,10 +6,11 @@
 
 void MomentaryAction::handleButtonPressedEvent(SimulatorInterface *simulator_interface,
                                                ESDConnectionManager *mConnectionManager,
-                                               const json &inPayload)
+                                               const json &settings,
+                                               const int state)
 {
-    const auto send_address = EPLJSONUtils::GetStringByName(inPayload["settings"], "send_address");
-    const auto send_command = EPLJSONUtils::GetStringByName(inPayload["settings"], "press_value");
+    const auto send_address = EPLJSONUtils::GetStringByName(settings, "send_address");
+    const auto send_command = EPLJSONUtils::GetStringByName(settings, "press_value");
 
     if (!send_command.empty()) {
         simulator_interface->send_command(send_address, send_command);
@@ -18,12 +19,12 @@ void MomentaryAction::handleButtonPressedEvent(SimulatorInterface *simulator_int
 
 void MomentaryAction::handleButtonReleasedEvent(SimulatorInterface *simulator_interface,
                                                 ESDConnectionManager *mConnectionManager,
-                                                const json &inPayload)
+                                                const json &settings,
+                                                const int state)
 {
-    const auto send_address = EPLJSONUtils::GetStringByName(inPayload["settings"], "send_address");
-    const auto send_command = EPLJSONUtils::GetStringByName(inPayload["settings"], "release_value");
-    const bool send_on_release_is_disabled =
-        EPLJSONUtils::GetBoolByName(inPayload["settings"], "disable_release_check");
+    const auto send_address = EPLJSONUtils::GetStringByName(settings, "send_address");
+    const auto send_command = EPLJSONUtils::GetStringByName(settings, "release_value");
+    const bool send_on_release_is_disabled = EPLJSONUtils::GetBoolByName(settings, "disable_release_check");
 
     if (!send_command.empty() && !send_on_release_is_disabled) {
         simulator_interface->send_command(send_address, send_command);
@@ -17,13 +17,16 @@ class MomentaryAction : public SendActionInterface
      *
      * @param simulator_interface Interface to simulator containing current game state.
      * @param mConnectionManager Interface to Streamdeck for current context.
-     * @param payload Json payload received with KeyDown/KeyUp callback.
+     * @param settings Settings of the context, migrated to the current version.
+     * @param state State of the context reported with the KeyDown/KeyUp event.
      */
     void handleButtonPressedEvent(SimulatorInterface *simulator_interface,
                                   ESDConnectionManager *mConnectionManager,
-                                  const json &inPayload);
+                                  const json &settings,
+                                  const int state);
 
     void handleButtonReleasedEvent(SimulatorInterface *simulator_interface,
                                    ESDConnectionManager *mConnectionManager,
-                                   const json &inPayload);
+                                   const json &settings,
+                                   const int state);
 };
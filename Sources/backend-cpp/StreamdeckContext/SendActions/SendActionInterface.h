@@ -17,15 +17,31 @@ class SendActionInterface
      *
      * @param simulator_interface Interface to simulator containing current game state.
      * @param mConnectionManager Interface to StreamDeck.
-     * @param payload Json payload received with KeyDown/KeyUp callback.
+     * @param settings Settings of the context, migrated to the current version.
+     * @param state State of the context reported with the KeyDown/KeyUp event.
      */
     virtual void handleButtonPressedEvent(SimulatorInterface *simulator_interface,
                                           ESDConnectionManager *mConnectionManager,
-                                          const json &inPayload) = 0;
+                                          const json &settings,
+                                          const int state) = 0;
 
     virtual void handleButtonReleasedEvent(SimulatorInterface *simulator_interface,
                                            ESDConnectionManager *mConnectionManager,
-                                           const json &inPayload) = 0;
+                                           const json &settings,
+                                           const int state) = 0;
+
+    /**
+     * @brief Sends any commands the action has held back to combine with later events, called once per update frame.
+     *
+     * @param simulator_interface Interface to simulator containing current game state.
+     * @param settings Settings of the context, migrated to the current version.
+     */
+    virtual void sendPendingCommands(SimulatorInterface * /*simulator_interface*/, const json & /*settings*/) {}
+
+    /**
+     * @brief Drops any commands the action has held back without sending them, such as when its context is removed.
+     */
+    virtual void clearPendingCommands() {}
 
     // For some actions (i.e. switches) a delay before forcing a state update is desired to avoid jittering and a race
     // condition of Streamdeck and Plugin trying to change state.
@@ -0,0 +1,139 @@
+// Copyright 2026 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "SimulatorInterface/SimConnectionManager.h"
+#include "StreamdeckContext/SendActions/EncoderAction.h"
+
+#include "Test/MockESDConnectionManager.h"
+
+#include <chrono>
+#include <thread>
+
+namespace test
+{
+
+class EncoderActionRotationTestFixture : public ::testing::Test
+{
+  public:
+    EncoderActionRotationTestFixture()
+        : // Mock DCS socket uses the reverse rx and tx ports of simulator_interface so it can communicate with it.
+          mock_dcs(connection_settings.ip_address, connection_settings.tx_port, connection_settings.rx_port),
+          // Create default json settings.
+          settings({{"send_address", send_address},
+                    {"dcs_id_increment_monitor", "321"},
+                    {"increment_cw", "0.1"},
+                    {"increment_ccw", "-0.1"},
+                    {"increment_min", "0"},
+                    {"increment_max", "1"},
+                    {"increment_cycle_allowed_check", false}})
+    {
+        sim_connection_manager.connect_to_protocol(Protocol::DCS_ExportScript, connection_settings);
+        simulator_interface = sim_connection_manager.get_interface(Protocol::DCS_ExportScript);
+        // Consume intial reset command sent to to mock_dcs.
+        (void)mock_dcs.receive_stream();
+    }
+
+    std::string send_address = "23,2";
+    json settings;
+
+    SimulatorConnectionSettings connection_settings = {"1958", "1959", "127.0.0.1"};
+    UdpSocket mock_dcs;                              // A socket that will mock Send/Receive messages from DCS.
+    MockESDConnectionManager esd_connection_manager; // Streamdeck connection manager, using mock class definition.
+    EncoderAction fixture_context;
+    SimulatorInterface *simulator_interface; // Simulator Interface to test.
+  private:
+    SimConnectionManager sim_connection_manager;
+};
+
+TEST_F(EncoderActionRotationTestFixture, rotation_is_sent_on_next_frame)
+{
+    fixture_context.handleEncoderRotation(simulator_interface, &esd_connection_manager, settings, 1);
+    // Expect no command sent until the next frame (empty string is due to mock socket functionality).
+    EXPECT_EQ("", mock_dcs.receive_stream().str());
+
+    fixture_context.sendPendingCommands(simulator_interface, settings);
+    EXPECT_EQ("C" + send_address + ",0.1", mock_dcs.receive_stream().str());
+
+    // Nothing is left to send on following frames.
+    fixture_context.sendPendingCommands(simulator_interface, settings);
+    EXPECT_EQ("", mock_dcs.receive_stream().str());
+}
+
+TEST_F(EncoderActionRotationTestFixture, rotation_is_sent_by_late_frame)
+{
+    // A frame delayed such as by lock contention still sends the rotation received before it.
+    fixture_context.handleEncoderRotation(simulator_interface, &esd_connection_manager, settings, 1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    fixture_context.sendPendingCommands(simulator_interface, settings);
+    EXPECT_EQ("C" + send_address + ",0.1", mock_dcs.receive_stream().str());
+}
+
+TEST_F(EncoderActionRotationTestFixture, cleared_rotation_is_not_sent)
+{
+    fixture_context.handleEncoderRotation(simulator_interface, &esd_connection_manager, settings, 2);
+    fixture_context.clearPendingCommands();
+    fixture_context.sendPendingCommands(simulator_interface, settings);
+    EXPECT_EQ("", mock_dcs.receive_stream().str());
+}
+
+TEST_F(EncoderActionRotationTestFixture, rotations_within_frame_are_combined)
+{
+    fixture_context.handleEncoderRotation(simulator_interface, &esd_connection_manager, settings, 1);
+    fixture_context.handleEncoderRotation(simulator_interface, &esd_connection_manager, settings, 2);
+    fixture_context.sendPendingCommands(simulator_interface, settings);
+    EXPECT_EQ("C" + send_address + ",0.3", mock_dcs.receive_stream().str());
+}
+
+TEST_F(EncoderActionRotationTestFixture, reversed_rotation_sends_pending_rotation)
+{
+    fixture_context.handleEncoderRotation(simulator_interface, &esd_connection_manager, settings, 2);
+    fixture_context.handleEncoderRotation(simulator_interface, &esd_connection_manager, settings, -1);
+    EXPECT_EQ("C" + send_address + ",0.2", mock_dcs.receive_stream().str());
+
+    fixture_context.sendPendingCommands(simulator_interface, settings);
+    EXPECT_EQ("C" + send_address + ",0.1", mock_dcs.receive_stream().str());
+}
+
+TEST_F(EncoderActionRotationTestFixture, press_sends_pending_rotation_first)
+{
+    settings["encoder_press_value"] = "0.5";
+    fixture_context.handleEncoderRotation(simulator_interface, &esd_connection_manager, settings, 1);
+    fixture_context.handleEncoderPress(simulator_interface, &esd_connection_manager, settings);
+    EXPECT_EQ("C" + send_address + ",0.1", mock_dcs.receive_stream().str());
+    EXPECT_EQ("C" + send_address + ",0.5", mock_dcs.receive_stream().str());
+}
+
+TEST_F(EncoderActionRotationTestFixture, display_shows_predicted_value)
+{
+    // Game state has no value for the monitored DCS ID until the simulator reports one.
+    EXPECT_EQ("", fixture_context.getCurrentDisplayValue(simulator_interface, settings));
+
+    fixture_context.handleEncoderRotation(simulator_interface, &esd_connection_manager, settings, 2);
+    fixture_context.sendPendingCommands(simulator_interface, settings);
+    EXPECT_EQ("0.2", fixture_context.getCurrentDisplayValue(simulator_interface, settings));
+
+    // Rotation continues from the predicted value.
+    (void)mock_dcs.receive_stream();
+    fixture_context.handleEncoderRotation(simulator_interface, &esd_connection_manager, settings, 1);
+    fixture_context.sendPendingCommands(simulator_interface, settings);
+    EXPECT_EQ("C" + send_address + ",0.3", mock_dcs.receive_stream().str());
+    EXPECT_EQ("0.3", fixture_context.getCurrentDisplayValue(simulator_interface, settings));
+}
+
+TEST(EncoderActionTest, accelerated_ticks)
+{
+    // Without acceleration or below the starting velocity, ticks are unchanged.
+    EXPECT_EQ(2, EncoderAction::accelerated_ticks(2, 100.0, 0.0));
+    EXPECT_EQ(2, EncoderAction::accelerated_ticks(2, EncoderAction::ACCELERATION_START_TICKS_PER_SECOND, 1.0));
+
+    // At 3x the starting velocity, an acceleration of 1 scales ticks by 3 in either direction.
+    const double velocity = 3 * EncoderAction::ACCELERATION_START_TICKS_PER_SECOND;
+    EXPECT_EQ(6, EncoderAction::accelerated_ticks(2, velocity, 1.0));
+    EXPECT_EQ(-6, EncoderAction::accelerated_ticks(-2, velocity, 1.0));
+    EXPECT_EQ(4, EncoderAction::accelerated_ticks(2, velocity, 0.5));
+
+    // Scale is limited at very high velocity.
+    EXPECT_EQ(10, EncoderAction::accelerated_ticks(1, 1000.0, 1.0));
+}
+} // namespace test
@@ -15,12 +15,10 @@ class SwitchActionKeyPressTestFixture : public ::testing::Test
     SwitchActionKeyPressTestFixture()
         : // Mock DCS socket uses the reverse rx and tx ports of simulator_interface so it can communicate with it.
           mock_dcs(connection_settings.ip_address, connection_settings.tx_port, connection_settings.rx_port),
-          // Create default json payload.
-          payload({{"state", 0},
-                   {"settings",
-                    {{"send_address", send_address},
-                     {"send_when_first_state_value", send_when_first_state_value},
-                     {"send_when_second_state_value", send_when_second_state_value}}}})
+          // Create default json settings.
+          settings({{"send_address", send_address},
+                    {"send_when_first_state_value", send_when_first_state_value},
+                    {"send_when_second_state_value", send_when_second_state_value}})
     {
         sim_connection_manager.connect_to_protocol(Protocol::DCS_ExportScript, connection_settings);
         simulator_interface = sim_connection_manager.get_interface(Protocol::DCS_ExportScript);
@@ -31,7 +29,8 @@ class SwitchActionKeyPressTestFixture : public ::testing::Test
     std::string send_address = "23,2";
     std::string send_when_first_state_value = "6";
     std::string send_when_second_state_value = "7";
-    json payload;
+    json settings;
+    int state = 0;
 
     SimulatorConnectionSettings connection_settings = {"1948", "1949", "127.0.0.1"};
     UdpSocket mock_dcs;                              // A socket that will mock Send/Receive messages from DCS.
@@ -44,7 +43,7 @@ class SwitchActionKeyPressTestFixture : public ::testing::Test
 
 TEST_F(SwitchActionKeyPressTestFixture, handle_keyup_switch_in_first_state)
 {
-    fixture_context.handleButtonReleasedEvent(simulator_interface, &esd_connection_manager, payload);
+    fixture_context.handleButtonReleasedEvent(simulator_interface, &esd_connection_manager, settings, state);
     const std::stringstream ss_received = mock_dcs.receive_stream();
     std::string expected_command = "C" + send_address + "," + send_when_first_state_value;
     EXPECT_EQ(expected_command, ss_received.str());
@@ -52,8 +51,8 @@ TEST_F(SwitchActionKeyPressTestFixture, handle_keyup_switch_in_first_state)
 
 TEST_F(SwitchActionKeyPressTestFixture, handle_keyup_switch_in_second_state)
 {
-    payload["state"] = 1;
-    fixture_context.handleButtonReleasedEvent(simulator_interface, &esd_connection_manager, payload);
+    state = 1;
+    fixture_context.handleButtonReleasedEvent(simulator_interface, &esd_connection_manager, settings, state);
     const std::stringstream ss_received = mock_dcs.receive_stream();
     std::string expected_command = "C" + send_address + "," + send_when_second_state_value;
     EXPECT_EQ(expected_command, ss_received.str());
@@ -61,7 +60,7 @@ TEST_F(SwitchActionKeyPressTestFixture, handle_keyup_switch_in_second_state)
 
 TEST_F(SwitchActionKeyPressTestFixture, handle_keydown_switch)
 {
-    fixture_context.handleButtonPressedEvent(simulator_interface, &esd_connection_manager, payload);
+    fixture_context.handleButtonPressedEvent(simulator_interface, &esd_connection_manager, settings, state);
     const std::stringstream ss_received = mock_dcs.receive_stream();
     // Expect no command sent (empty string is due to mock socket functionality).
     std::string expected_command = "";
@@ -70,8 +69,8 @@ TEST_F(SwitchActionKeyPressTestFixture, handle_keydown_switch)
 
 TEST_F(SwitchActionKeyPressTestFixture, handle_keyup_switch_empty_value)
 {
-    payload["settings"]["send_when_first_state_value"] = "";
-    fixture_context.handleButtonReleasedEvent(simulator_interface, &esd_connection_manager, payload);
+    settings["send_when_first_state_value"] = "";
+    fixture_context.handleButtonReleasedEvent(simulator_interface, &esd_connection_manager, settings, state);
     const std::stringstream ss_received = mock_dcs.receive_stream();
     std::string expected_command = "";
     EXPECT_EQ(expected_command, ss_received.str());
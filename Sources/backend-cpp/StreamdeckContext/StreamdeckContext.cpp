@@ -21,6 +21,8 @@ Protocol StreamdeckContext::protocol() { return protocol_; }
 void StreamdeckContext::updateContextState(SimulatorInterface *simulator_interface,
                                            ESDConnectionManager *mConnectionManager)
 {
+    // Send commands held back by the action to combine events received since the last update.
+    send_action_->sendPendingCommands(simulator_interface, settings_);
 
     const auto updated_state = comparison_monitor_.determineContextState(simulator_interface);
     const auto updated_title = title_monitor_.determineTitle(simulator_interface);
@@ -118,6 +120,7 @@ void StreamdeckContext::updateContextState(SimulatorInterface *simulator_interfa
             last_encoder_display_value_ = current_display_signature;
         }
         
+        last_feedback_ = feedback;
         mConnectionManager->SetFeedback(feedback, context_);
     }
 
@@ -129,11 +132,34 @@ void StreamdeckContext::updateContextState(SimulatorInterface *simulator_interfa
     }
 }
 
+void StreamdeckContext::registerDecodedFields(SimulatorInterface *simulator_interface)
+{
+    comparison_monitor_.registerDecodedField(simulator_interface);
+    title_monitor_.registerDecodedField(simulator_interface);
+}
+
+void StreamdeckContext::unregisterDecodedFields(SimulatorInterface *simulator_interface)
+{
+    comparison_monitor_.unregisterDecodedField(simulator_interface);
+    title_monitor_.unregisterDecodedField(simulator_interface);
+}
+
 void StreamdeckContext::forceSendState(ESDConnectionManager *mConnectionManager)
 {
     mConnectionManager->SetState(current_state_, context_);
 }
 
+void StreamdeckContext::forceSendDisplay(ESDConnectionManager *mConnectionManager)
+{
+    mConnectionManager->SetState(current_state_, context_);
+    if (!current_title_.empty()) {
+        mConnectionManager->SetTitle(current_title_, context_, kESDSDKTarget_HardwareAndSoftware);
+    }
+    if (!last_feedback_.is_null()) {
+        mConnectionManager->SetFeedback(last_feedback_, context_);
+    }
+}
+
 void StreamdeckContext::forceSendStateAfterDelay(const int delay_count)
 {
     delay_for_force_send_state_.emplace(delay_count);
@@ -149,16 +175,16 @@ void StreamdeckContext::updateContextSettings(const json &settings)
 
 void StreamdeckContext::handleButtonPressedEvent(SimulatorInterface *simulator_interface,
                                                  ESDConnectionManager *mConnectionManager,
-                                                 const json &inPayload)
+                                                 const int state)
 {
-    send_action_->handleButtonPressedEvent(simulator_interface, mConnectionManager, inPayload);
+    send_action_->handleButtonPressedEvent(simulator_interface, mConnectionManager, settings_, state);
 }
 
 void StreamdeckContext::handleButtonReleasedEvent(SimulatorInterface *simulator_interface,
                                                   ESDConnectionManager *mConnectionManager,
-                                                  const json &inPayload)
+                                                  const int state)
 {
-    send_action_->handleButtonReleasedEvent(simulator_interface, mConnectionManager, inPayload);
+    send_action_->handleButtonReleasedEvent(simulator_interface, mConnectionManager, settings_, state);
 
     // The Streamdeck will by default change a context's state after a KeyUp event, so a force send of the current
     // context's state will keep the button state in sync with the plugin.
@@ -171,34 +197,31 @@ void StreamdeckContext::handleButtonReleasedEvent(SimulatorInterface *simulator_
 
 void StreamdeckContext::handleEncoderRotation(SimulatorInterface *simulator_interface,
                                              ESDConnectionManager *mConnectionManager,
-                                             const json &inPayload,
                                              int ticks)
 {
     // Cast to EncoderAction to access encoder-specific methods
     auto *encoder_action = dynamic_cast<EncoderAction *>(send_action_.get());
     if (encoder_action) {
-        // Create a new payload with stored settings
-        json payload_with_settings = inPayload;
-        payload_with_settings["settings"] = settings_;
-        
-        encoder_action->handleEncoderRotation(simulator_interface, mConnectionManager, payload_with_settings, ticks);
+        encoder_action->handleEncoderRotation(simulator_interface, mConnectionManager, settings_, ticks);
     }
 }
 
 void StreamdeckContext::handleEncoderPress(SimulatorInterface *simulator_interface,
-                                          ESDConnectionManager *mConnectionManager,
-                                          const json &inPayload)
+                                          ESDConnectionManager *mConnectionManager)
 {
     // Cast to EncoderAction to access encoder-specific methods
     auto *encoder_action = dynamic_cast<EncoderAction *>(send_action_.get());
     if (encoder_action) {
-        // Create a new payload with stored settings
-        json payload_with_settings = inPayload;
-        payload_with_settings["settings"] = settings_;
-        
-        encoder_action->handleEncoderPress(simulator_interface, mConnectionManager, payload_with_settings);
+        encoder_action->handleEncoderPress(simulator_interface, mConnectionManager, settings_);
     }
     
     // Force send state update after encoder press
     forceSendState(mConnectionManager);
 }
+
+void StreamdeckContext::clearPendingCommands()
+{
+    if (send_action_) {
+        send_action_->clearPendingCommands();
+    }
+}
@@ -36,6 +36,22 @@ class StreamdeckContext
      */
     void updateContextState(SimulatorInterface *simulator_interface, ESDConnectionManager *mConnectionManager);
 
+    /**
+     * @brief Registers the context's monitored integer addresses to be decoded by the simulator interface as data is
+     *        received, rather than on each call to updateContextState.
+     *
+     * @param simulator_interface Interface to simulator containing current game state.
+     */
+    void registerDecodedFields(SimulatorInterface *simulator_interface);
+
+    /**
+     * @brief Unregisters the context's monitored addresses registered with registerDecodedFields, e.g. before the
+     *        context disappears or its settings are updated.
+     *
+     * @param simulator_interface Interface to simulator the addresses were registered with.
+     */
+    void unregisterDecodedFields(SimulatorInterface *simulator_interface);
+
     /**
      * @brief Forces an update to the Streamdeck of the context's current state be sent with current static values.
      *        (Normally an update is sent to the Streamdeck only on change of current state).
@@ -44,6 +60,14 @@ class StreamdeckContext
      */
     void forceSendState(ESDConnectionManager *mConnectionManager);
 
+    /**
+     * @brief Forces an update to the Streamdeck of the context's last evaluated state, title and encoder feedback, such
+     *        as when a context kept from an earlier appearance reappears.
+     *
+     * @param mConnectionManager Interface to StreamDeck.
+     */
+    void forceSendDisplay(ESDConnectionManager *mConnectionManager);
+
     /**
      * @brief Forces an update to the Streamdeck of the context's current state be sent after a specified delay.
      *        (Normally an update is sent to the Streamdeck only on change of current state).
@@ -55,37 +79,39 @@ class StreamdeckContext
     /**
      * @brief Updates settings from received json payload.
      *
-     * @param settings Json payload of settings values populated in Streamdeck Property Inspector.
+     * @param settings Json payload of settings values populated in Streamdeck Property Inspector, migrated to the
+     *                 current version by backwardsCompatibleSettings.
      */
     void updateContextSettings(const json &settings);
 
+    // Stored settings for this context.
+    const json &settings() const { return settings_; }
+
     /**
-     * @brief Sends simulator commands according to button type and settings received during Key Pressed and Released
+     * @brief Sends simulator commands according to button type and the stored settings during Key Pressed and Released
      * events.
      *
      * @param simulator_interface Interface to simulator containing current game state.
      * @param mConnectionManager Interface to StreamDeck.
-     * @param payload Json payload received with KeyDown/KeyUp callback.
+     * @param state State of the context received with KeyDown/KeyUp callback.
      */
     void handleButtonPressedEvent(SimulatorInterface *simulator_interface,
                                   ESDConnectionManager *mConnectionManager,
-                                  const json &inPayload);
+                                  const int state);
 
     void handleButtonReleasedEvent(SimulatorInterface *simulator_interface,
                                    ESDConnectionManager *mConnectionManager,
-                                   const json &inPayload);
+                                   const int state);
 
     /**
      * @brief Handles encoder rotation events.
      *
      * @param simulator_interface Interface to simulator containing current game state.
      * @param mConnectionManager Interface to StreamDeck.
-     * @param payload Json payload received with encoder rotation callback.
      * @param ticks Number of rotation ticks (positive = clockwise, negative = counter-clockwise).
      */
     void handleEncoderRotation(SimulatorInterface *simulator_interface,
                               ESDConnectionManager *mConnectionManager,
-                              const json &inPayload,
                               int ticks);
 
     /**
@@ -93,11 +119,13 @@ class StreamdeckContext
      *
      * @param simulator_interface Interface to simulator containing current game state.
      * @param mConnectionManager Interface to StreamDeck.
-     * @param payload Json payload received with encoder press callback.
      */
-    void handleEncoderPress(SimulatorInterface *simulator_interface,
-                           ESDConnectionManager *mConnectionManager,
-                           const json &inPayload);
+    void handleEncoderPress(SimulatorInterface *simulator_interface, ESDConnectionManager *mConnectionManager);
+
+    /**
+     * @brief Drops commands held back by the action to combine with later events, without sending them.
+     */
+    void clearPendingCommands();
 
     static const int NUM_FRAMES_DELAY_FORCED_STATE_UPDATE = 3; // Kept public for unit testing.
 
@@ -110,6 +138,7 @@ class StreamdeckContext
     std::string current_title_ = ""; // Stored title of the context.
     std::string last_encoder_display_value_ = ""; // Last value displayed on encoder LCD.
     std::string last_encoder_image_path_ = ""; // Last image path set for encoder background.
+    json last_feedback_;                       // Last feedback sent to the encoder display, null if none.
     json settings_;                  // Stored settings for this context.
 
     // Monitors.
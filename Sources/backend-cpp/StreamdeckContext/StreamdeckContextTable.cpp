@@ -0,0 +1,103 @@
+// Copyright 2026 Charles Tytler
+
+#include "StreamdeckContextTable.h"
+
+#include <functional>
+
+StreamdeckContextTable::StreamdeckContextTable(const size_t warm_capacity) : warm_capacity_{warm_capacity} {}
+
+ContextHandle StreamdeckContextTable::insert(const std::string &context_id, StreamdeckContext context)
+{
+    // A warm context with the ID is superseded by the inserted context.
+    const auto warm = warm_index_.find(context_id);
+    if (warm != warm_index_.end()) {
+        warm_contexts_.erase(warm->second);
+        warm_index_.erase(warm);
+    }
+
+    const auto found = handles_.find(context_id);
+    if (found != handles_.end()) {
+        slots_[found->second] = std::move(context);
+        return found->second;
+    }
+
+    ContextHandle handle;
+    if (!free_handles_.empty()) {
+        handle = free_handles_.back();
+        free_handles_.pop_back();
+        slots_[handle] = std::move(context);
+    } else {
+        handle = static_cast<ContextHandle>(slots_.size());
+        slots_.emplace_back(std::move(context));
+    }
+    handles_.emplace(context_id, handle);
+    return handle;
+}
+
+bool StreamdeckContextTable::erase(const std::string &context_id)
+{
+    const auto found = handles_.find(context_id);
+    if (found == handles_.end()) {
+        return false;
+    }
+    auto &slot = slots_[found->second];
+    // Commands held back by the context are dropped, rather than sent once it is visible again.
+    slot->clearPendingCommands();
+    if (warm_capacity_ > 0) {
+        if (warm_contexts_.size() >= warm_capacity_) {
+            warm_index_.erase(warm_contexts_.back().context_id);
+            warm_contexts_.pop_back();
+        }
+        const size_t hash = settings_hash(slot->settings());
+        warm_contexts_.push_front(WarmContext{context_id, hash, std::move(slot.value())});
+        warm_index_.emplace(context_id, warm_contexts_.begin());
+    }
+    slot.reset();
+    free_handles_.push_back(found->second);
+    handles_.erase(found);
+    return true;
+}
+
+std::optional<ContextHandle> StreamdeckContextTable::restore(const std::string &context_id, const json &settings)
+{
+    const auto warm = warm_index_.find(context_id);
+    if (warm == warm_index_.end()) {
+        return std::nullopt;
+    }
+    const auto cached = warm->second;
+    warm_index_.erase(warm);
+    // The hash is only a quick check, so settings with a colliding hash are also compared in full.
+    if (cached->settings_hash != settings_hash(settings) || cached->context.settings() != settings) {
+        // Settings were changed while the context was not visible, so the cached context is out of date.
+        warm_contexts_.erase(cached);
+        return std::nullopt;
+    }
+    StreamdeckContext context = std::move(cached->context);
+    warm_contexts_.erase(cached);
+    return insert(context_id, std::move(context));
+}
+
+std::optional<ContextHandle> StreamdeckContextTable::find(const std::string &context_id) const
+{
+    const auto found = handles_.find(context_id);
+    if (found == handles_.end()) {
+        return std::nullopt;
+    }
+    return found->second;
+}
+
+StreamdeckContext *StreamdeckContextTable::get(const ContextHandle handle)
+{
+    if (handle >= slots_.size() || !slots_[handle]) {
+        return nullptr;
+    }
+    return &slots_[handle].value();
+}
+
+StreamdeckContext *StreamdeckContextTable::get(const std::string &context_id)
+{
+    const auto handle = find(context_id);
+    return handle ? get(handle.value()) : nullptr;
+}
+
+size_t StreamdeckContextTable::settings_hash(const json &settings) { return std::hash<std::string>{}(settings.dump()); }
@@ -0,0 +1,105 @@
+// Copyright 2026 Charles Tytler
+
+#pragma once
+
+#include "StreamdeckContext/StreamdeckContext.h"
+
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using ContextHandle = uint32_t;
+
+/**
+ * @brief Visible Streamdeck contexts, held in a slot array indexed by a dense integer handle for each context.
+ *
+ *   A context ID is interned to a handle when its context is added, so each event looks up the context ID once and
+ *   then refers to the context by handle, and the periodic update of all contexts iterates a contiguous array. Handles
+ *   of removed contexts are reused by contexts added later, so a handle should not be kept once its context may have
+ *   been removed. Looking up a context ID which is not visible never adds a context.
+ *
+ *   Removed contexts are kept warm in a least-recently-used cache, so a context which reappears with unchanged
+ *   settings (e.g. when flipping back to a Streamdeck page or profile) is restored with its last evaluated state, title
+ *   and feedback rather than rebuilt from its settings.
+ *
+ *   The table is not synchronized; callers hold their own lock.
+ */
+class StreamdeckContextTable
+{
+  public:
+    static constexpr size_t DEFAULT_WARM_CAPACITY = 256;
+
+    /**
+     * @param warm_capacity Maximum number of removed contexts kept warm, or 0 to discard removed contexts.
+     */
+    explicit StreamdeckContextTable(const size_t warm_capacity = DEFAULT_WARM_CAPACITY);
+
+    /**
+     * @brief Adds the context, replacing any context with the same ID.
+     * @return Handle of the context, unchanged if the context was replaced.
+     */
+    ContextHandle insert(const std::string &context_id, StreamdeckContext context);
+
+    /**
+     * @brief Removes the context with the ID, if it is visible, keeping it warm in case it reappears. Commands the
+     *        context has held back are dropped.
+     * @return True if a context was removed.
+     */
+    bool erase(const std::string &context_id);
+
+    /**
+     * @brief Makes visible again the warm context with the ID, if it was removed with the same settings.
+     * @return Handle of the restored context, or nullopt if the context must be rebuilt from its settings.
+     */
+    std::optional<ContextHandle> restore(const std::string &context_id, const json &settings);
+
+    /**
+     * @brief Get the handle of the context with the ID, or nullopt if no such context is visible.
+     */
+    std::optional<ContextHandle> find(const std::string &context_id) const;
+
+    /**
+     * @brief Get the context of a handle, or nullptr if the handle has no context.
+     */
+    StreamdeckContext *get(const ContextHandle handle);
+
+    /**
+     * @brief Get the context with the ID, or nullptr if no such context is visible.
+     */
+    StreamdeckContext *get(const std::string &context_id);
+
+    size_t size() const { return handles_.size(); }
+    size_t warm_size() const { return warm_contexts_.size(); }
+
+    /**
+     * @brief Calls the function with each visible context, in order of handle.
+     */
+    template <typename Function> void for_each(Function &&function)
+    {
+        for (auto &slot : slots_) {
+            if (slot) {
+                function(*slot);
+            }
+        }
+    }
+
+  private:
+    struct WarmContext {
+        std::string context_id;
+        size_t settings_hash; // Hash of the context's settings, checked before comparing the settings in full.
+        StreamdeckContext context;
+    };
+
+    static size_t settings_hash(const json &settings);
+
+    std::unordered_map<std::string, ContextHandle> handles_; // Handle of each visible context ID.
+    std::vector<std::optional<StreamdeckContext>> slots_;    // Context of each handle, empty for unused handles.
+    std::vector<ContextHandle> free_handles_;                // Unused handles, reused before the array grows.
+
+    size_t warm_capacity_;
+    std::list<WarmContext> warm_contexts_; // Removed contexts, most recently removed first.
+    std::unordered_map<std::string, std::list<WarmContext>::iterator> warm_index_; // By context ID.
+};
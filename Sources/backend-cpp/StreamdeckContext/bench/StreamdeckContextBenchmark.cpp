@@ -0,0 +1,114 @@
+// Copyright 2026 Charles Tytler
+
+#include "benchmark/benchmark.h"
+
+#include "Test/MockESDConnectionManager.h" // Must be called before other includes
+
+#include "SimulatorInterface/Protocols/DcsExportScriptProtocol.h"
+#include "StreamdeckContext/StreamdeckContext.h"
+
+#include <string>
+#include <vector>
+
+namespace bench
+{
+
+/**
+ * @brief Builds a profile of num_contexts contexts, alternating between lamp buttons with an image state and title
+ *        monitor and rotary encoders with a display monitor, each monitoring their own ExportScript IDs.
+ */
+static std::vector<StreamdeckContext> make_profile(const int num_contexts)
+{
+    std::vector<StreamdeckContext> contexts;
+    for (int i = 0; i < num_contexts; i++) {
+        const std::string context_id = "context_" + std::to_string(i);
+        const std::string dcs_id = std::to_string(1000 + i);
+        if (i % 2 == 0) {
+            contexts.emplace_back("com.ctytler.dcs.dcs-bios",
+                                  context_id,
+                                  json{{"dcs_id_compare_monitor", dcs_id},
+                                       {"dcs_id_compare_condition", "GREATER_THAN"},
+                                       {"dcs_id_comparison_value", "0.5"},
+                                       {"dcs_id_string_monitor", dcs_id},
+                                       {"string_monitor_passthrough_check", true}});
+        } else {
+            contexts.emplace_back("com.ctytler.dcs.encoder.rotary",
+                                  context_id,
+                                  json{{"dcs_id_increment_monitor", dcs_id},
+                                       {"increment_step_size", "0.1"},
+                                       {"increment_min", "0"},
+                                       {"increment_max", "1"}});
+        }
+    }
+    return contexts;
+}
+
+/**
+ * @brief Builds an ExportScript datagram setting each monitored ID of a profile to the value.
+ */
+static std::string make_profile_datagram(const int num_contexts, const std::string &value)
+{
+    std::string datagram = "File*";
+    for (int i = 0; i < num_contexts; i++) {
+        datagram += (i > 0 ? ":" : "") + std::to_string(1000 + i) + "=" + value;
+    }
+    return datagram;
+}
+
+static void StreamdeckContext_UpdateContextState(benchmark::State &state)
+{
+    const int num_contexts = static_cast<int>(state.range(0));
+    const bool changing_values = state.range(1) != 0;
+    auto contexts = make_profile(num_contexts);
+    const std::string datagrams[] = {make_profile_datagram(num_contexts, "0.2"),
+                                     make_profile_datagram(num_contexts, "0.8")};
+    DcsExportScriptProtocol simulator_interface({"1968", "1969", "127.0.0.1", ""});
+    simulator_interface.handle_datagram(datagrams[0].data(), datagrams[0].size());
+    MockESDConnectionManager esd_connection_manager;
+
+    size_t frame = 0;
+    for (auto _ : state) {
+        if (changing_values) {
+            const std::string &datagram = datagrams[++frame % 2];
+            simulator_interface.handle_datagram(datagram.data(), datagram.size());
+        }
+        for (auto &context : contexts) {
+            context.updateContextState(&simulator_interface, &esd_connection_manager);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * num_contexts);
+    const auto num_sends = esd_connection_manager.num_calls_to_SetState + esd_connection_manager.num_calls_to_SetTitle;
+    state.counters["sends_per_update"] =
+        benchmark::Counter(static_cast<double>(num_sends), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(StreamdeckContext_UpdateContextState)->ArgNames({"contexts", "changing"})->ArgsProduct({{32, 256}, {0, 1}});
+
+// Outbound messages are serialized by the real connection manager, which discards them without a Stream Deck
+// connection.
+static void ESDConnectionManager_SerializeSetTitle(benchmark::State &state)
+{
+    MockPlugin plugin;
+    ESDConnectionManager connection_manager(0, "", "", "", &plugin);
+    const std::string context = "0123456789ABCDEF0123456789ABCDEF";
+    for (auto _ : state) {
+        connection_manager.SetTitle("\n\nRPM 72", context, kESDSDKTarget_HardwareAndSoftware);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(ESDConnectionManager_SerializeSetTitle);
+
+static void ESDConnectionManager_SerializeSetFeedback(benchmark::State &state)
+{
+    MockPlugin plugin;
+    ESDConnectionManager connection_manager(0, "", "", "", &plugin);
+    const std::string context = "0123456789ABCDEF0123456789ABCDEF";
+    const json feedback = {{"value", {{"value", "0.8"}, {"color", "#FFFFFF"}, {"alignment", "center"}}},
+                           {"indicator", {{"value", 80}}}};
+    for (auto _ : state) {
+        connection_manager.SetFeedback(feedback, context);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(ESDConnectionManager_SerializeSetFeedback);
+
+} // namespace bench
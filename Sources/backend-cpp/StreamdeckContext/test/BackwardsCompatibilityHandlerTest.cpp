@@ -7,22 +7,26 @@
 namespace test
 {
 
-TEST(BackwardsCompatibilityHandlerTest, EmptyPayload) { EXPECT_EQ(json({}), backwardsCompatibilityHandler(json({}))); }
+TEST(BackwardsCompatibilityHandlerTest, EmptySettings) { EXPECT_EQ(json({}), backwardsCompatibleSettings(json({}))); }
 
 TEST(BackwardsCompatibilityHandlerTest, VersionTest)
 {
-    json payload = {{"settings",
-                     {
-                         {"device_id", "device_id"},
-                         {"button_id", "button_id"},
-                     }}};
-    json expectedPayload = {{"settings",
-                             {
-                                 {"device_id", "device_id"},
-                                 {"button_id", "button_id"},
-                                 {"send_address", "device_id,button_id"},
-                             }}};
+    json settings = {
+        {"device_id", "device_id"},
+        {"button_id", "button_id"},
+    };
+    json expectedSettings = {
+        {"device_id", "device_id"},
+        {"button_id", "button_id"},
+        {"send_address", "device_id,button_id"},
+    };
 
-    EXPECT_EQ(expectedPayload.dump(), backwardsCompatibilityHandler(payload).dump());
+    EXPECT_EQ(expectedSettings.dump(), backwardsCompatibleSettings(settings).dump());
+}
+
+TEST(BackwardsCompatibilityHandlerTest, CurrentVersionSettingsUnchanged)
+{
+    const json settings = {{"device_id", "25"}, {"button_id", "3001"}, {"send_address", "26,3002"}};
+    EXPECT_EQ(settings, backwardsCompatibleSettings(settings));
 }
 } // namespace test
@@ -0,0 +1,77 @@
+// Copyright 2026 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "StreamdeckContext/DcsBiosAddressResolver.h"
+
+#include <filesystem>
+#include <fstream>
+
+namespace test
+{
+class DcsBiosAddressResolverTest : public ::testing::Test
+{
+  protected:
+    DcsBiosAddressResolverTest()
+    {
+        std::filesystem::create_directories(root);
+        const json control_reference = {
+            {"Fuel Panel",
+             {{"FUEL_SYS_MASTER",
+               {{"identifier", "FUEL_SYS_MASTER"},
+                {"outputs", {{{"address", 4332}, {"mask", 256}, {"shift_by", 8}, {"type", "integer"}}}}}}}},
+            {"UFC",
+             {{"UFC_SCRATCHPAD",
+               {{"identifier", "UFC_SCRATCHPAD"},
+                {"outputs", {{{"address", 4400}, {"max_length", 12}, {"type", "string"}}}}}}}}};
+        std::ofstream((root / "FA-18C_hornet.json").string()) << control_reference.dump();
+        catalogs.load((root / "FA-18C_hornet.json").string());
+    }
+
+    ~DcsBiosAddressResolverTest() { std::filesystem::remove_all(root); }
+
+    const std::filesystem::path root = "dcs_bios_address_resolver_test";
+    DcsBiosControlCatalogCache catalogs{(root / "cache").string()};
+};
+
+TEST_F(DcsBiosAddressResolverTest, moved_monitors_are_resolved)
+{
+    const json settings = {{"dcs_id_compare_monitor", "INTEGER"},
+                           {"compare_monitor_identifier", "FA-18C_hornet-FUEL_SYS_MASTER"},
+                           {"compare_monitor_address", 1000},
+                           {"compare_monitor_mask", 1},
+                           {"compare_monitor_shift", 0},
+                           {"dcs_id_string_monitor", "STRING"},
+                           {"string_monitor_identifier", "FA-18C_hornet::UFC_SCRATCHPAD"},
+                           {"string_monitor_address", 2000},
+                           {"string_monitor_max_length", 6}};
+    const json resolved = resolveDcsBiosMonitorAddresses(settings, catalogs);
+    EXPECT_EQ(4332, resolved["compare_monitor_address"]);
+    EXPECT_EQ(256, resolved["compare_monitor_mask"]);
+    EXPECT_EQ(8, resolved["compare_monitor_shift"]);
+    EXPECT_EQ(4400, resolved["string_monitor_address"]);
+    EXPECT_EQ(12, resolved["string_monitor_max_length"]);
+    EXPECT_EQ(resolved, resolveDcsBiosMonitorAddresses(resolved, catalogs));
+}
+
+TEST_F(DcsBiosAddressResolverTest, unresolved_monitors_keep_stored_address)
+{
+    const json unknown_control = {{"dcs_id_compare_monitor", "INTEGER"},
+                                  {"compare_monitor_identifier", "FA-18C_hornet-NOT_A_CONTROL"},
+                                  {"compare_monitor_address", 1000}};
+    EXPECT_EQ(unknown_control, resolveDcsBiosMonitorAddresses(unknown_control, catalogs));
+
+    const json unloaded_module = {{"dcs_id_string_monitor", "STRING"},
+                                  {"string_monitor_identifier", "F-16C_50::UFC_SCRATCHPAD"},
+                                  {"string_monitor_address", 2000}};
+    EXPECT_EQ(unloaded_module, resolveDcsBiosMonitorAddresses(unloaded_module, catalogs));
+
+    // An integer monitor is not moved to a string output, nor are ExportScript monitors resolved.
+    const json mismatched_type = {{"dcs_id_compare_monitor", "INTEGER"},
+                                  {"compare_monitor_identifier", "FA-18C_hornet-UFC_SCRATCHPAD"},
+                                  {"compare_monitor_address", 1000}};
+    EXPECT_EQ(mismatched_type, resolveDcsBiosMonitorAddresses(mismatched_type, catalogs));
+    const json export_script = {{"dcs_id_compare_monitor", "250"}, {"dcs_id_string_monitor", "2026"}};
+    EXPECT_EQ(export_script, resolveDcsBiosMonitorAddresses(export_script, catalogs));
+}
+} // namespace test
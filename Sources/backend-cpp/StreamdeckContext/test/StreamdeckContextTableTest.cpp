@@ -0,0 +1,170 @@
+// Copyright 2026 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "Test/MockESDConnectionManager.h" // Must be called before other includes
+
+#include "SimulatorInterface/SimConnectionManager.h"
+#include "StreamdeckContext/StreamdeckContextTable.h"
+
+namespace test
+{
+static constexpr auto dcs_bios_action = "com.ctytler.dcs.dcs-bios";
+static constexpr auto export_script_action = "com.ctytler.dcs.static.button.one-state";
+static constexpr auto encoder_action = "com.ctytler.dcs.encoder.rotary";
+
+TEST(StreamdeckContextTableTest, insert_and_find_contexts)
+{
+    StreamdeckContextTable table;
+    const ContextHandle first = table.insert("ctx_a", StreamdeckContext(dcs_bios_action, "ctx_a", {}));
+    const ContextHandle second = table.insert("ctx_b", StreamdeckContext(export_script_action, "ctx_b", {}));
+    EXPECT_EQ(0, first);
+    EXPECT_EQ(1, second);
+    EXPECT_EQ(2, table.size());
+
+    EXPECT_EQ(first, table.find("ctx_a").value());
+    EXPECT_EQ(second, table.find("ctx_b").value());
+    EXPECT_EQ(Protocol::DCS_BIOS, table.get(first)->protocol());
+    EXPECT_EQ(Protocol::DCS_ExportScript, table.get("ctx_b")->protocol());
+}
+
+TEST(StreamdeckContextTableTest, unknown_context_is_not_added)
+{
+    StreamdeckContextTable table;
+    EXPECT_FALSE(table.find("ctx_a"));
+    EXPECT_EQ(nullptr, table.get("ctx_a"));
+    EXPECT_EQ(nullptr, table.get(ContextHandle{0}));
+    EXPECT_FALSE(table.erase("ctx_a"));
+    EXPECT_EQ(0, table.size());
+}
+
+TEST(StreamdeckContextTableTest, replace_context_keeps_handle)
+{
+    StreamdeckContextTable table;
+    const ContextHandle handle = table.insert("ctx_a", StreamdeckContext(dcs_bios_action, "ctx_a", {}));
+    EXPECT_EQ(handle, table.insert("ctx_a", StreamdeckContext(export_script_action, "ctx_a", {})));
+    EXPECT_EQ(1, table.size());
+    EXPECT_EQ(Protocol::DCS_ExportScript, table.get(handle)->protocol());
+}
+
+TEST(StreamdeckContextTableTest, erased_handle_is_reused)
+{
+    StreamdeckContextTable table;
+    const ContextHandle first = table.insert("ctx_a", StreamdeckContext(dcs_bios_action, "ctx_a", {}));
+    table.insert("ctx_b", StreamdeckContext(dcs_bios_action, "ctx_b", {}));
+
+    EXPECT_TRUE(table.erase("ctx_a"));
+    EXPECT_FALSE(table.find("ctx_a"));
+    EXPECT_EQ(nullptr, table.get(first));
+    EXPECT_EQ(1, table.size());
+
+    EXPECT_EQ(first, table.insert("ctx_c", StreamdeckContext(export_script_action, "ctx_c", {})));
+    EXPECT_EQ(Protocol::DCS_ExportScript, table.get("ctx_c")->protocol());
+    EXPECT_EQ(2, table.size());
+}
+
+TEST(StreamdeckContextTableTest, for_each_visits_visible_contexts_in_handle_order)
+{
+    StreamdeckContextTable table;
+    table.insert("ctx_a", StreamdeckContext(dcs_bios_action, "ctx_a", {}));
+    table.insert("ctx_b", StreamdeckContext(export_script_action, "ctx_b", {}));
+    table.insert("ctx_c", StreamdeckContext(dcs_bios_action, "ctx_c", {}));
+    table.erase("ctx_a");
+
+    std::vector<Protocol> visited;
+    table.for_each([&visited](StreamdeckContext &context) { visited.push_back(context.protocol()); });
+    EXPECT_EQ(std::vector<Protocol>({Protocol::DCS_ExportScript, Protocol::DCS_BIOS}), visited);
+}
+
+TEST(StreamdeckContextTableTest, removed_context_with_same_settings_is_restored)
+{
+    StreamdeckContextTable table;
+    const json settings = {{"dcs_id_compare_monitor", "765"}};
+    table.insert("ctx_a", StreamdeckContext(dcs_bios_action, "ctx_a", settings));
+    table.erase("ctx_a");
+    EXPECT_EQ(0, table.size());
+    EXPECT_EQ(1, table.warm_size());
+
+    const auto handle = table.restore("ctx_a", settings);
+    ASSERT_TRUE(handle);
+    EXPECT_EQ(settings, table.get(handle.value())->settings());
+    EXPECT_EQ(Protocol::DCS_BIOS, table.get("ctx_a")->protocol());
+    EXPECT_EQ(1, table.size());
+    EXPECT_EQ(0, table.warm_size());
+}
+
+TEST(StreamdeckContextTableTest, restored_context_does_not_send_commands_held_back_before_removal)
+{
+    const SimulatorConnectionSettings connection_settings = {"1978", "1979", "127.0.0.1"};
+    // Mock DCS socket uses the reverse rx and tx ports of the simulator interface so it can communicate with it.
+    UdpSocket mock_dcs(connection_settings.ip_address, connection_settings.tx_port, connection_settings.rx_port);
+    SimConnectionManager sim_connection_manager;
+    sim_connection_manager.connect_to_protocol(Protocol::DCS_ExportScript, connection_settings);
+    SimulatorInterface *simulator_interface = sim_connection_manager.get_interface(Protocol::DCS_ExportScript);
+    (void)mock_dcs.receive_stream(); // Consume initial reset command.
+    MockESDConnectionManager esd_connection_manager;
+
+    StreamdeckContextTable table;
+    const json settings = {{"send_address", "23,2"},
+                           {"dcs_id_increment_monitor", "321"},
+                           {"increment_cw", "0.1"},
+                           {"increment_ccw", "-0.1"},
+                           {"increment_min", "0"},
+                           {"increment_max", "1"}};
+    table.insert("ctx_a", StreamdeckContext(encoder_action, "ctx_a", settings));
+    table.get("ctx_a")->handleEncoderRotation(simulator_interface, &esd_connection_manager, 2);
+    table.erase("ctx_a");
+
+    ASSERT_TRUE(table.restore("ctx_a", settings));
+    table.get("ctx_a")->updateContextState(simulator_interface, &esd_connection_manager);
+    // Empty string is due to mock socket functionality when nothing was sent.
+    EXPECT_EQ("", mock_dcs.receive_stream().str());
+}
+
+TEST(StreamdeckContextTableTest, removed_context_with_changed_settings_is_not_restored)
+{
+    StreamdeckContextTable table;
+    table.insert("ctx_a", StreamdeckContext(dcs_bios_action, "ctx_a", {{"dcs_id_compare_monitor", "765"}}));
+    table.erase("ctx_a");
+
+    EXPECT_FALSE(table.restore("ctx_a", {{"dcs_id_compare_monitor", "766"}}));
+    EXPECT_EQ(0, table.size());
+    EXPECT_EQ(0, table.warm_size());
+    EXPECT_FALSE(table.restore("ctx_b", {}));
+}
+
+TEST(StreamdeckContextTableTest, inserted_context_replaces_warm_context)
+{
+    StreamdeckContextTable table;
+    table.insert("ctx_a", StreamdeckContext(dcs_bios_action, "ctx_a", {}));
+    table.erase("ctx_a");
+    table.insert("ctx_a", StreamdeckContext(export_script_action, "ctx_a", {}));
+    EXPECT_EQ(0, table.warm_size());
+    EXPECT_EQ(Protocol::DCS_ExportScript, table.get("ctx_a")->protocol());
+}
+
+TEST(StreamdeckContextTableTest, least_recently_removed_context_is_evicted)
+{
+    StreamdeckContextTable table(2);
+    for (const auto context_id : {"ctx_a", "ctx_b", "ctx_c"}) {
+        table.insert(context_id, StreamdeckContext(dcs_bios_action, context_id, {}));
+    }
+    table.erase("ctx_a");
+    table.erase("ctx_b");
+    table.erase("ctx_c");
+    EXPECT_EQ(2, table.warm_size());
+
+    EXPECT_FALSE(table.restore("ctx_a", {}));
+    EXPECT_TRUE(table.restore("ctx_b", {}));
+    EXPECT_TRUE(table.restore("ctx_c", {}));
+}
+
+TEST(StreamdeckContextTableTest, no_contexts_kept_warm_without_capacity)
+{
+    StreamdeckContextTable table(0);
+    table.insert("ctx_a", StreamdeckContext(dcs_bios_action, "ctx_a", {}));
+    table.erase("ctx_a");
+    EXPECT_EQ(0, table.warm_size());
+    EXPECT_FALSE(table.restore("ctx_a", {}));
+}
+} // namespace test
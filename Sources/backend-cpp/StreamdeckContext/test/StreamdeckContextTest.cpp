@@ -158,6 +158,26 @@ TEST_F(StreamdeckContextTestFixture, force_send_state_update)
     EXPECT_EQ(esd_connection_manager.num_calls_to_SetState, 1);
 }
 
+TEST_F(StreamdeckContextTestFixture, force_send_display)
+{
+    const json settings = {{"dcs_id_compare_monitor", "765"},
+                           {"dcs_id_compare_condition", "EQUAL_TO"},
+                           {"dcs_id_comparison_value", "2.0"},
+                           {"dcs_id_string_monitor", "2026"},
+                           {"string_monitor_passthrough_check", true}};
+    fixture_context.updateContextSettings(settings);
+    fixture_context.updateContextState(simulator_interface, &esd_connection_manager);
+    esd_connection_manager.clear_buffer();
+
+    // Test -- force send will send the last evaluated state and title without a new evaluation.
+    fixture_context.forceSendDisplay(&esd_connection_manager);
+    EXPECT_EQ(esd_connection_manager.context_, "abc123");
+    EXPECT_EQ(esd_connection_manager.state_, 1);
+    EXPECT_EQ(esd_connection_manager.title_, "TEXT_STR");
+    EXPECT_EQ(esd_connection_manager.num_calls_to_SetState, 2);
+    EXPECT_EQ(esd_connection_manager.num_calls_to_SetTitle, 2);
+}
+
 TEST_F(StreamdeckContextTestFixture, force_send_state_update_with_zero_delay)
 {
     // Test 1 -- With updateContextState and no detected state changes, no state is sent to connection manager.
@@ -209,10 +229,10 @@ TEST_F(StreamdeckContextTestFixture, force_send_state_update_negative_delay)
 
 TEST_F(StreamdeckContextTestFixture, handle_keyup_force_state_update_called)
 {
-    const json payload = {{"settings", {}}};
-    fixture_context.handleButtonPressedEvent(simulator_interface, &esd_connection_manager, payload);
+    const int state = 0;
+    fixture_context.handleButtonPressedEvent(simulator_interface, &esd_connection_manager, state);
     EXPECT_EQ(esd_connection_manager.num_calls_to_SetState, 0);
-    fixture_context.handleButtonReleasedEvent(simulator_interface, &esd_connection_manager, payload);
+    fixture_context.handleButtonReleasedEvent(simulator_interface, &esd_connection_manager, state);
     EXPECT_EQ(esd_connection_manager.num_calls_to_SetState, 1);
 }
 
@@ -221,8 +241,8 @@ TEST_F(StreamdeckContextTestFixture, handle_keyup_force_send_state_after_delay)
     const auto action_with_delay_send = "com.ctytler.dcs.up-down.switch.two-state";
     auto test_context = StreamdeckContext(action_with_delay_send, "", {});
 
-    const json payload = {{"settings", {}}};
-    test_context.handleButtonReleasedEvent(simulator_interface, &esd_connection_manager, payload);
+    const int state = 0;
+    test_context.handleButtonReleasedEvent(simulator_interface, &esd_connection_manager, state);
 
     // Test that after Button Released event, a forced state update is sent with delay.
     int delay_count = test_context.NUM_FRAMES_DELAY_FORCED_STATE_UPDATE;
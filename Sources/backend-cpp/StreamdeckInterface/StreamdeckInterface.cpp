@@ -12,18 +12,58 @@
 
 #include "StreamdeckInterface.h"
 
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <filesystem>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <string_view>
 
 #include "ElgatoSD/EPLJSONUtils.h"
 #include "ElgatoSD/ESDConnectionManager.h"
 #include "SimulatorInterface/SimulatorInterfaceParameters.h"
 #include "StreamdeckContext/BackwardsCompatibilityHandler.h"
+#include "StreamdeckContext/DcsBiosAddressResolver.h"
 #include "Utilities/JsonReader.h"
 #include "Utilities/LuaReader.h"
+#include "Utilities/MappedFile.h"
 
 #include "nlohmann/json.hpp"
 using json = nlohmann::json;
 
+namespace
+{
+std::string clickabledata_search_key(const std::string &dcs_install_path,
+                                     const std::string &dcs_savedgames_path,
+                                     const std::string &module)
+{
+    return "clickabledata|" + dcs_install_path + "|" + dcs_savedgames_path + "|" + module;
+}
+
+// Requests of one event from one Property Inspector supersede each other when run in the background.
+std::string request_group(const std::string &context, const std::string &event)
+{
+    return context + "|" + event;
+}
+
+// Events whose requests are run in the background, grouped by request_group().
+constexpr std::array<const char *, 6> BACKGROUND_REQUEST_EVENTS = {"RequestInstalledModules",
+                                                                   "RequestIdLookup",
+                                                                   "SearchClickabledata",
+                                                                   "requestModuleList",
+                                                                   "requestControlReferenceJson",
+                                                                   "SearchControlReference"};
+} // namespace
+
+// Json file mapped and validated by a background task, so its completion sends the file from the same mapping.
+struct StreamdeckInterface::ValidatedJsonFile {
+    std::once_flag validated; // Validated once by the first task, even if requests for the file overlap.
+    std::optional<MappedFile> file;
+    std::string_view text; // Json text of the file, without any byte order mark.
+};
+
 class CallBackTimer
 {
   public:
@@ -115,19 +155,243 @@ void StreamdeckInterface::DidReceiveGlobalSettings(const json &inPayload)
     connection_settings[Protocol::DCS_BIOS] = {"5010", "7778", "127.0.0.1", "239.255.50.10"};
     connection_settings[Protocol::DCS_ExportScript] = {"1725", "26027", "127.0.0.1", ""};
 
+    // A recorded capture may be replayed in place of simulator data, such as to lay out profiles without DCS running.
+    const std::string replay_capture_path = EPLJSONUtils::GetStringByName(settings, "replay_capture_path");
+    const float replay_speed = EPLJSONUtils::GetFloatByName(settings, "replay_speed", 1.0);
+    for (auto &protocol : connection_settings) {
+        protocol.second.replay_capture_path = replay_capture_path;
+        protocol.second.replay_speed = replay_speed;
+    }
+
     // Create first instance of Simulator Interface only done under DidReceiveGlobalSettings to allow for any stored
     // settings to be used before binding socket to default port values.
-    for (const auto &protocol : connection_settings) {
-        if (!simConnectionManager_.is_connected_with_settings(protocol.first, protocol.second)) {
-            try {
-                simConnectionManager_.connect_to_protocol(protocol.first, protocol.second);
-                mConnectionManager->LogMessage("[Plugin] Successfully connected to Simulator Interface UDP port");
-            } catch (const std::exception &e) {
-                mConnectionManager->LogMessage("[Plugin] Caught Exception While Opening Connection: " +
-                                               std::string(e.what()));
+    // Connections are replaced while the timer thread may be updating them, so are swapped under the contexts lock.
+    {
+        std::lock_guard<std::mutex> lock(mVisibleContextsMutex);
+        for (const auto &protocol : connection_settings) {
+            if (!simConnectionManager_.is_connected_with_settings(protocol.first, protocol.second)) {
+                try {
+                    simConnectionManager_.connect_to_protocol(protocol.first, protocol.second);
+                    mDecodedFieldsOutdated = true;
+                    // Commands held back for the replaced connection are not sent to the new one.
+                    mVisibleContexts.for_each([&protocol](StreamdeckContext &context) {
+                        if (context.protocol() == protocol.first) {
+                            context.clearPendingCommands();
+                        }
+                    });
+                    mConnectionManager->LogMessage("[Plugin] Successfully connected to Simulator Interface UDP port");
+                } catch (const std::exception &e) {
+                    mConnectionManager->LogMessage("[Plugin] Caught Exception While Opening Connection: " +
+                                                   std::string(e.what()));
+                }
+            }
+        }
+    }
+
+    // Index the clickabledata of installed modules in the background, so ID lookups are served from the cache.
+    const std::string dcs_install_path = EPLJSONUtils::GetStringByName(settings, "dcs_install_path");
+    const std::string dcs_savedgames_path = EPLJSONUtils::GetStringByName(settings, "dcs_savedgames_path");
+    const std::string dcs_paths = dcs_install_path + "|" + dcs_savedgames_path;
+    bool is_indexed;
+    {
+        std::lock_guard<std::mutex> lock(clickabledataIndexingMutex_);
+        is_indexed = dcs_paths == indexedDcsPaths_;
+    }
+    if (!dcs_install_path.empty() && !is_indexed) {
+        // Listing the installed modules scans directories, so is also done in the background.
+        requestExecutor_.submit(
+            "",
+            "StartClickabledataIndexing|" + dcs_paths,
+            [this, dcs_install_path, dcs_savedgames_path](const std::atomic<bool> &) {
+                StartClickabledataIndexing(dcs_install_path, dcs_savedgames_path);
+                return json();
+            },
+            nullptr);
+    }
+
+    // Load the control catalogs of the installed DCS-BIOS modules in the background, so monitored controls follow
+    // their addresses when DCS-BIOS is updated.
+    const std::string dcs_bios_install_path = EPLJSONUtils::GetStringByName(settings, "dcs_bios_install_path");
+    bool is_cataloged;
+    {
+        std::lock_guard<std::mutex> lock(clickabledataIndexingMutex_);
+        is_cataloged = dcs_bios_install_path == catalogedDcsBiosPath_;
+        if (!dcs_bios_install_path.empty()) {
+            catalogedDcsBiosPath_ = dcs_bios_install_path;
+        }
+    }
+    if (!dcs_bios_install_path.empty() && !is_cataloged) {
+        requestExecutor_.submit(
+            "",
+            "LoadDcsBiosCatalogs|" + dcs_bios_install_path,
+            [this, dcs_bios_install_path](const std::atomic<bool> &) {
+                int num_loaded = 0;
+                for (const auto &json_file : get_control_reference_files(dcs_bios_install_path, directoryIndex_)) {
+                    num_loaded += dcsBiosCatalogs_.load(json_file) ? 1 : 0;
+                }
+                return json(num_loaded);
+            },
+            [this, dcs_bios_install_path](const json &num_loaded) {
+                mConnectionManager->LogMessage("[Plugin] Loaded " + num_loaded.dump() +
+                                               " DCS-BIOS control catalogs from: " + dcs_bios_install_path);
+                ResolveVisibleDcsBiosMonitorAddresses();
+            });
+    }
+}
+
+void StreamdeckInterface::ResolveVisibleDcsBiosMonitorAddresses()
+{
+    LockVisibleContexts();
+    mVisibleContexts.for_each([this](StreamdeckContext &context) {
+        const json settings = resolveDcsBiosMonitorAddresses(context.settings(), dcsBiosCatalogs_);
+        if (settings != context.settings()) {
+            UnregisterDecodedFields(context);
+            context.updateContextSettings(settings);
+            RegisterDecodedFields(context);
+        }
+    });
+    mVisibleContextsMutex.unlock();
+}
+
+void StreamdeckInterface::StartClickabledataIndexing(const std::string &dcs_install_path,
+                                                     const std::string &dcs_savedgames_path,
+                                                     ClickabledataIndexer::ProgressCallback on_progress)
+{
+    const std::string dcs_paths = dcs_install_path + "|" + dcs_savedgames_path;
+    {
+        std::lock_guard<std::mutex> lock(clickabledataIndexingMutex_);
+        if (dcs_paths == indexedDcsPaths_) {
+            // Attach to the indexing already requested, so this requester also receives its progress.
+            if (on_progress) {
+                if (isListingModulesToIndex_) {
+                    pendingIndexingProgressCallbacks_.push_back(std::move(on_progress));
+                } else {
+                    clickabledataIndexer_.add_progress_callback(std::move(on_progress));
+                }
             }
+            return;
+        }
+        indexedDcsPaths_ = dcs_paths;
+        isListingModulesToIndex_ = true;
+        pendingIndexingProgressCallbacks_.clear();
+    }
+
+    std::vector<ClickabledataIndexer::Job> jobs;
+    const std::vector<std::pair<std::string, std::string>> module_dirs = {{dcs_install_path, "/mods/aircraft/"},
+                                                                          {dcs_savedgames_path, "/Mods/aircraft/"}};
+    for (const auto &module_dir : module_dirs) {
+        if (module_dir.first.empty()) {
+            continue;
+        }
+        const json installed_modules_and_result =
+            get_installed_modules(module_dir.first, module_dir.second, directoryIndex_);
+        const auto module_jobs = ClickabledataIndexer::jobs_for_installed_modules(
+            module_dir.first, installed_modules_and_result["installed_modules"].get<std::vector<std::string>>());
+        jobs.insert(jobs.end(), module_jobs.begin(), module_jobs.end());
+    }
+    std::lock_guard<std::mutex> lock(clickabledataIndexingMutex_);
+    if (dcs_paths == indexedDcsPaths_) {
+        // Not superseded by indexing of other paths while the installed modules were listed.
+        clickabledataIndexer_.start(std::move(jobs), std::move(on_progress));
+        for (auto &pending_on_progress : pendingIndexingProgressCallbacks_) {
+            clickabledataIndexer_.add_progress_callback(std::move(pending_on_progress));
+        }
+        pendingIndexingProgressCallbacks_.clear();
+        isListingModulesToIndex_ = false;
+    }
+}
+
+json StreamdeckInterface::GetClickabledata(const std::string &dcs_install_path,
+                                           const std::string &dcs_savedgames_path,
+                                           const std::string &module)
+{
+    json clickabledata_and_result =
+        clickabledataCache_.get_clickabledata(dcs_install_path, module, "bin/extract_clickabledata.lua");
+    if (EPLJSONUtils::GetStringByName(clickabledata_and_result, "result") != "success" &&
+        !dcs_savedgames_path.empty()) {
+        clickabledata_and_result =
+            clickabledataCache_.get_clickabledata(dcs_savedgames_path, module, "bin/extract_clickabledata.lua");
+    }
+    return clickabledata_and_result;
+}
+
+std::shared_ptr<const SearchIndex> StreamdeckInterface::GetControlReferenceSearchIndex(const std::string &filename)
+{
+    std::error_code error;
+    const auto modified_time = std::filesystem::last_write_time(filename, error);
+    if (error) {
+        return nullptr;
+    }
+    const std::string key = "controls|" + filename + "|" + std::to_string(modified_time.time_since_epoch().count());
+    {
+        std::lock_guard<std::mutex> lock(searchIndexesMutex_);
+        const auto cached = searchIndexes_.find(key);
+        if (cached != searchIndexes_.end()) {
+            return cached->second;
         }
     }
+
+    std::optional<json> control_reference;
+    try {
+        control_reference = read_json_file(filename);
+    } catch (const json::exception &) {
+    }
+    if (!control_reference) {
+        return nullptr;
+    }
+    auto search_index =
+        std::make_shared<const SearchIndex>(get_control_reference_items(control_reference.value()),
+                                            std::vector<std::string>{"identifier", "description", "category"});
+    CacheSearchIndex(key, search_index);
+    return search_index;
+}
+
+std::shared_ptr<const SearchIndex> StreamdeckInterface::GetClickabledataSearchIndex(
+    const std::string &dcs_install_path, const std::string &dcs_savedgames_path, const std::string &module)
+{
+    const std::string key = clickabledata_search_key(dcs_install_path, dcs_savedgames_path, module);
+    {
+        std::lock_guard<std::mutex> lock(searchIndexesMutex_);
+        const auto cached = searchIndexes_.find(key);
+        if (cached != searchIndexes_.end()) {
+            return cached->second;
+        }
+    }
+
+    json clickabledata_and_result = GetClickabledata(dcs_install_path, dcs_savedgames_path, module);
+    if (EPLJSONUtils::GetStringByName(clickabledata_and_result, "result") != "success") {
+        return nullptr;
+    }
+    auto search_index = std::make_shared<const SearchIndex>(
+        std::move(clickabledata_and_result["clickabledata_items"]),
+        std::vector<std::string>{"element", "description", "device", "button_id", "dcs_id"});
+    CacheSearchIndex(key, search_index);
+    return search_index;
+}
+
+void StreamdeckInterface::CacheSearchIndex(const std::string &key, std::shared_ptr<const SearchIndex> search_index)
+{
+    std::lock_guard<std::mutex> lock(searchIndexesMutex_);
+    if (searchIndexes_.size() >= MAX_CACHED_SEARCH_INDEXES) {
+        searchIndexes_.clear();
+    }
+    searchIndexes_[key] = std::move(search_index);
+}
+
+std::shared_ptr<StreamdeckInterface::ValidatedJsonFile>
+StreamdeckInterface::GetValidatedJsonFile(const std::string &key)
+{
+    std::lock_guard<std::mutex> lock(validatedJsonFilesMutex_);
+    for (auto it = validatedJsonFiles_.begin(); it != validatedJsonFiles_.end();) {
+        it = it->second.expired() ? validatedJsonFiles_.erase(it) : std::next(it);
+    }
+    auto &shared_file = validatedJsonFiles_[key];
+    auto validated_file = shared_file.lock();
+    if (!validated_file) {
+        validated_file = std::make_shared<ValidatedJsonFile>();
+        shared_file = validated_file;
+    }
+    return validated_file;
 }
 
 void StreamdeckInterface::UpdateFromGameState()
@@ -137,32 +401,106 @@ void StreamdeckInterface::UpdateFromGameState()
     //
 
     // Update the Simulator game state in memory, then update each Streamdeck button context.
-    simConnectionManager_.update_all();
-
-    if (mConnectionManager != nullptr) {
-        mVisibleContextsMutex.lock();
-        for (auto &context : mVisibleContexts) {
-            const auto protocol = context.second.protocol();
+    // Both are done under the contexts lock, which is also held when connections are replaced.
+    if (mConnectionManager == nullptr) {
+        std::lock_guard<std::mutex> lock(mVisibleContextsMutex);
+        simConnectionManager_.update_all();
+    } else {
+        LockVisibleContexts();
+        simConnectionManager_.update_all();
+        if (mDecodedFieldsOutdated.exchange(false)) {
+            RegisterDecodedFields();
+        }
+        mVisibleContexts.for_each([this](StreamdeckContext &context) {
+            const auto protocol = context.protocol();
             if (simConnectionManager_.is_connected(protocol)) {
-                context.second.updateContextState(simConnectionManager_.get_interface(protocol), mConnectionManager);
+                context.updateContextState(simConnectionManager_.get_interface(protocol), mConnectionManager);
+            } else {
+                context.clearPendingCommands();
             }
-        }
+        });
         mVisibleContextsMutex.unlock();
     }
 }
 
+void StreamdeckInterface::LockVisibleContexts()
+{
+    mVisibleContextsMutex.lock();
+    AddAppearedContexts();
+}
+
+void StreamdeckInterface::AddAppearedContexts()
+{
+    std::vector<PendingAppear> appeared;
+    {
+        std::lock_guard<std::mutex> lock(pendingAppearsMutex_);
+        appeared.swap(pendingAppears_);
+    }
+    for (auto &appear : appeared) {
+        // Restore the context as last displayed if it is still warm, or else build it from its settings.
+        auto handle = mVisibleContexts.restore(appear.context, appear.settings);
+        if (!handle) {
+            auto newContext = StreamdeckContext(appear.action, appear.context, appear.settings);
+            if (!newContext.is_valid()) {
+                mConnectionManager->LogMessage("[Plugin] Unable to handle button of type: " + appear.action +
+                                               " context: " + appear.context +
+                                               " with Settings: " + appear.settings.dump());
+                continue;
+            }
+            handle = mVisibleContexts.insert(appear.context, std::move(newContext));
+        }
+        // Make sure the displayed state is synchronized with plugin.
+        StreamdeckContext *context = mVisibleContexts.get(handle.value());
+        RegisterDecodedFields(*context);
+        context->forceSendDisplay(mConnectionManager);
+    }
+}
+
+void StreamdeckInterface::RegisterDecodedFields()
+{
+    for (const auto protocol : {Protocol::DCS_BIOS, Protocol::DCS_ExportScript}) {
+        if (simConnectionManager_.is_connected(protocol)) {
+            simConnectionManager_.get_interface(protocol)->clear_decoded_fields();
+        }
+    }
+    mVisibleContexts.for_each([this](StreamdeckContext &context) {
+        const auto protocol = context.protocol();
+        if (simConnectionManager_.is_connected(protocol)) {
+            context.registerDecodedFields(simConnectionManager_.get_interface(protocol));
+        }
+    });
+}
+
+void StreamdeckInterface::RegisterDecodedFields(StreamdeckContext &context)
+{
+    const auto protocol = context.protocol();
+    if (simConnectionManager_.is_connected(protocol)) {
+        context.registerDecodedFields(simConnectionManager_.get_interface(protocol));
+    }
+}
+
+void StreamdeckInterface::UnregisterDecodedFields(StreamdeckContext &context)
+{
+    const auto protocol = context.protocol();
+    if (simConnectionManager_.is_connected(protocol)) {
+        context.unregisterDecodedFields(simConnectionManager_.get_interface(protocol));
+    }
+}
+
 void StreamdeckInterface::KeyDownForAction(const std::string &inAction,
                                            const std::string &inContext,
                                            const json &inPayload,
                                            const std::string &inDeviceID)
 {
-    const auto payload = backwardsCompatibilityHandler(inPayload);
+    const int state = EPLJSONUtils::GetIntByName(inPayload, "state");
 
-    mVisibleContextsMutex.lock();
-    const auto protocol = mVisibleContexts[inContext].protocol();
-    if (simConnectionManager_.is_connected(protocol)) {
-        mVisibleContexts[inContext].handleButtonPressedEvent(
-            simConnectionManager_.get_interface(protocol), mConnectionManager, payload);
+    LockVisibleContexts();
+    StreamdeckContext *context = mVisibleContexts.get(inContext);
+    if (context != nullptr) {
+        const auto protocol = context->protocol();
+        if (simConnectionManager_.is_connected(protocol)) {
+            context->handleButtonPressedEvent(simConnectionManager_.get_interface(protocol), mConnectionManager, state);
+        }
     }
     mVisibleContextsMutex.unlock();
 }
@@ -172,13 +510,16 @@ void StreamdeckInterface::KeyUpForAction(const std::string &inAction,
                                          const json &inPayload,
                                          const std::string &inDeviceID)
 {
-    const auto payload = backwardsCompatibilityHandler(inPayload);
+    const int state = EPLJSONUtils::GetIntByName(inPayload, "state");
 
-    mVisibleContextsMutex.lock();
-    const auto protocol = mVisibleContexts[inContext].protocol();
-    if (simConnectionManager_.is_connected(protocol)) {
-        mVisibleContexts[inContext].handleButtonReleasedEvent(
-            simConnectionManager_.get_interface(protocol), mConnectionManager, payload);
+    LockVisibleContexts();
+    StreamdeckContext *context = mVisibleContexts.get(inContext);
+    if (context != nullptr) {
+        const auto protocol = context->protocol();
+        if (simConnectionManager_.is_connected(protocol)) {
+            context->handleButtonReleasedEvent(
+                simConnectionManager_.get_interface(protocol), mConnectionManager, state);
+        }
     }
     mVisibleContextsMutex.unlock();
 }
@@ -188,21 +529,16 @@ void StreamdeckInterface::DialRotateForAction(const std::string &inAction,
                                               const json &inPayload,
                                               const std::string &inDeviceID)
 {
-    const auto payload = backwardsCompatibilityHandler(inPayload);
+    // Get rotation ticks from payload (positive = clockwise, negative = counter-clockwise)
+    const int ticks = EPLJSONUtils::GetIntByName(inPayload, "ticks");
 
-    mVisibleContextsMutex.lock();
-    if (mVisibleContexts.count(inContext) > 0) {
-        const auto protocol = mVisibleContexts[inContext].protocol();
+    LockVisibleContexts();
+    StreamdeckContext *context = mVisibleContexts.get(inContext);
+    if (context != nullptr) {
+        const auto protocol = context->protocol();
         if (simConnectionManager_.is_connected(protocol)) {
-            // Get rotation ticks from payload (positive = clockwise, negative = counter-clockwise)
-            int ticks = 0;
-            if (payload.contains("ticks")) {
-                ticks = payload["ticks"].get<int>();
-            }
-            
             // Call the encoder-specific rotation handler with direction
-            mVisibleContexts[inContext].handleEncoderRotation(
-                simConnectionManager_.get_interface(protocol), mConnectionManager, payload, ticks);
+            context->handleEncoderRotation(simConnectionManager_.get_interface(protocol), mConnectionManager, ticks);
         }
     }
     mVisibleContextsMutex.unlock();
@@ -213,19 +549,17 @@ void StreamdeckInterface::DialPressForAction(const std::string &inAction,
                                             const json &inPayload,
                                             const std::string &inDeviceID)
 {
-    const auto payload = backwardsCompatibilityHandler(inPayload);
-    
     // Check if this is a press or release event
-    const bool pressed = EPLJSONUtils::GetBoolByName(payload, "pressed", true);
+    const bool pressed = EPLJSONUtils::GetBoolByName(inPayload, "pressed", true);
     
-    mVisibleContextsMutex.lock();
-    if (mVisibleContexts.count(inContext) > 0) {
-        const auto protocol = mVisibleContexts[inContext].protocol();
+    LockVisibleContexts();
+    StreamdeckContext *context = mVisibleContexts.get(inContext);
+    if (context != nullptr) {
+        const auto protocol = context->protocol();
         if (simConnectionManager_.is_connected(protocol)) {
             if (!pressed) {
                 // Only handle the release event to send the fixed value
-                mVisibleContexts[inContext].handleEncoderPress(
-                    simConnectionManager_.get_interface(protocol), mConnectionManager, payload);
+                context->handleEncoderPress(simConnectionManager_.get_interface(protocol), mConnectionManager);
             }
         }
     }
@@ -237,15 +571,13 @@ void StreamdeckInterface::DialUpForAction(const std::string &inAction,
                                          const json &inPayload,
                                          const std::string &inDeviceID)
 {
-    const auto payload = backwardsCompatibilityHandler(inPayload);
-    
-    mVisibleContextsMutex.lock();
-    if (mVisibleContexts.count(inContext) > 0) {
-        const auto protocol = mVisibleContexts[inContext].protocol();
+    LockVisibleContexts();
+    StreamdeckContext *context = mVisibleContexts.get(inContext);
+    if (context != nullptr) {
+        const auto protocol = context->protocol();
         if (simConnectionManager_.is_connected(protocol)) {
             // Handle encoder release - send the fixed value
-            mVisibleContexts[inContext].handleEncoderPress(
-                simConnectionManager_.get_interface(protocol), mConnectionManager, payload);
+            context->handleEncoderPress(simConnectionManager_.get_interface(protocol), mConnectionManager);
         }
     }
     mVisibleContextsMutex.unlock();
@@ -256,17 +588,17 @@ void StreamdeckInterface::TouchTapForAction(const std::string &inAction,
                                            const json &inPayload,
                                            const std::string &inDeviceID)
 {
-    const auto payload = backwardsCompatibilityHandler(inPayload);
+    const int state = EPLJSONUtils::GetIntByName(inPayload, "state");
 
-    mVisibleContextsMutex.lock();
-    if (mVisibleContexts.count(inContext) > 0) {
-        const auto protocol = mVisibleContexts[inContext].protocol();
+    LockVisibleContexts();
+    StreamdeckContext *context = mVisibleContexts.get(inContext);
+    if (context != nullptr) {
+        const auto protocol = context->protocol();
         if (simConnectionManager_.is_connected(protocol)) {
             // Treat touch tap as a momentary button press
-            mVisibleContexts[inContext].handleButtonPressedEvent(
-                simConnectionManager_.get_interface(protocol), mConnectionManager, payload);
-            mVisibleContexts[inContext].handleButtonReleasedEvent(
-                simConnectionManager_.get_interface(protocol), mConnectionManager, payload);
+            context->handleButtonPressedEvent(simConnectionManager_.get_interface(protocol), mConnectionManager, state);
+            context->handleButtonReleasedEvent(
+                simConnectionManager_.get_interface(protocol), mConnectionManager, state);
         }
     }
     mVisibleContextsMutex.unlock();
@@ -277,19 +609,14 @@ void StreamdeckInterface::WillAppearForAction(const std::string &inAction,
                                               const json &inPayload,
                                               const std::string &inDeviceID)
 {
-    const auto settings = inPayload["settings"];
-    auto newContext = StreamdeckContext(inAction, inContext, settings);
-
-    if (newContext.is_valid()) {
-        mVisibleContextsMutex.lock();
-        // Remember the context and make sure state is synchronized with plugin.
-        mVisibleContexts[inContext] = std::move(newContext);
-        mVisibleContexts[inContext].forceSendState(mConnectionManager);
-        mVisibleContextsMutex.unlock();
-    } else {
-        mConnectionManager->LogMessage("[Plugin] Unable to handle button of type: " + inAction +
-                                       " context: " + inContext + " with Settings: " + settings.dump());
-    }
+    // Migrate settings and resolve monitored DCS-BIOS addresses once here, so events of the context use the stored
+    // settings as-is.
+    PendingAppear appear{inAction,
+                         inContext,
+                         resolveDcsBiosMonitorAddresses(backwardsCompatibleSettings(inPayload["settings"]),
+                                                        dcsBiosCatalogs_)};
+    std::lock_guard<std::mutex> lock(pendingAppearsMutex_);
+    pendingAppears_.push_back(std::move(appear));
 }
 
 void StreamdeckInterface::WillDisappearForAction(const std::string &inAction,
@@ -298,11 +625,25 @@ void StreamdeckInterface::WillDisappearForAction(const std::string &inAction,
                                                  const std::string &inDeviceID)
 {
     // Remove the context.
-    mVisibleContextsMutex.lock();
-    mVisibleContexts.erase(inContext);
+    LockVisibleContexts();
+    StreamdeckContext *context = mVisibleContexts.get(inContext);
+    if (context != nullptr) {
+        UnregisterDecodedFields(*context);
+        mVisibleContexts.erase(inContext);
+    }
     mVisibleContextsMutex.unlock();
 }
 
+void StreamdeckInterface::PropertyInspectorDidDisappear(const std::string &inAction,
+                                                        const std::string &inContext,
+                                                        const std::string &inDeviceID)
+{
+    // Results of the closed Property Inspector's requests are no longer wanted.
+    for (const char *event : BACKGROUND_REQUEST_EVENTS) {
+        requestExecutor_.cancel_group(request_group(inContext, event));
+    }
+}
+
 void StreamdeckInterface::DeviceDidConnect(const std::string &inDeviceID, const json &inDeviceInfo)
 {
     // Request global settings from Streamdeck.
@@ -325,9 +666,13 @@ void StreamdeckInterface::SendToPlugin(const std::string &inAction,
 
     if (event == "SettingsUpdate") {
         // Update settings for the specified context -- triggered by Property Inspector detecting a change.
-        mVisibleContextsMutex.lock();
-        if (mVisibleContexts.count(inContext) > 0) {
-            mVisibleContexts[inContext].updateContextSettings(inPayload["settings"]);
+        LockVisibleContexts();
+        StreamdeckContext *context = mVisibleContexts.get(inContext);
+        if (context != nullptr) {
+            UnregisterDecodedFields(*context);
+            context->updateContextSettings(
+                resolveDcsBiosMonitorAddresses(backwardsCompatibleSettings(inPayload["settings"]), dcsBiosCatalogs_));
+            RegisterDecodedFields(*context);
         }
         mVisibleContextsMutex.unlock();
     }
@@ -354,89 +699,220 @@ void StreamdeckInterface::SendToPlugin(const std::string &inAction,
     if (event == "RequestInstalledModules") {
         const std::string dcs_install_path = EPLJSONUtils::GetStringByName(inPayload, "dcs_install_path");
         const std::string dcs_savedgames_path = EPLJSONUtils::GetStringByName(inPayload, "dcs_savedgames_path");
-        const std::string modules_subdir = "/mods/aircraft/";
-        
-        mConnectionManager->LogMessage("[Plugin] RequestInstalledModules received - Install path: " + dcs_install_path + 
+
+        mConnectionManager->LogMessage("[Plugin] RequestInstalledModules received - Install path: " + dcs_install_path +
                                        ", Saved games path: " + dcs_savedgames_path);
-        
-        // Get modules from both installation and saved games paths
-        json installed_modules_and_result = get_installed_modules(dcs_install_path, modules_subdir);
-        
-        // If savedgames path is provided, also scan it and merge results
-        if (!dcs_savedgames_path.empty()) {
-            json savedgames_modules = get_installed_modules(dcs_savedgames_path, "/Mods/aircraft/");
-            if (EPLJSONUtils::GetStringByName(savedgames_modules, "result") == "success") {
-                // Merge modules from savedgames into the main list
-                for (const auto& module : savedgames_modules["installed_modules"]) {
-                    installed_modules_and_result["installed_modules"].push_back(module);
+
+        requestExecutor_.submit(
+            request_group(inContext, event),
+            event + "|" + dcs_install_path + "|" + dcs_savedgames_path,
+            [this, inAction, inContext, dcs_install_path, dcs_savedgames_path](const std::atomic<bool> &is_cancelled) {
+                // Get modules from both installation and saved games paths
+                json installed_modules_and_result =
+                    get_installed_modules(dcs_install_path, "/mods/aircraft/", directoryIndex_);
+
+                // If savedgames path is provided, also scan it and merge results
+                if (!dcs_savedgames_path.empty() && !is_cancelled) {
+                    json savedgames_modules =
+                        get_installed_modules(dcs_savedgames_path, "/Mods/aircraft/", directoryIndex_);
+                    if (EPLJSONUtils::GetStringByName(savedgames_modules, "result") == "success") {
+                        // Merge modules from savedgames into the main list
+                        for (const auto &module : savedgames_modules["installed_modules"]) {
+                            installed_modules_and_result["installed_modules"].push_back(module);
+                        }
+                    }
                 }
-            }
-        }
-        
-        const std::string result = EPLJSONUtils::GetStringByName(installed_modules_and_result, "result");
-        if (result != "success") {
-            mConnectionManager->LogMessage("[DCS-ExportScript:IdLookupWindow] Get Installed Modules Failure: " +
-                                           result);
-        } else {
-            const int module_count = static_cast<int>(installed_modules_and_result["installed_modules"].size());
-            mConnectionManager->LogMessage("[Plugin] Successfully found " + std::to_string(module_count) + 
-                                          " modules, sending to Property Inspector");
-        }
-        mConnectionManager->SendToPropertyInspector(
-            inAction,
-            inContext,
-            json({{"event", "InstalledModules"},
-                  {"installed_modules", installed_modules_and_result["installed_modules"]}}));
+                if (is_cancelled) {
+                    return installed_modules_and_result;
+                }
+
+                StartClickabledataIndexing(
+                    dcs_install_path,
+                    dcs_savedgames_path,
+                    [this, inAction, inContext](const ClickabledataIndexer::Progress &progress) {
+                        mConnectionManager->SendToPropertyInspector(inAction,
+                                                                    inContext,
+                                                                    json({{"event", "ClickabledataIndexProgress"},
+                                                                          {"completed", progress.num_completed},
+                                                                          {"total", progress.num_jobs},
+                                                                          {"module", progress.module_name},
+                                                                          {"success", progress.success}}));
+                    });
+                return installed_modules_and_result;
+            },
+            [this, inAction, inContext](const json &installed_modules_and_result) {
+                const std::string result = EPLJSONUtils::GetStringByName(installed_modules_and_result, "result");
+                if (result != "success") {
+                    mConnectionManager->LogMessage("[DCS-ExportScript:IdLookupWindow] Get Installed Modules Failure: " +
+                                                   result);
+                } else {
+                    const int module_count = static_cast<int>(installed_modules_and_result["installed_modules"].size());
+                    mConnectionManager->LogMessage("[Plugin] Successfully found " + std::to_string(module_count) +
+                                                   " modules, sending to Property Inspector");
+                }
+                const json installed_modules = installed_modules_and_result.value("installed_modules", json::array());
+                mConnectionManager->SendToPropertyInspector(
+                    inAction,
+                    inContext,
+                    json({{"event", "InstalledModules"}, {"installed_modules", installed_modules}}));
+            });
     }
 
     if (event == "RequestIdLookup") {
         const std::string dcs_install_path = EPLJSONUtils::GetStringByName(inPayload, "dcs_install_path");
         const std::string dcs_savedgames_path = EPLJSONUtils::GetStringByName(inPayload, "dcs_savedgames_path");
         const std::string module = EPLJSONUtils::GetStringByName(inPayload, "module");
-        
+
         mConnectionManager->LogMessage("[Plugin] RequestIdLookup received for module: " + module);
-        
-        // Try installation path first
-        json clickabledata_and_result = get_clickabledata(dcs_install_path, module, "bin/extract_clickabledata.lua");
-        std::string lua_result = EPLJSONUtils::GetStringByName(clickabledata_and_result, "result");
-        
-        // If not found and savedgames path is provided, try savedgames path
-        if (lua_result != "success" && !dcs_savedgames_path.empty()) {
-            clickabledata_and_result = get_clickabledata(dcs_savedgames_path, module, "bin/extract_clickabledata.lua");
-            lua_result = EPLJSONUtils::GetStringByName(clickabledata_and_result, "result");
-        }
-        
-        if (lua_result != "success") {
-            mConnectionManager->LogMessage("[DCS-ExportScript:IdLookupWindow] " + module +
-                                           " Clickabledata Result: " + lua_result);
-        }
-        mConnectionManager->SendToPropertyInspector(
-            inAction,
-            inContext,
-            json({{"event", "Clickabledata"}, {"clickabledata", clickabledata_and_result["clickabledata_items"]}}));
+
+        // A lookup of another module from the same Property Inspector supersedes this one.
+        requestExecutor_.submit(
+            request_group(inContext, event),
+            event + "|" + dcs_install_path + "|" + dcs_savedgames_path + "|" + module,
+            [this, dcs_install_path, dcs_savedgames_path, module](const std::atomic<bool> &) {
+                json clickabledata_and_result = GetClickabledata(dcs_install_path, dcs_savedgames_path, module);
+                // Searches of the module are indexed again from the clickabledata as now extracted.
+                std::lock_guard<std::mutex> lock(searchIndexesMutex_);
+                searchIndexes_.erase(clickabledata_search_key(dcs_install_path, dcs_savedgames_path, module));
+                return clickabledata_and_result;
+            },
+            [this, inAction, inContext, module](const json &clickabledata_and_result) {
+                const std::string lua_result = EPLJSONUtils::GetStringByName(clickabledata_and_result, "result");
+                if (lua_result != "success") {
+                    mConnectionManager->LogMessage("[DCS-ExportScript:IdLookupWindow] " + module +
+                                                   " Clickabledata Result: " + lua_result);
+                }
+                const json clickabledata = clickabledata_and_result.value("clickabledata_items", json::array());
+                mConnectionManager->SendToPropertyInspector(
+                    inAction, inContext, json({{"event", "Clickabledata"}, {"clickabledata", clickabledata}}));
+            });
+    }
+
+    if (event == "SearchClickabledata") {
+        // Answers each ID lookup query with a page of ranked results, rather than the module's whole clickabledata.
+        // Each query from a Property Inspector supersedes its earlier queries. A "refresh" query, sent when a module is
+        // selected, indexes the module again from its clickabledata as now extracted.
+        const std::string dcs_install_path = EPLJSONUtils::GetStringByName(inPayload, "dcs_install_path");
+        const std::string dcs_savedgames_path = EPLJSONUtils::GetStringByName(inPayload, "dcs_savedgames_path");
+        const std::string module = EPLJSONUtils::GetStringByName(inPayload, "module");
+        const std::string query = EPLJSONUtils::GetStringByName(inPayload, "query");
+        const int offset = std::max(0, EPLJSONUtils::GetIntByName(inPayload, "offset"));
+        const int limit = std::max(0, EPLJSONUtils::GetIntByName(inPayload, "limit", SearchIndex::DEFAULT_PAGE_SIZE));
+        const bool refresh = EPLJSONUtils::GetBoolByName(inPayload, "refresh");
+        requestExecutor_.submit(
+            request_group(inContext, event),
+            event + "|" + clickabledata_search_key(dcs_install_path, dcs_savedgames_path, module) + "|" + query + "|" +
+                std::to_string(offset) + "|" + std::to_string(limit) + "|" + std::to_string(refresh),
+            [this, dcs_install_path, dcs_savedgames_path, module, query, offset, limit, refresh](
+                const std::atomic<bool> &is_cancelled) {
+                if (refresh) {
+                    std::lock_guard<std::mutex> lock(searchIndexesMutex_);
+                    searchIndexes_.erase(clickabledata_search_key(dcs_install_path, dcs_savedgames_path, module));
+                }
+                const auto search_index = GetClickabledataSearchIndex(dcs_install_path, dcs_savedgames_path, module);
+                if (!search_index) {
+                    return json({{"result", "Unable to search clickabledata of module: " + module}});
+                }
+                return is_cancelled ? json() : search_index->page(query, offset, limit);
+            },
+            [this, inAction, inContext, module, query](const json &results) {
+                if (results.contains("result")) {
+                    mConnectionManager->LogMessage("[Plugin] " + results["result"].get<std::string>());
+                    return;
+                }
+                json search_results = results;
+                search_results["event"] = "ClickabledataSearchResults";
+                search_results["module"] = module;
+                search_results["query"] = query;
+                mConnectionManager->SendToPropertyInspector(inAction, inContext, search_results);
+            });
     }
 
     if (event == "requestModuleList") {
         const std::string path = EPLJSONUtils::GetStringByName(inPayload, "path");
-        const auto maybe_module_list = get_module_list(path);
-        if (maybe_module_list) {
-            mConnectionManager->SendToPropertyInspector(
-                inAction, inContext, json({{"event", "ModuleList"}, {"moduleList", maybe_module_list.value()}}));
-            mConnectionManager->LogMessage("[Plugin] Successfully found json modules at: " + path);
-        } else {
-            mConnectionManager->LogMessage("[Plugin] Get list of json modules failed at: " + path);
-        }
+        requestExecutor_.submit(
+            request_group(inContext, event),
+            event + "|" + path,
+            [this, path](const std::atomic<bool> &) {
+                const auto maybe_module_list = get_module_list(path, directoryIndex_);
+                return maybe_module_list ? maybe_module_list.value() : json();
+            },
+            [this, inAction, inContext, path](const json &module_list) {
+                if (module_list.is_array()) {
+                    mConnectionManager->SendToPropertyInspector(
+                        inAction, inContext, json({{"event", "ModuleList"}, {"moduleList", module_list}}));
+                    mConnectionManager->LogMessage("[Plugin] Successfully found json modules at: " + path);
+                } else {
+                    mConnectionManager->LogMessage("[Plugin] Get list of json modules failed at: " + path);
+                }
+            });
     }
 
     if (event == "requestControlReferenceJson") {
+        // The json file is validated in place and sent as-is from the same mapping, rather than parsed into a json
+        // object and serialized again. Requests for a file already in flight, from any Property Inspector, share its
+        // validation and are each answered from the one mapping.
         const std::string filename = EPLJSONUtils::GetStringByName(inPayload, "filename");
-        const auto maybe_json = read_json_file(filename);
-        if (maybe_json) {
-            mConnectionManager->SendToPropertyInspector(
-                inAction, inContext, json({{"event", "JsonFile"}, {"jsonFile", maybe_json.value()}}));
-            mConnectionManager->LogMessage("[Plugin] Successfully read in json file from: " + filename);
-        } else {
-            mConnectionManager->LogMessage("[Plugin] Unable to read in json file from: " + filename);
-        }
+        const std::string key = event + "|" + filename;
+        const auto validated_file = GetValidatedJsonFile(key);
+        requestExecutor_.submit(
+            request_group(inContext, event),
+            key,
+            [filename, validated_file](const std::atomic<bool> &) {
+                std::call_once(validated_file->validated, [&filename, &validated_file]() {
+                    try {
+                        validated_file->file.emplace(filename);
+                    } catch (const std::exception &) {
+                        return;
+                    }
+                    const MappedFile &json_file = validated_file->file.value();
+                    const auto json_text = get_valid_json_text(std::string_view(json_file.data(), json_file.size()));
+                    if (!json_text) {
+                        validated_file->file.reset();
+                        return;
+                    }
+                    validated_file->text = json_text.value();
+                });
+                return json(validated_file->file.has_value());
+            },
+            [this, inAction, inContext, filename, validated_file](const json &is_valid) {
+                if (is_valid == true) {
+                    mConnectionManager->SendRawJsonToPropertyInspector(
+                        inAction, inContext, json({{"event", "JsonFile"}}), "jsonFile", validated_file->text);
+                    mConnectionManager->LogMessage("[Plugin] Successfully read in json file from: " + filename);
+                } else {
+                    mConnectionManager->LogMessage("[Plugin] Unable to read in json file from: " + filename);
+                }
+            });
+    }
+
+    if (event == "SearchControlReference") {
+        // Answers each control search query with a page of ranked results, rather than the whole control reference.
+        // Each query from a Property Inspector supersedes its earlier queries.
+        const std::string filename = EPLJSONUtils::GetStringByName(inPayload, "filename");
+        const std::string query = EPLJSONUtils::GetStringByName(inPayload, "query");
+        const int offset = std::max(0, EPLJSONUtils::GetIntByName(inPayload, "offset"));
+        const int limit = std::max(0, EPLJSONUtils::GetIntByName(inPayload, "limit", SearchIndex::DEFAULT_PAGE_SIZE));
+        requestExecutor_.submit(
+            request_group(inContext, event),
+            event + "|" + filename + "|" + query + "|" + std::to_string(offset) + "|" + std::to_string(limit),
+            [this, filename, query, offset, limit](const std::atomic<bool> &is_cancelled) {
+                const auto search_index = GetControlReferenceSearchIndex(filename);
+                if (!search_index) {
+                    return json({{"result", "Unable to search json file from: " + filename}});
+                }
+                return is_cancelled ? json() : search_index->page(query, offset, limit);
+            },
+            [this, inAction, inContext, filename, query](const json &results) {
+                if (results.contains("result")) {
+                    mConnectionManager->LogMessage("[Plugin] " + results["result"].get<std::string>());
+                    return;
+                }
+                json search_results = results;
+                search_results["event"] = "ControlReferenceSearchResults";
+                search_results["filename"] = filename;
+                search_results["query"] = query;
+                mConnectionManager->SendToPropertyInspector(inAction, inContext, search_results);
+            });
     }
 }
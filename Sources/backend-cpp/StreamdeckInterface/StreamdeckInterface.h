@@ -11,12 +11,22 @@
 //==============================================================================
 
 #include "ElgatoSD/ESDBasePlugin.h"
+#include "SimulatorInterface/Protocols/DcsBiosControlCatalogCache.h"
 #include "SimulatorInterface/SimConnectionManager.h"
 #include "StreamdeckContext/StreamdeckContext.h"
-
+#include "StreamdeckContext/StreamdeckContextTable.h"
+#include "Utilities/ClickabledataCache.h"
+#include "Utilities/ClickabledataIndexer.h"
+#include "Utilities/DirectoryIndex.h"
+#include "Utilities/RequestExecutor.h"
+#include "Utilities/SearchIndex.h"
+
+#include <atomic>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 class CallBackTimer;
 
@@ -70,6 +80,13 @@ class StreamdeckInterface : public ESDBasePlugin
                                 const json &inPayload,
                                 const std::string &inDeviceID) override;
 
+    /**
+     * @brief Cancels the background requests of a Property Inspector once it is closed.
+     */
+    void PropertyInspectorDidDisappear(const std::string &inAction,
+                                       const std::string &inContext,
+                                       const std::string &inDeviceID) override;
+
     void DeviceDidConnect(const std::string &inDeviceID, const json &inDeviceInfo) override;
     void DeviceDidDisconnect(const std::string &inDeviceID) override;
 
@@ -86,6 +103,37 @@ class StreamdeckInterface : public ESDBasePlugin
      */
     void UpdateFromGameState();
 
+    /**
+     * @brief Locks mVisibleContextsMutex, first adding the contexts of any pending appear events so every event handled
+     *        under the lock sees the contexts which have appeared before it.
+     */
+    void LockVisibleContexts();
+
+    /**
+     * @brief Adds the contexts of all pending appear events as one batch, restoring warm contexts where possible, and
+     *        sends each its current display. Must be called with mVisibleContextsMutex held.
+     */
+    void AddAppearedContexts();
+
+    /**
+     * @brief Rebuilds the decoded fields of each connected simulator interface from the monitors of visible contexts,
+     *        e.g. after a protocol reconnects. Must be called with mVisibleContextsMutex held.
+     */
+    void RegisterDecodedFields();
+
+    /**
+     * @brief Registers or unregisters the decoded fields of a single context with its simulator interface, if
+     *        connected, as it appears, disappears or changes settings. Must be called with mVisibleContextsMutex held.
+     */
+    void RegisterDecodedFields(StreamdeckContext &context);
+    void UnregisterDecodedFields(StreamdeckContext &context);
+
+    /**
+     * @brief Updates the settings of visible contexts to the addresses of their monitored DCS-BIOS controls in the
+     *        loaded control catalogs.
+     */
+    void ResolveVisibleDcsBiosMonitorAddresses();
+
     /**
      * @brief Helper function to extract connection settings from global settings
      *
@@ -94,9 +142,93 @@ class StreamdeckInterface : public ESDBasePlugin
      */
     SimulatorConnectionSettings get_connection_settings(const json &global_settings);
 
+    /**
+     * @brief Starts extracting the clickabledata of every module installed in the DCS paths into the cache, in the
+     *        background, replacing any indexing in progress.
+     *
+     *   If the DCS paths were the most recently indexed, indexing is not restarted and on_progress is instead added to
+     *   the indexing already underway, first receiving its latest progress.
+     *
+     * @param on_progress Called from an indexing thread after each module.
+     */
+    void StartClickabledataIndexing(const std::string &dcs_install_path,
+                                    const std::string &dcs_savedgames_path,
+                                    ClickabledataIndexer::ProgressCallback on_progress = nullptr);
+
+    /**
+     * @brief Get the clickabledata of a module from the DCS installation path, or else from the saved games path.
+     *
+     * @return Json object with the "result" of the extraction and its "clickabledata_items".
+     */
+    json GetClickabledata(const std::string &dcs_install_path,
+                          const std::string &dcs_savedgames_path,
+                          const std::string &module);
+
+    /**
+     * @brief Get the search index of a control reference json file, building it when the file is first searched or
+     *        has been modified.
+     *
+     * @return Search index, or nullptr if the file cannot be read.
+     */
+    std::shared_ptr<const SearchIndex> GetControlReferenceSearchIndex(const std::string &filename);
+
+    /**
+     * @brief Get the search index of a module's clickabledata, building it when the module is first searched.
+     *
+     * @return Search index, or nullptr if the clickabledata cannot be extracted.
+     */
+    std::shared_ptr<const SearchIndex> GetClickabledataSearchIndex(const std::string &dcs_install_path,
+                                                                   const std::string &dcs_savedgames_path,
+                                                                   const std::string &module);
+
+    /**
+     * @brief Caches a search index, first dropping all cached indexes if the cache is full.
+     */
+    void CacheSearchIndex(const std::string &key, std::shared_ptr<const SearchIndex> search_index);
+
+    struct ValidatedJsonFile;
+
+    /**
+     * @brief Get the json file validated for a request, shared with every request for the same key while any of them
+     *        hold it, so requests sharing one run of the validation each send the file from its mapping.
+     */
+    std::shared_ptr<ValidatedJsonFile> GetValidatedJsonFile(const std::string &key);
+
     std::mutex mVisibleContextsMutex;
-    std::unordered_map<std::string, StreamdeckContext> mVisibleContexts = {};
+    StreamdeckContextTable mVisibleContexts;
+
+    // Appear events not yet added to mVisibleContexts. A page or profile flip delivers a burst of these, which are
+    // added together the next time the visible contexts are locked.
+    struct PendingAppear {
+        std::string action;
+        std::string context;
+        json settings;
+    };
+    std::mutex pendingAppearsMutex_;
+    std::vector<PendingAppear> pendingAppears_;
+    std::atomic<bool> mDecodedFieldsOutdated{true}; // Set when connections change.
     SimConnectionManager simConnectionManager_;
+    DirectoryIndex directoryIndex_;                                // Module and json folder contents.
+    ClickabledataCache clickabledataCache_{"cache/clickabledata"}; // Relative to the plugin directory.
+    ClickabledataIndexer clickabledataIndexer_{clickabledataCache_, "bin/extract_clickabledata.lua"};
+    std::mutex clickabledataIndexingMutex_;
+    std::string indexedDcsPaths_; // DCS paths most recently indexed, so indexing only restarts when they change.
+    // Progress callbacks added while the installed modules of indexedDcsPaths_ are listed, before indexing starts.
+    bool isListingModulesToIndex_ = false;
+    std::vector<ClickabledataIndexer::ProgressCallback> pendingIndexingProgressCallbacks_;
+    DcsBiosControlCatalogCache dcsBiosCatalogs_{"cache/dcs-bios"}; // Relative to the plugin directory.
+    std::string catalogedDcsBiosPath_; // DCS-BIOS path whose catalogs were last loaded, guarded as indexedDcsPaths_.
+
+    static constexpr size_t MAX_CACHED_SEARCH_INDEXES = 8;
+    std::mutex searchIndexesMutex_;
+    std::unordered_map<std::string, std::shared_ptr<const SearchIndex>> searchIndexes_; // By searched file or module.
+
+    std::mutex validatedJsonFilesMutex_;
+    std::unordered_map<std::string, std::weak_ptr<ValidatedJsonFile>> validatedJsonFiles_; // By request key.
+
+    // Runs Property Inspector requests which read files or extract clickabledata, so they do not block key and dial
+    // events. Declared after the members requests use, so requests finish before those members are destroyed.
+    RequestExecutor requestExecutor_;
 
     CallBackTimer *mTimer;
 };
@@ -0,0 +1,207 @@
+// Copyright 2026 Charles Tytler
+
+#include "ClickabledataCache.h"
+
+#include "LuaReader.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+void hash_bytes(uint64_t &hash, const void *data, const size_t size)
+{
+    const auto *bytes = static_cast<const unsigned char *>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+}
+
+void hash_file_attributes(uint64_t &hash, const std::filesystem::path &path, const std::string &name)
+{
+    std::error_code ec;
+    const auto size = static_cast<uint64_t>(std::filesystem::file_size(path, ec));
+    const auto modified_time =
+        static_cast<int64_t>(std::filesystem::last_write_time(path, ec).time_since_epoch().count());
+    hash_bytes(hash, name.data(), name.size());
+    hash_bytes(hash, &size, sizeof(size));
+    hash_bytes(hash, &modified_time, sizeof(modified_time));
+}
+
+/**
+ * @brief Get the aircraft folder holding a module's cockpit scripts.
+ *
+ *   Matches the special cases of the extraction script.
+ */
+std::string module_folder(const std::string &module_name)
+{
+    if (module_name.find("C-101") != std::string::npos) {
+        return "C-101";
+    }
+    if (module_name.find("L-39") != std::string::npos) {
+        return "L-39C";
+    }
+    return module_name;
+}
+} // namespace
+
+ClickabledataCache::ClickabledataCache(const std::string &cache_directory,
+                                       Extractor extractor,
+                                       const std::chrono::milliseconds fingerprint_check_interval)
+    : cache_directory_(cache_directory), extractor_(extractor ? std::move(extractor) : ::get_clickabledata),
+      fingerprint_check_interval_(fingerprint_check_interval)
+{
+}
+
+json ClickabledataCache::get_clickabledata(const std::string &dcs_path,
+                                           const std::string &module_name,
+                                           const std::string &lua_script)
+{
+    const std::string key = dcs_path + "|" + module_name;
+    {
+        // An entry whose fingerprint was checked recently is served without walking the module's folder again.
+        std::unique_lock<std::mutex> lock(mutex_);
+        extraction_finished_.wait(lock, [this, &key]() { return keys_being_extracted_.count(key) == 0; });
+        const auto cached = entries_by_key_.find(key);
+        if (cached != entries_by_key_.end() &&
+            std::chrono::steady_clock::now() - cached->second.fingerprint_check_time < fingerprint_check_interval_) {
+            keys_by_use_.splice(keys_by_use_.begin(), keys_by_use_, cached->second.use_position);
+            return cached->second.clickabledata_and_result;
+        }
+    }
+
+    const uint64_t fingerprint = module_fingerprint(dcs_path, module_name, lua_script);
+    if (fingerprint == 0) {
+        // Nothing to fingerprint, so leave reporting of the missing module to the extraction.
+        return extractor_(dcs_path, module_name, lua_script);
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        extraction_finished_.wait(lock, [this, &key]() { return keys_being_extracted_.count(key) == 0; });
+        const auto cached = entries_by_key_.find(key);
+        if (cached != entries_by_key_.end() && cached->second.fingerprint == fingerprint) {
+            cached->second.fingerprint_check_time = std::chrono::steady_clock::now();
+            keys_by_use_.splice(keys_by_use_.begin(), keys_by_use_, cached->second.use_position);
+            return cached->second.clickabledata_and_result;
+        }
+        keys_being_extracted_.insert(key);
+    }
+    // Other requests for the key wait until this one has stored its result, however it returns.
+    const auto release_key = [this, &key, fingerprint](const json *clickabledata_and_result) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (clickabledata_and_result != nullptr) {
+            store_in_memory(key, fingerprint, *clickabledata_and_result);
+        }
+        keys_being_extracted_.erase(key);
+        extraction_finished_.notify_all();
+    };
+
+    const auto cache_file_contents = [this, &key]() -> json {
+        std::ifstream cache_file(entry_path(key));
+        try {
+            return cache_file ? json::parse(cache_file) : json();
+        } catch (const json::exception &) {
+            return json();
+        }
+    }();
+    const bool cache_file_is_valid = cache_file_contents.is_object() &&
+                                     cache_file_contents.value("format_version", 0) == FORMAT_VERSION &&
+                                     cache_file_contents.value("key", "") == key &&
+                                     cache_file_contents.value("fingerprint", uint64_t{0}) == fingerprint;
+    if (cache_file_is_valid) {
+        const json clickabledata_and_result = {{"clickabledata_items", cache_file_contents["clickabledata_items"]},
+                                               {"result", "success"}};
+        release_key(&clickabledata_and_result);
+        return clickabledata_and_result;
+    }
+
+    json clickabledata_and_result;
+    try {
+        clickabledata_and_result = extractor_(dcs_path, module_name, lua_script);
+    } catch (...) {
+        release_key(nullptr);
+        throw;
+    }
+    if (clickabledata_and_result.value("result", "") != "success") {
+        release_key(nullptr);
+    } else {
+        std::error_code ec;
+        std::filesystem::create_directories(cache_directory_, ec);
+        // Written to a temporary file first, so an interrupted write never leaves a truncated entry.
+        const std::string path = entry_path(key);
+        const std::string temporary_path = path + ".tmp";
+        const json entry_contents = {{"format_version", FORMAT_VERSION},
+                                     {"key", key},
+                                     {"fingerprint", fingerprint},
+                                     {"clickabledata_items", clickabledata_and_result["clickabledata_items"]}};
+        std::ofstream(temporary_path) << entry_contents;
+        std::filesystem::rename(temporary_path, path, ec);
+        release_key(&clickabledata_and_result);
+    }
+    return clickabledata_and_result;
+}
+
+uint64_t ClickabledataCache::module_fingerprint(const std::string &dcs_path,
+                                                const std::string &module_name,
+                                                const std::string &lua_script)
+{
+    const std::filesystem::path cockpit_path =
+        std::filesystem::path(dcs_path) / "Mods" / "aircraft" / module_folder(module_name) / "Cockpit";
+    std::error_code ec;
+    if (!std::filesystem::is_directory(cockpit_path, ec)) {
+        return 0;
+    }
+
+    // Any Lua file in the cockpit folder may be loaded by clickabledata.lua, such as devices.lua and command_defs.lua.
+    std::vector<std::filesystem::path> lua_files;
+    for (auto it = std::filesystem::recursive_directory_iterator(cockpit_path, ec);
+         !ec && it != std::filesystem::recursive_directory_iterator();
+         it.increment(ec)) {
+        if (it->is_regular_file(ec) && it->path().extension() == ".lua") {
+            lua_files.push_back(it->path());
+        }
+    }
+    std::sort(lua_files.begin(), lua_files.end());
+
+    uint64_t hash = FNV_OFFSET_BASIS;
+    hash_bytes(hash, module_name.data(), module_name.size());
+    for (const auto &lua_file : lua_files) {
+        hash_file_attributes(hash, lua_file, lua_file.lexically_relative(cockpit_path).generic_string());
+    }
+    hash_file_attributes(hash, lua_script, "extraction_script");
+    return (hash == 0) ? 1 : hash;
+}
+
+void ClickabledataCache::store_in_memory(const std::string &key,
+                                         const uint64_t fingerprint,
+                                         const json &clickabledata_and_result)
+{
+    const auto stored = entries_by_key_.find(key);
+    if (stored != entries_by_key_.end()) {
+        keys_by_use_.erase(stored->second.use_position);
+        entries_by_key_.erase(stored);
+    } else if (entries_by_key_.size() >= MAX_ENTRIES_IN_MEMORY) {
+        entries_by_key_.erase(keys_by_use_.back());
+        keys_by_use_.pop_back();
+    }
+    keys_by_use_.push_front(key);
+    entries_by_key_[key] = {
+        fingerprint, clickabledata_and_result, std::chrono::steady_clock::now(), keys_by_use_.begin()};
+}
+
+std::string ClickabledataCache::entry_path(const std::string &key) const
+{
+    // File name is a hash of the key, as DCS paths and module names may contain characters invalid in file names.
+    uint64_t hash = FNV_OFFSET_BASIS;
+    hash_bytes(hash, key.data(), key.size());
+    std::ostringstream file_name;
+    file_name << std::hex << hash << ".json";
+    return (std::filesystem::path(cache_directory_) / file_name.str()).string();
+}
@@ -0,0 +1,89 @@
+// Copyright 2026 Charles Tytler
+
+#pragma once
+
+#include "nlohmann/json.hpp"
+using json = nlohmann::json;
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+/**
+ * @brief Caches the results of clickabledata extraction on disk, so each module is only extracted through Lua once.
+ *
+ *   Entries are keyed by DCS path and module name, and hold a fingerprint of the size and modification time of every
+ *   Lua file in the module's cockpit folder and of the extraction script. An entry is only served while its
+ *   fingerprint matches the files on disk, so updating the module through DCS invalidates it. Only successful
+ *   extractions are cached. Up to MAX_ENTRIES_IN_MEMORY entries read from or written to disk are also kept in memory,
+ *   the least recently used of which is dropped when another is added to a full cache. Fingerprinting walks the
+ *   module's cockpit folder, so an entry in memory is served without checking its fingerprint again until the
+ *   fingerprint check interval has passed.
+ *
+ *   The cache may be used from multiple threads. Concurrent requests for the same module wait for a single extraction.
+ */
+class ClickabledataCache
+{
+  public:
+    using Extractor = std::function<json(
+        const std::string &dcs_path, const std::string &module_name, const std::string &lua_script)>;
+
+    static constexpr int FORMAT_VERSION = 3; // Version of the cache file contents, entries of other versions are stale.
+    static constexpr size_t MAX_ENTRIES_IN_MEMORY = 8; // Entries beyond this are only kept on disk.
+    static constexpr std::chrono::milliseconds DEFAULT_FINGERPRINT_CHECK_INTERVAL{60000};
+
+    /**
+     * @brief Construct a cache which stores its entries in the directory, created when the first entry is stored.
+     * @param extractor Function to extract clickabledata on a cache miss, defaults to running the Lua extraction.
+     * @param fingerprint_check_interval Time for which an entry in memory is served without checking its fingerprint.
+     */
+    explicit ClickabledataCache(
+        const std::string &cache_directory,
+        Extractor extractor = nullptr,
+        const std::chrono::milliseconds fingerprint_check_interval = DEFAULT_FINGERPRINT_CHECK_INTERVAL);
+
+    /**
+     * @brief Get clickabledata of a module, extracting and caching it if no valid cache entry exists.
+     * @return Json of the same form as returned by get_clickabledata().
+     */
+    json get_clickabledata(const std::string &dcs_path, const std::string &module_name, const std::string &lua_script);
+
+    /**
+     * @brief Computes the fingerprint of the Lua files used to extract a module's clickabledata.
+     * @return Fingerprint, or 0 if the module's cockpit folder does not exist.
+     */
+    static uint64_t module_fingerprint(const std::string &dcs_path,
+                                       const std::string &module_name,
+                                       const std::string &lua_script);
+
+  private:
+    struct Entry {
+        uint64_t fingerprint;
+        json clickabledata_and_result;
+        std::chrono::steady_clock::time_point fingerprint_check_time;
+        std::list<std::string>::iterator use_position; // Position of the key in keys_by_use_.
+    };
+
+    std::string entry_path(const std::string &key) const;
+
+    /**
+     * @brief Stores an entry in memory as the most recently used, dropping the least recently used entry if full.
+     *        Must be called with mutex_ held.
+     */
+    void store_in_memory(const std::string &key, const uint64_t fingerprint, const json &clickabledata_and_result);
+
+    std::string cache_directory_;
+    Extractor extractor_;
+    std::chrono::milliseconds fingerprint_check_interval_;
+    std::mutex mutex_;
+    std::condition_variable extraction_finished_;
+    std::unordered_map<std::string, Entry> entries_by_key_;  // Entries in memory, by DCS path and module name.
+    std::list<std::string> keys_by_use_;                    // Keys of entries in memory, most recently used first.
+    std::unordered_set<std::string> keys_being_extracted_;  // Keys with a cache file read or extraction in progress.
+};
@@ -0,0 +1,145 @@
+// Copyright 2026 Charles Tytler
+
+#include "ClickabledataIndexer.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#endif
+
+#include <algorithm>
+
+ClickabledataIndexer::ClickabledataIndexer(ClickabledataCache &cache,
+                                           const std::string &lua_script,
+                                           const size_t max_workers)
+    : cache_(cache), lua_script_(lua_script), max_workers_(std::max<size_t>(max_workers, 1))
+{
+}
+
+ClickabledataIndexer::~ClickabledataIndexer()
+{
+    cancel();
+    for (auto &workers : cancelled_) {
+        for (auto &thread : workers.threads) {
+            thread.join();
+        }
+    }
+}
+
+void ClickabledataIndexer::start(std::vector<Job> jobs, ProgressCallback on_progress)
+{
+    cancel();
+    join_finished_workers();
+
+    auto run = std::make_shared<Run>();
+    run->jobs = std::move(jobs);
+    if (on_progress) {
+        run->progress_callbacks.push_back(std::move(on_progress));
+    }
+    run->num_jobs_remaining = run->jobs.size();
+    const size_t num_workers = std::min(max_workers_, run->jobs.size());
+    run->num_workers_running = num_workers;
+
+    current_.run = run;
+    for (size_t i = 0; i < num_workers; i++) {
+        current_.threads.emplace_back([this, run]() { run_worker(*run); });
+    }
+}
+
+void ClickabledataIndexer::cancel()
+{
+    if (!current_.run) {
+        return;
+    }
+    current_.run->is_cancelled = true;
+    cancelled_.push_back(std::move(current_));
+    current_ = Workers();
+}
+
+bool ClickabledataIndexer::add_progress_callback(ProgressCallback on_progress)
+{
+    if (!current_.run) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(current_.run->progress_mutex);
+    if (current_.run->last_progress) {
+        on_progress(current_.run->last_progress.value());
+    }
+    current_.run->progress_callbacks.push_back(std::move(on_progress));
+    return true;
+}
+
+bool ClickabledataIndexer::is_running() const
+{
+    return current_.run && current_.run->num_jobs_remaining > 0;
+}
+
+void ClickabledataIndexer::join_finished_workers()
+{
+    const auto finished = std::remove_if(cancelled_.begin(), cancelled_.end(), [](Workers &workers) {
+        if (workers.run->num_workers_running > 0) {
+            return false;
+        }
+        for (auto &thread : workers.threads) {
+            thread.join();
+        }
+        return true;
+    });
+    cancelled_.erase(finished, cancelled_.end());
+}
+
+size_t ClickabledataIndexer::default_max_workers()
+{
+    return std::clamp<size_t>(std::thread::hardware_concurrency() / 4, 1, 4);
+}
+
+std::vector<ClickabledataIndexer::Job>
+ClickabledataIndexer::jobs_for_installed_modules(const std::string &dcs_path,
+                                                 const std::vector<std::string> &installed_modules)
+{
+    std::vector<Job> jobs;
+    for (const auto &module : installed_modules) {
+        // Matches the special cases of modifyInstalledModulesList() in the ID lookup window.
+        if (module == "C-101") {
+            jobs.push_back({dcs_path, "C-101CC"});
+            jobs.push_back({dcs_path, "C-101EB"});
+        } else {
+            jobs.push_back({dcs_path, module});
+            if (module == "L-39C") {
+                jobs.push_back({dcs_path, "L-39ZA"});
+            }
+        }
+    }
+    return jobs;
+}
+
+void ClickabledataIndexer::run_worker(Run &run)
+{
+#ifdef _WIN32
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+#endif
+    while (!run.is_cancelled) {
+        const size_t job_index = run.next_job++;
+        if (job_index >= run.jobs.size()) {
+            break;
+        }
+        const Job &job = run.jobs[job_index];
+        bool success = false;
+        try {
+            const json clickabledata_and_result = cache_.get_clickabledata(job.dcs_path, job.module_name, lua_script_);
+            success = (clickabledata_and_result.value("result", "") == "success");
+        } catch (const std::exception &) {
+            // A module which fails to extract is reported through progress, and does not stop the others.
+        }
+        {
+            std::lock_guard<std::mutex> lock(run.progress_mutex);
+            run.last_progress = Progress{++run.num_completed, run.jobs.size(), job.module_name, success};
+            if (!run.is_cancelled) {
+                for (const auto &on_progress : run.progress_callbacks) {
+                    on_progress(run.last_progress.value());
+                }
+            }
+        }
+        run.num_jobs_remaining--;
+    }
+    run.num_workers_running--;
+}
@@ -0,0 +1,126 @@
+// Copyright 2026 Charles Tytler
+
+#pragma once
+
+#include "Utilities/ClickabledataCache.h"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Extracts the clickabledata of many modules into a ClickabledataCache in the background, so that later ID
+ * lookups are served from the cache.
+ *
+ *   Modules are extracted by a bounded number of worker threads, each using a Lua state from the shared state pool.
+ *   On Windows the workers run below normal priority, so indexing does not take CPU time from a running simulator.
+ */
+class ClickabledataIndexer
+{
+  public:
+    struct Job {
+        std::string dcs_path;
+        std::string module_name;
+    };
+
+    struct Progress {
+        size_t num_completed;     // Number of jobs finished, including this one. Increases with each report.
+        size_t num_jobs;          // Total number of jobs being indexed.
+        std::string module_name;  // Module of the job just finished.
+        bool success;             // True if the module's clickabledata was extracted or already cached.
+    };
+    using ProgressCallback = std::function<void(const Progress &)>;
+
+    /**
+     * @param cache       Cache to extract into, which must outlive the indexer.
+     * @param lua_script  Lua extraction script, as passed to get_clickabledata().
+     * @param max_workers Maximum number of modules extracted at once.
+     */
+    ClickabledataIndexer(ClickabledataCache &cache,
+                         const std::string &lua_script,
+                         const size_t max_workers = default_max_workers());
+
+    /**
+     * @brief Cancels any indexing in progress, waiting for modules being extracted to finish.
+     */
+    ~ClickabledataIndexer();
+
+    ClickabledataIndexer(const ClickabledataIndexer &) = delete;
+    ClickabledataIndexer &operator=(const ClickabledataIndexer &) = delete;
+
+    /**
+     * @brief Starts indexing the jobs in the background, replacing any indexing in progress.
+     * @param on_progress Called from a worker thread after each job, one call at a time.
+     */
+    void start(std::vector<Job> jobs, ProgressCallback on_progress = nullptr);
+
+    /**
+     * @brief Adds a callback to the progress of the most recently started indexing, first calling it with the latest
+     *        progress reported, so a late requester also sees indexing which is already underway or complete.
+     * @return False if indexing has never been started or has been cancelled.
+     */
+    bool add_progress_callback(ProgressCallback on_progress);
+
+    /**
+     * @brief Stops indexing once the modules currently being extracted are finished, without waiting for them.
+     *
+     *   No progress is reported for the cancelled jobs.
+     */
+    void cancel();
+
+    /**
+     * @brief Returns true while jobs remain to be indexed.
+     */
+    bool is_running() const;
+
+    /**
+     * @brief Default worker count: a quarter of the hardware threads, between 1 and 4.
+     */
+    static size_t default_max_workers();
+
+    /**
+     * @brief Get a job for each module listed by get_installed_modules(), under the names used by the ID lookup.
+     *
+     *   Module folders holding multiple versions are expanded to each version, as listed by the Property Inspector.
+     */
+    static std::vector<Job> jobs_for_installed_modules(const std::string &dcs_path,
+                                                       const std::vector<std::string> &installed_modules);
+
+  private:
+    // State of one call to start(), shared with its workers so a cancelled run may finish after a new one starts.
+    struct Run {
+        std::vector<Job> jobs;
+        std::mutex progress_mutex; // Held while reporting progress, so reports are in order of num_completed.
+        std::vector<ProgressCallback> progress_callbacks;
+        std::optional<Progress> last_progress;
+        size_t num_completed = 0;
+        std::atomic<size_t> next_job{0};
+        std::atomic<size_t> num_jobs_remaining{0};
+        std::atomic<size_t> num_workers_running{0};
+        std::atomic<bool> is_cancelled{false};
+    };
+
+    struct Workers {
+        std::shared_ptr<Run> run;
+        std::vector<std::thread> threads;
+    };
+
+    void run_worker(Run &run);
+
+    /**
+     * @brief Joins the workers of cancelled runs which have finished.
+     */
+    void join_finished_workers();
+
+    ClickabledataCache &cache_;
+    std::string lua_script_;
+    size_t max_workers_;
+
+    Workers current_;
+    std::vector<Workers> cancelled_; // Workers of cancelled runs, joined once finished or on destruction.
+};
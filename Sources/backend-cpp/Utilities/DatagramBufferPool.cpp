@@ -0,0 +1,47 @@
+// Copyright 2026 Charles Tytler
+
+#include "DatagramBufferPool.h"
+
+DatagramBufferPool::Buffer::Buffer(DatagramBufferPool *pool, std::unique_ptr<char[]> storage)
+    : pool_(pool), storage_(std::move(storage))
+{
+}
+
+DatagramBufferPool::Buffer::~Buffer() { release(); }
+
+DatagramBufferPool::Buffer::Buffer(Buffer &&other) noexcept
+    : pool_(other.pool_), storage_(std::move(other.storage_)), size_(other.size_)
+{
+    other.size_ = 0;
+}
+
+DatagramBufferPool::Buffer &DatagramBufferPool::Buffer::operator=(Buffer &&other) noexcept
+{
+    if (this != &other) {
+        release();
+        pool_ = other.pool_;
+        storage_ = std::move(other.storage_);
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+    return *this;
+}
+
+void DatagramBufferPool::Buffer::release()
+{
+    if (storage_ && pool_ != nullptr) {
+        pool_->free_buffers_.push_back(std::move(storage_));
+    }
+    size_ = 0;
+}
+
+DatagramBufferPool::Buffer DatagramBufferPool::acquire()
+{
+    if (free_buffers_.empty()) {
+        num_buffers_allocated_++;
+        return Buffer(this, std::make_unique<char[]>(MAX_DATAGRAM_SIZE));
+    }
+    auto storage = std::move(free_buffers_.back());
+    free_buffers_.pop_back();
+    return Buffer(this, std::move(storage));
+}
@@ -0,0 +1,71 @@
+// Copyright 2026 Charles Tytler
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Provides reusable receive buffers large enough to hold any UDP datagram.
+ *
+ *   Buffers are returned to the pool when their handle goes out of scope, so steady-state receiving does not allocate.
+ *   The pool grows only when more buffers are held at once than have been released back to it.
+ *   A pool is not thread-safe and is intended to be owned by a single socket.
+ */
+class DatagramBufferPool
+{
+  public:
+    static constexpr int MAX_DATAGRAM_SIZE = 65536; // Largest possible UDP datagram payload, rounded up to 64 KiB.
+
+    /**
+     * @brief Handle to a pooled buffer, which returns the buffer to its pool on destruction.
+     */
+    class Buffer
+    {
+      public:
+        Buffer(DatagramBufferPool *pool, std::unique_ptr<char[]> storage);
+        ~Buffer();
+
+        Buffer(Buffer &&other) noexcept;
+        Buffer &operator=(Buffer &&other) noexcept;
+        Buffer(const Buffer &) = delete;
+        Buffer &operator=(const Buffer &) = delete;
+
+        char *data() { return storage_.get(); }
+        const char *data() const { return storage_.get(); }
+        int capacity() const { return MAX_DATAGRAM_SIZE; }
+
+        /**
+         * @brief Number of bytes of valid data held in the buffer.
+         */
+        int size() const { return size_; }
+        void set_size(const int size) { size_ = size; }
+
+      private:
+        void release();
+
+        DatagramBufferPool *pool_;
+        std::unique_ptr<char[]> storage_;
+        int size_ = 0;
+    };
+
+    DatagramBufferPool() = default;
+
+    // Outstanding buffers refer back to the pool, so it may not be moved or copied.
+    DatagramBufferPool(const DatagramBufferPool &) = delete;
+    DatagramBufferPool &operator=(const DatagramBufferPool &) = delete;
+
+    /**
+     * @brief Get a buffer from the pool, allocating a new one only if no released buffer is available.
+     */
+    Buffer acquire();
+
+    /**
+     * @brief Total number of buffers allocated by the pool over its lifetime.
+     */
+    size_t num_buffers_allocated() const { return num_buffers_allocated_; }
+
+  private:
+    std::vector<std::unique_ptr<char[]>> free_buffers_; // Buffers released back to the pool, ready for reuse.
+    size_t num_buffers_allocated_ = 0;
+};
@@ -0,0 +1,268 @@
+// Copyright 2026 Charles Tytler
+
+#include "DatagramCapture.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+using namespace DatagramCapture;
+
+namespace
+{
+void append_varint(std::vector<char> &buffer, uint64_t value)
+{
+    while (value >= 0x80) {
+        buffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<char>(value));
+}
+
+void append_fixed(std::vector<char> &buffer, uint64_t value, const size_t num_bytes)
+{
+    for (size_t i = 0; i < num_bytes; i++) {
+        buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+// Reads a varint at the offset, advancing the offset. Returns false if the data ends before the varint does.
+bool read_varint(const char *data, const size_t end, size_t &offset, uint64_t &value)
+{
+    value = 0;
+    for (unsigned int shift = 0; shift < 64; shift += 7) {
+        if (offset >= end) {
+            return false;
+        }
+        const auto byte = static_cast<uint8_t>(data[offset++]);
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint64_t read_fixed(const char *data, const size_t num_bytes)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < num_bytes; i++) {
+        value |= static_cast<uint64_t>(static_cast<uint8_t>(data[i])) << (8 * i);
+    }
+    return value;
+}
+} // namespace
+
+DatagramCaptureWriter::DatagramCaptureWriter(const std::string &path, const int64_t start_time_unix_ns)
+    : file_(path, std::ios::binary | std::ios::trunc)
+{
+    if (!file_.is_open()) {
+        throw std::runtime_error("Unable to open capture file for writing: " + path);
+    }
+    std::vector<char> header(FILE_MAGIC, FILE_MAGIC + sizeof(FILE_MAGIC));
+    append_fixed(header, FORMAT_VERSION, 4);
+    append_fixed(header, INDEX_INTERVAL, 4);
+    append_fixed(header, static_cast<uint64_t>(start_time_unix_ns), 8);
+    file_.write(header.data(), header.size());
+    offset_ = header.size();
+    throw_if_write_failed();
+}
+
+DatagramCaptureWriter::~DatagramCaptureWriter()
+{
+    try {
+        close();
+    } catch (const std::runtime_error &) {
+        // Errors are only reported by an explicit close.
+    }
+}
+
+void DatagramCaptureWriter::write(const uint8_t channel, const char *data, const size_t size, uint64_t timestamp_ns)
+{
+    if (!file_.is_open()) {
+        return;
+    }
+    timestamp_ns = std::max(timestamp_ns, last_timestamp_ns_);
+    if (num_records_ % INDEX_INTERVAL == 0) {
+        index_.push_back({num_records_, timestamp_ns, offset_});
+    }
+
+    record_header_.clear();
+    append_varint(record_header_, timestamp_ns - last_timestamp_ns_);
+    record_header_.push_back(static_cast<char>(channel));
+    append_varint(record_header_, size);
+    file_.write(record_header_.data(), record_header_.size());
+    file_.write(data, size);
+    throw_if_write_failed();
+
+    offset_ += record_header_.size() + size;
+    last_timestamp_ns_ = timestamp_ns;
+    num_records_++;
+}
+
+void DatagramCaptureWriter::close()
+{
+    if (!file_.is_open()) {
+        return;
+    }
+    std::vector<char> index_and_trailer;
+    for (const auto &entry : index_) {
+        append_fixed(index_and_trailer, entry.record_number, 8);
+        append_fixed(index_and_trailer, entry.timestamp_ns, 8);
+        append_fixed(index_and_trailer, entry.offset, 8);
+    }
+    append_fixed(index_and_trailer, offset_, 8);
+    append_fixed(index_and_trailer, index_.size(), 8);
+    append_fixed(index_and_trailer, num_records_, 8);
+    append_fixed(index_and_trailer, last_timestamp_ns_, 8);
+    index_and_trailer.insert(index_and_trailer.end(), INDEX_MAGIC, INDEX_MAGIC + sizeof(INDEX_MAGIC));
+    file_.write(index_and_trailer.data(), index_and_trailer.size());
+    file_.close();
+    if (file_.fail()) {
+        throw std::runtime_error("Unable to write capture file index");
+    }
+}
+
+void DatagramCaptureWriter::throw_if_write_failed()
+{
+    if (file_.fail()) {
+        // The records written so far stay readable, as a capture that was not closed cleanly.
+        file_.close();
+        throw std::runtime_error("Unable to write to capture file, e.g. as the disk is full");
+    }
+}
+
+DatagramCaptureReader::DatagramCaptureReader(const char *data, const size_t size)
+    : data_(data), records_end_(size), offset_(HEADER_SIZE)
+{
+    if (size < HEADER_SIZE || memcmp(data, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0) {
+        throw std::runtime_error("Data is not a datagram capture");
+    }
+    if (read_fixed(data + 8, 4) != FORMAT_VERSION) {
+        throw std::runtime_error("Unsupported datagram capture version");
+    }
+    index_interval_ = static_cast<uint32_t>(read_fixed(data + 12, 4));
+    start_time_unix_ns_ = static_cast<int64_t>(read_fixed(data + 16, 8));
+    if (index_interval_ == 0) {
+        throw std::runtime_error("Invalid datagram capture index interval");
+    }
+
+    if (!load_stored_index()) {
+        rebuild_index();
+    }
+}
+
+std::optional<DatagramCaptureReader::Record> DatagramCaptureReader::next()
+{
+    Record record;
+    const auto next_offset = decode_record(offset_, previous_timestamp_ns_, record);
+    if (!next_offset) {
+        return std::nullopt;
+    }
+    offset_ = next_offset.value();
+    previous_timestamp_ns_ = record.timestamp_ns;
+    return record;
+}
+
+void DatagramCaptureReader::seek(const uint64_t timestamp_ns)
+{
+    // Start from the last indexed record at or before the requested time, then step forward to it.
+    const auto after = std::upper_bound(
+        index_.begin(), index_.end(), timestamp_ns, [](const uint64_t t, const IndexEntry &entry) {
+            return t < entry.timestamp_ns;
+        });
+    if (after == index_.begin()) {
+        rewind();
+        return;
+    }
+    const IndexEntry &entry = *(after - 1);
+    Record record;
+    // Recover the timestamp of the preceding record from the delta of the indexed record.
+    (void)decode_record(entry.offset, 0, record);
+    offset_ = entry.offset;
+    previous_timestamp_ns_ = entry.timestamp_ns - record.timestamp_ns;
+
+    while (decode_record(offset_, previous_timestamp_ns_, record)) {
+        if (record.timestamp_ns >= timestamp_ns) {
+            return;
+        }
+        (void)next();
+    }
+}
+
+void DatagramCaptureReader::rewind()
+{
+    offset_ = HEADER_SIZE;
+    previous_timestamp_ns_ = 0;
+}
+
+std::optional<size_t>
+DatagramCaptureReader::decode_record(size_t offset, const uint64_t previous_timestamp_ns, Record &record) const
+{
+    uint64_t delta_ns = 0;
+    uint64_t size = 0;
+    if (!read_varint(data_, records_end_, offset, delta_ns) || offset >= records_end_) {
+        return std::nullopt;
+    }
+    record.channel = static_cast<uint8_t>(data_[offset++]);
+    if (!read_varint(data_, records_end_, offset, size) || size > records_end_ - offset) {
+        return std::nullopt;
+    }
+    record.timestamp_ns = previous_timestamp_ns + delta_ns;
+    record.data = data_ + offset;
+    record.size = static_cast<size_t>(size);
+    return offset + record.size;
+}
+
+bool DatagramCaptureReader::load_stored_index()
+{
+    const size_t size = records_end_;
+    if (size < HEADER_SIZE + TRAILER_SIZE ||
+        memcmp(data_ + size - sizeof(INDEX_MAGIC), INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0) {
+        return false;
+    }
+    const char *trailer = data_ + size - TRAILER_SIZE;
+    const uint64_t index_offset = read_fixed(trailer, 8);
+    const uint64_t num_index_entries = read_fixed(trailer + 8, 8);
+    // Bounded first, so a corrupt entry count cannot overflow the index size into a valid one.
+    if (num_index_entries > (size - TRAILER_SIZE) / 24) {
+        return false;
+    }
+    const uint64_t index_size = num_index_entries * 24;
+    if (index_offset < HEADER_SIZE || index_offset > size - TRAILER_SIZE ||
+        index_size != size - TRAILER_SIZE - index_offset) {
+        return false;
+    }
+
+    index_.clear();
+    index_.reserve(num_index_entries);
+    for (uint64_t i = 0; i < num_index_entries; i++) {
+        const char *entry = data_ + index_offset + i * 24;
+        index_.push_back({read_fixed(entry, 8), read_fixed(entry + 8, 8), read_fixed(entry + 16, 8)});
+    }
+    num_records_ = read_fixed(trailer + 16, 8);
+    last_timestamp_ns_ = read_fixed(trailer + 24, 8);
+    records_end_ = static_cast<size_t>(index_offset);
+    has_stored_index_ = true;
+    return true;
+}
+
+void DatagramCaptureReader::rebuild_index()
+{
+    index_.clear();
+    num_records_ = 0;
+    last_timestamp_ns_ = 0;
+    rewind();
+    size_t record_offset = offset_;
+    while (const auto record = next()) {
+        if (num_records_ % index_interval_ == 0) {
+            index_.push_back({num_records_, record->timestamp_ns, record_offset});
+        }
+        last_timestamp_ns_ = record->timestamp_ns;
+        num_records_++;
+        record_offset = offset_;
+    }
+    // Ignore any partially written record at the end of the capture.
+    records_end_ = record_offset;
+    rewind();
+}
@@ -0,0 +1,164 @@
+// Copyright 2026 Charles Tytler
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * Binary capture format for recorded simulator datagrams.
+ *
+ *   A capture begins with a fixed header, followed by one record per datagram:
+ *     [varint timestamp delta ns][uint8 channel][varint size][size bytes of datagram]
+ *   Timestamps are nanoseconds since the start of the capture, stored as the delta from the previous record so that
+ *   typical frame intervals take 3-4 bytes. Channels identify the stream each datagram was received on.
+ *
+ *   After the last record, an index holds the record number, timestamp and file offset of every INDEX_INTERVAL-th
+ *   record, followed by a fixed trailer locating the index. Captures which were not closed cleanly (and so have no
+ *   trailer) remain readable, with their index rebuilt by a scan of the records.
+ *
+ *   All fixed-width fields are little-endian.
+ */
+namespace DatagramCapture
+{
+constexpr char FILE_MAGIC[8] = {'S', 'D', 'C', 'S', 'C', 'A', 'P', '\0'};
+constexpr char INDEX_MAGIC[8] = {'S', 'D', 'C', 'S', 'I', 'D', 'X', '\0'};
+constexpr uint32_t FORMAT_VERSION = 1;
+constexpr size_t HEADER_SIZE = 24;   // Magic, version, index interval and start time.
+constexpr size_t TRAILER_SIZE = 40;  // Index offset, number of index entries, record count, last timestamp and magic.
+constexpr uint32_t INDEX_INTERVAL = 256; // Number of records between index entries.
+
+struct IndexEntry {
+    uint64_t record_number; // Number of the indexed record, counted from 0.
+    uint64_t timestamp_ns;  // Timestamp of the indexed record.
+    uint64_t offset;        // Offset of the indexed record from the start of the capture.
+};
+} // namespace DatagramCapture
+
+/**
+ * @brief Records datagrams to a capture file.
+ */
+class DatagramCaptureWriter
+{
+  public:
+    /**
+     * @brief Creates a capture file, overwriting any existing file.
+     * @param path Path of the capture file.
+     * @param start_time_unix_ns Wall-clock time of the start of the capture, stored for reference only.
+     * @throws std::runtime_error if the file cannot be opened or written.
+     */
+    DatagramCaptureWriter(const std::string &path, const int64_t start_time_unix_ns);
+
+    /**
+     * @brief Closes the capture, writing its index. Errors writing the index are ignored; use close() to detect them.
+     */
+    ~DatagramCaptureWriter();
+
+    DatagramCaptureWriter(const DatagramCaptureWriter &) = delete;
+    DatagramCaptureWriter &operator=(const DatagramCaptureWriter &) = delete;
+
+    /**
+     * @brief Appends a datagram to the capture.
+     * @param channel Stream the datagram was received on.
+     * @param data Datagram contents.
+     * @param size Number of bytes in the datagram.
+     * @param timestamp_ns Nanoseconds since the start of the capture, clamped to be no earlier than the previous
+     *                     record.
+     * @throws std::runtime_error if the record cannot be written (e.g. the disk is full), after which the file is
+     *         closed without an index and no further records are written.
+     */
+    void write(const uint8_t channel, const char *data, const size_t size, uint64_t timestamp_ns);
+
+    /**
+     * @brief Writes the index and trailer and closes the file. No further records may be written.
+     * @throws std::runtime_error if the index cannot be written.
+     */
+    void close();
+
+    uint64_t num_records() const { return num_records_; }
+
+  private:
+    /**
+     * @brief Closes the file and throws if any write to it has failed.
+     */
+    void throw_if_write_failed();
+
+    std::ofstream file_;
+    uint64_t offset_ = 0;
+    uint64_t num_records_ = 0;
+    uint64_t last_timestamp_ns_ = 0;
+    std::vector<DatagramCapture::IndexEntry> index_;
+    std::vector<char> record_header_; // Reused buffer for encoding record headers.
+};
+
+/**
+ * @brief Reads datagrams from a capture held in memory, such as a memory-mapped capture file.
+ *
+ *   The reader does not copy the capture; the memory must remain valid for the lifetime of the reader.
+ */
+class DatagramCaptureReader
+{
+  public:
+    struct Record {
+        uint64_t timestamp_ns; // Nanoseconds since the start of the capture.
+        uint8_t channel;       // Stream the datagram was received on.
+        const char *data;      // Datagram contents, pointing into the capture.
+        size_t size;           // Number of bytes in the datagram.
+    };
+
+    /**
+     * @brief Validates the capture header and loads the index.
+     * @throws std::runtime_error if the data does not start with a valid capture header.
+     */
+    DatagramCaptureReader(const char *data, const size_t size);
+
+    /**
+     * @brief Get the next record, or nullopt at the end of the capture.
+     */
+    std::optional<Record> next();
+
+    /**
+     * @brief Positions the reader at the first record with a timestamp at or after the requested time.
+     */
+    void seek(const uint64_t timestamp_ns);
+
+    /**
+     * @brief Positions the reader at the first record.
+     */
+    void rewind();
+
+    int64_t start_time_unix_ns() const { return start_time_unix_ns_; }
+    uint64_t num_records() const { return num_records_; }
+    uint64_t duration_ns() const { return last_timestamp_ns_; }
+
+    /**
+     * @brief Returns true if the capture was closed cleanly and its stored index was used.
+     */
+    bool has_stored_index() const { return has_stored_index_; }
+
+  private:
+    /**
+     * @brief Decodes the record at the offset, returning the offset of the following record, or nullopt if the record
+     * is incomplete.
+     */
+    std::optional<size_t> decode_record(size_t offset, const uint64_t previous_timestamp_ns, Record &record) const;
+
+    bool load_stored_index();
+    void rebuild_index();
+
+    const char *data_;
+    size_t records_end_; // Offset of the end of the last complete record.
+    int64_t start_time_unix_ns_ = 0;
+    uint32_t index_interval_ = DatagramCapture::INDEX_INTERVAL;
+    uint64_t num_records_ = 0;
+    uint64_t last_timestamp_ns_ = 0;
+    bool has_stored_index_ = false;
+    std::vector<DatagramCapture::IndexEntry> index_;
+
+    // Read position.
+    size_t offset_;
+    uint64_t previous_timestamp_ns_ = 0;
+};
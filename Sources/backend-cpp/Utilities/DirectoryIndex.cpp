@@ -0,0 +1,503 @@
+// Copyright 2026 Charles Tytler
+
+#include "DirectoryIndex.h"
+
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <Windows.h>
+#endif
+
+#include <algorithm>
+#include <condition_variable>
+
+namespace
+{
+// Longest time the background thread waits for change notifications before checking for periodic rescans.
+constexpr std::chrono::milliseconds POLL_INTERVAL{250};
+
+/**
+ * @brief Removes all paths within the directory from the set.
+ */
+void erase_within(std::set<std::string> &paths, const std::string &directory)
+{
+    const std::string prefix = directory + static_cast<char>(std::filesystem::path::preferred_separator);
+    auto it = paths.lower_bound(prefix);
+    while (it != paths.end() && it->compare(0, prefix.size(), prefix) == 0) {
+        it = paths.erase(it);
+    }
+}
+} // namespace
+
+#if defined(__linux__)
+/**
+ * @brief Watches every indexed directory through inotify, reporting each added or removed entry.
+ *
+ *   inotify does not watch subdirectories, so each subdirectory of a recursively indexed directory is watched too.
+ */
+class DirectoryIndex::Watcher
+{
+  public:
+    Watcher()
+        : inotify_fd_(inotify_init1(IN_NONBLOCK | IN_CLOEXEC)), wake_fd_(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+    {
+    }
+
+    ~Watcher()
+    {
+        if (inotify_fd_ >= 0) {
+            close(inotify_fd_);
+        }
+        if (wake_fd_ >= 0) {
+            close(wake_fd_);
+        }
+    }
+
+    void watch(const std::string &key, const std::filesystem::path &directory, const bool is_root, const bool)
+    {
+        if (inotify_fd_ < 0) {
+            return;
+        }
+        // A directory has a single watch shared by all indexes containing it, so masks are added to, not replaced.
+        const uint32_t mask = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF |
+                              IN_ONLYDIR | IN_MASK_ADD;
+        const int watch_descriptor = inotify_add_watch(inotify_fd_, directory.c_str(), mask);
+        if (watch_descriptor < 0) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto &targets = targets_by_watch_[watch_descriptor];
+        for (auto &target : targets) {
+            if (target.key == key) {
+                // A directory moved within the index keeps its watch, which now reports the new path.
+                target.directory = directory;
+                target.is_root = target.is_root || is_root;
+                return;
+            }
+        }
+        targets.push_back({key, directory, is_root});
+    }
+
+    std::vector<Change> wait_for_changes(const std::chrono::milliseconds timeout)
+    {
+        pollfd poll_fds[2] = {{inotify_fd_, POLLIN, 0}, {wake_fd_, POLLIN, 0}};
+        std::vector<Change> changes;
+        if (poll(poll_fds, 2, static_cast<int>(timeout.count())) <= 0) {
+            return changes;
+        }
+        if (poll_fds[1].revents & POLLIN) {
+            uint64_t wake_count = 0;
+            (void)read(wake_fd_, &wake_count, sizeof(wake_count));
+        }
+        if (poll_fds[0].revents & POLLIN) {
+            alignas(inotify_event) char buffer[16384];
+            ssize_t length = 0;
+            while ((length = read(inotify_fd_, buffer, sizeof(buffer))) > 0) {
+                for (const char *position = buffer; position < buffer + length;) {
+                    const auto *event = reinterpret_cast<const inotify_event *>(position);
+                    append_changes(*event, changes);
+                    position += sizeof(inotify_event) + event->len;
+                }
+            }
+        }
+        return changes;
+    }
+
+    void wake()
+    {
+        const uint64_t wake_count = 1;
+        (void)write(wake_fd_, &wake_count, sizeof(wake_count));
+    }
+
+  private:
+    struct Target {
+        std::string key;                 // Key of the indexed directory.
+        std::filesystem::path directory; // Path of the watched directory within the indexed directory.
+        bool is_root;                    // True if the watched directory is the indexed directory itself.
+    };
+
+    void append_changes(const inotify_event &event, std::vector<Change> &changes)
+    {
+        if (event.mask & IN_Q_OVERFLOW) {
+            changes.push_back({Change::Type::RESCAN, "", {}});
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto targets = targets_by_watch_.find(event.wd);
+        if (targets == targets_by_watch_.end()) {
+            return;
+        }
+        if (event.mask & IN_IGNORED) {
+            targets_by_watch_.erase(targets);
+            return;
+        }
+        for (const auto &target : targets->second) {
+            if (event.mask & (IN_DELETE_SELF | IN_MOVE_SELF)) {
+                // Removal of a subdirectory is also reported by its parent, so only the indexed directory is handled.
+                if (target.is_root) {
+                    changes.push_back({Change::Type::RESCAN, target.key, target.directory});
+                }
+                continue;
+            }
+            if (event.len == 0) {
+                continue;
+            }
+            const bool is_directory = (event.mask & IN_ISDIR) != 0;
+            if (event.mask & (IN_CREATE | IN_MOVED_TO)) {
+                changes.push_back({Change::Type::ADDED, target.key, target.directory / event.name, is_directory});
+            } else if (event.mask & (IN_DELETE | IN_MOVED_FROM)) {
+                changes.push_back({Change::Type::REMOVED, target.key, target.directory / event.name, is_directory});
+            }
+        }
+    }
+
+    int inotify_fd_;
+    int wake_fd_; // Signalled to interrupt wait_for_changes().
+    std::mutex mutex_;
+    std::unordered_map<int, std::vector<Target>> targets_by_watch_;
+};
+#elif defined(_WIN32)
+/**
+ * @brief Watches each indexed directory through a change notification, requesting a rescan whenever it fires.
+ */
+class DirectoryIndex::Watcher
+{
+  public:
+    Watcher() : wake_event_(CreateEventW(nullptr, FALSE, FALSE, nullptr)) {}
+
+    ~Watcher()
+    {
+        for (const auto &watch : watches_) {
+            FindCloseChangeNotification(watch.handle);
+        }
+        CloseHandle(wake_event_);
+    }
+
+    void watch(const std::string &key, const std::filesystem::path &directory, const bool is_root, const bool recursive)
+    {
+        // A notification on the indexed directory also covers its subdirectories.
+        if (!is_root) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto &watch : watches_) {
+            if (watch.key == key) {
+                return;
+            }
+        }
+        // Beyond the number of handles that can be waited on, directories are only updated by periodic rescans.
+        if (watches_.size() + 1 >= MAXIMUM_WAIT_OBJECTS) {
+            return;
+        }
+        const HANDLE handle = FindFirstChangeNotificationW(directory.c_str(),
+                                                           recursive ? TRUE : FALSE,
+                                                           FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME);
+        if (handle != INVALID_HANDLE_VALUE) {
+            watches_.push_back({key, handle});
+        }
+    }
+
+    std::vector<Change> wait_for_changes(const std::chrono::milliseconds timeout)
+    {
+        std::vector<HANDLE> handles = {wake_event_};
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (const auto &watch : watches_) {
+                handles.push_back(watch.handle);
+            }
+        }
+
+        std::vector<Change> changes;
+        const DWORD result = WaitForMultipleObjects(
+            static_cast<DWORD>(handles.size()), handles.data(), FALSE, static_cast<DWORD>(timeout.count()));
+        if (result > WAIT_OBJECT_0 && result < WAIT_OBJECT_0 + handles.size()) {
+            // Watches are only removed by this thread, so the signalled watch is still at the same position.
+            std::lock_guard<std::mutex> lock(mutex_);
+            const size_t watch_index = result - WAIT_OBJECT_0 - 1;
+            changes.push_back({Change::Type::RESCAN, watches_[watch_index].key, {}});
+            if (!FindNextChangeNotification(watches_[watch_index].handle)) {
+                // The directory no longer exists, it is watched again if a rescan finds it.
+                FindCloseChangeNotification(watches_[watch_index].handle);
+                watches_.erase(watches_.begin() + watch_index);
+            }
+        }
+        return changes;
+    }
+
+    void wake() { SetEvent(wake_event_); }
+
+  private:
+    struct Watch {
+        std::string key;
+        HANDLE handle;
+    };
+
+    HANDLE wake_event_; // Signalled to interrupt wait_for_changes().
+    std::mutex mutex_;
+    std::vector<Watch> watches_;
+};
+#else
+/**
+ * @brief Placeholder for platforms without a supported change notification API, relying on periodic rescans alone.
+ */
+class DirectoryIndex::Watcher
+{
+  public:
+    void watch(const std::string &, const std::filesystem::path &, const bool, const bool) {}
+
+    std::vector<Change> wait_for_changes(const std::chrono::milliseconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        wake_condition_.wait_for(lock, timeout, [this]() { return woken_; });
+        woken_ = false;
+        return {};
+    }
+
+    void wake()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            woken_ = true;
+        }
+        wake_condition_.notify_all();
+    }
+
+  private:
+    std::mutex mutex_;
+    std::condition_variable wake_condition_;
+    bool woken_ = false;
+};
+#endif
+
+DirectoryIndex::DirectoryIndex(const std::chrono::milliseconds rescan_interval)
+    : rescan_interval_(rescan_interval), watcher_(std::make_unique<Watcher>())
+{
+    background_thread_ = std::thread(&DirectoryIndex::run_background_updates, this);
+}
+
+DirectoryIndex::~DirectoryIndex()
+{
+    stop_requested_ = true;
+    watcher_->wake();
+    if (background_thread_.joinable()) {
+        background_thread_.join();
+    }
+}
+
+std::optional<std::vector<std::string>> DirectoryIndex::find_files(const std::string &directory,
+                                                                   const std::string &extension)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    const IndexedDirectory &indexed_directory = get_indexed_directory(directory, true, lock);
+    if (!indexed_directory.exists) {
+        return std::nullopt;
+    }
+    std::vector<std::string> found_files;
+    for (const auto &file : indexed_directory.files) {
+        if (std::filesystem::path(file).extension() == extension) {
+            found_files.push_back(file);
+        }
+    }
+    return found_files;
+}
+
+std::optional<std::vector<std::string>> DirectoryIndex::list_entries(const std::string &directory)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    const IndexedDirectory &indexed_directory = get_indexed_directory(directory, false, lock);
+    if (!indexed_directory.exists) {
+        return std::nullopt;
+    }
+    std::vector<std::string> entries;
+    entries.reserve(indexed_directory.files.size() + indexed_directory.directories.size());
+    for (const auto *paths : {&indexed_directory.files, &indexed_directory.directories}) {
+        for (const auto &path : *paths) {
+            entries.push_back(std::filesystem::path(path).filename().string());
+        }
+    }
+    std::sort(entries.begin(), entries.end());
+    return entries;
+}
+
+std::string DirectoryIndex::key_of(const std::string &directory, const bool recursive)
+{
+    return (recursive ? "recursive|" : "entries|") + directory;
+}
+
+void DirectoryIndex::scan(IndexedDirectory &indexed_directory)
+{
+    indexed_directory.files.clear();
+    indexed_directory.directories.clear();
+    std::error_code error;
+    indexed_directory.exists = std::filesystem::is_directory(indexed_directory.root, error);
+
+    const auto add_entry = [&indexed_directory](const std::filesystem::directory_entry &entry) {
+        std::error_code entry_error;
+        if (entry.is_directory(entry_error)) {
+            indexed_directory.directories.insert(entry.path().string());
+        } else {
+            indexed_directory.files.insert(entry.path().string());
+        }
+    };
+    if (indexed_directory.exists && indexed_directory.recursive) {
+        for (auto it = std::filesystem::recursive_directory_iterator(
+                 indexed_directory.root, std::filesystem::directory_options::skip_permission_denied, error);
+             !error && it != std::filesystem::recursive_directory_iterator();
+             it.increment(error)) {
+            add_entry(*it);
+        }
+    } else if (indexed_directory.exists) {
+        for (auto it = std::filesystem::directory_iterator(indexed_directory.root, error);
+             !error && it != std::filesystem::directory_iterator();
+             it.increment(error)) {
+            add_entry(*it);
+        }
+    }
+
+    indexed_directory.scan_time = std::chrono::steady_clock::now();
+    indexed_directory.needs_rescan = false;
+    num_scans_++;
+}
+
+void DirectoryIndex::scan_subdirectory(const std::string &key,
+                                       IndexedDirectory &indexed_directory,
+                                       const std::filesystem::path &path)
+{
+    // Watch before scanning, so entries created during the scan are reported rather than missed.
+    watcher_->watch(key, path, false, true);
+    std::error_code error;
+    for (auto it = std::filesystem::recursive_directory_iterator(
+             path, std::filesystem::directory_options::skip_permission_denied, error);
+         !error && it != std::filesystem::recursive_directory_iterator();
+         it.increment(error)) {
+        std::error_code entry_error;
+        if (it->is_directory(entry_error)) {
+            indexed_directory.directories.insert(it->path().string());
+            watcher_->watch(key, it->path(), false, true);
+        } else {
+            indexed_directory.files.insert(it->path().string());
+        }
+    }
+}
+
+const DirectoryIndex::IndexedDirectory &DirectoryIndex::get_indexed_directory(const std::string &directory,
+                                                                              const bool recursive,
+                                                                              std::unique_lock<std::mutex> &lock)
+{
+    const std::string key = key_of(directory, recursive);
+    auto it = indexed_directories_.find(key);
+    if (it != indexed_directories_.end()) {
+        return it->second;
+    }
+
+    // Build the index of a new directory without holding the lock, so other directories can be listed meanwhile.
+    IndexedDirectory indexed_directory;
+    indexed_directory.root = directory;
+    indexed_directory.recursive = recursive;
+    lock.unlock();
+    scan(indexed_directory);
+    lock.lock();
+
+    it = indexed_directories_.find(key);
+    if (it == indexed_directories_.end()) {
+        it = indexed_directories_.emplace(key, std::move(indexed_directory)).first;
+        watch(key, it->second);
+    }
+    return it->second;
+}
+
+void DirectoryIndex::watch(const std::string &key, const IndexedDirectory &indexed_directory)
+{
+    if (!indexed_directory.exists) {
+        return;
+    }
+    watcher_->watch(key, indexed_directory.root, true, indexed_directory.recursive);
+    if (indexed_directory.recursive) {
+        for (const auto &subdirectory : indexed_directory.directories) {
+            watcher_->watch(key, subdirectory, false, true);
+        }
+    }
+}
+
+void DirectoryIndex::apply(const Change &change)
+{
+    if (change.type == Change::Type::RESCAN) {
+        for (auto &[key, indexed_directory] : indexed_directories_) {
+            if (change.key.empty() || change.key == key) {
+                indexed_directory.needs_rescan = true;
+            }
+        }
+        return;
+    }
+
+    const auto it = indexed_directories_.find(change.key);
+    if (it == indexed_directories_.end()) {
+        return;
+    }
+    IndexedDirectory &indexed_directory = it->second;
+    const std::string path = change.path.string();
+    if (change.type == Change::Type::ADDED) {
+        if (change.is_directory) {
+            indexed_directory.directories.insert(path);
+            if (indexed_directory.recursive) {
+                scan_subdirectory(change.key, indexed_directory, change.path);
+            }
+        } else {
+            indexed_directory.files.insert(path);
+        }
+    } else {
+        if (change.is_directory) {
+            indexed_directory.directories.erase(path);
+            erase_within(indexed_directory.directories, path);
+            erase_within(indexed_directory.files, path);
+        } else {
+            indexed_directory.files.erase(path);
+        }
+    }
+}
+
+void DirectoryIndex::run_background_updates()
+{
+    while (!stop_requested_) {
+        const auto changes = watcher_->wait_for_changes(std::min(POLL_INTERVAL, rescan_interval_));
+        if (stop_requested_) {
+            break;
+        }
+
+        std::vector<std::pair<std::string, IndexedDirectory>> rescans;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (const auto &change : changes) {
+                apply(change);
+            }
+            const auto now = std::chrono::steady_clock::now();
+            for (const auto &[key, indexed_directory] : indexed_directories_) {
+                if (indexed_directory.needs_rescan || now - indexed_directory.scan_time >= rescan_interval_) {
+                    IndexedDirectory rescan;
+                    rescan.root = indexed_directory.root;
+                    rescan.recursive = indexed_directory.recursive;
+                    rescans.emplace_back(key, std::move(rescan));
+                }
+            }
+        }
+
+        // Rescan without holding the lock, so listings are served from the previous index meanwhile.
+        for (auto &[key, rescan] : rescans) {
+            if (stop_requested_) {
+                break;
+            }
+            scan(rescan);
+            std::lock_guard<std::mutex> lock(mutex_);
+            const auto it = indexed_directories_.find(key);
+            if (it != indexed_directories_.end()) {
+                it->second = std::move(rescan);
+                watch(key, it->second);
+            }
+        }
+    }
+}
@@ -0,0 +1,111 @@
+// Copyright 2026 Charles Tytler
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Keeps the contents of directories in memory, so repeated listings do not walk the filesystem.
+ *
+ *   A directory is scanned the first time it is listed, and from then on is kept current by a background thread. On
+ *   Linux, changes reported by inotify are applied to the index as they happen. On Windows, a change notification on a
+ *   directory causes it to be rescanned in the background. Every directory is also rescanned periodically, which covers
+ *   changes not reported by the operating system, e.g. on network drives.
+ *
+ *   Directories indexed recursively and non-recursively are indexed separately. The index may be used from multiple
+ *   threads.
+ */
+class DirectoryIndex
+{
+  public:
+    static constexpr std::chrono::milliseconds DEFAULT_RESCAN_INTERVAL{60000};
+
+    /**
+     * @param rescan_interval Time after which each indexed directory is rescanned in the background.
+     */
+    explicit DirectoryIndex(const std::chrono::milliseconds rescan_interval = DEFAULT_RESCAN_INTERVAL);
+    ~DirectoryIndex();
+
+    DirectoryIndex(const DirectoryIndex &) = delete;
+    DirectoryIndex &operator=(const DirectoryIndex &) = delete;
+
+    /**
+     * @brief Get the paths of all files with the extension anywhere within the directory.
+     * @param directory Directory to search, which is scanned and indexed recursively on the first call.
+     * @param extension File extension including the dot (e.g. ".json").
+     * @return Paths of the files in sorted order, formed as by std::filesystem::recursive_directory_iterator, or
+     * nullopt if the directory does not exist.
+     */
+    std::optional<std::vector<std::string>> find_files(const std::string &directory, const std::string &extension);
+
+    /**
+     * @brief Get the names of the files and subdirectories directly within the directory.
+     * @return Names in sorted order, or nullopt if the directory does not exist.
+     */
+    std::optional<std::vector<std::string>> list_entries(const std::string &directory);
+
+    /**
+     * @brief Total number of full scans of indexed directories, including rescans.
+     */
+    size_t num_scans() const { return num_scans_; }
+
+  private:
+    struct IndexedDirectory {
+        std::filesystem::path root;
+        bool recursive = false;
+        bool exists = false;
+        std::set<std::string> files;       // Full paths of all files within the indexed directory.
+        std::set<std::string> directories; // Full paths of all subdirectories within the indexed directory.
+        std::chrono::steady_clock::time_point scan_time;
+        bool needs_rescan = false;
+    };
+
+    /**
+     * @brief A change to an indexed directory reported by the platform's change watcher.
+     */
+    struct Change {
+        enum class Type { ADDED, REMOVED, RESCAN };
+        Type type;
+        std::string key;            // Key of the indexed directory, or empty to rescan all directories.
+        std::filesystem::path path; // Path of the added or removed file or subdirectory.
+        bool is_directory = false;
+    };
+
+    class Watcher;
+
+    static std::string key_of(const std::string &directory, const bool recursive);
+    void scan(IndexedDirectory &indexed_directory);
+    void scan_subdirectory(const std::string &key,
+                           IndexedDirectory &indexed_directory,
+                           const std::filesystem::path &path);
+
+    /**
+     * @brief Get the index of a directory, first scanning it without holding the lock if it is not yet indexed.
+     */
+    const IndexedDirectory &get_indexed_directory(const std::string &directory,
+                                                  const bool recursive,
+                                                  std::unique_lock<std::mutex> &lock);
+    void watch(const std::string &key, const IndexedDirectory &indexed_directory);
+    void apply(const Change &change);
+    void run_background_updates();
+
+    std::chrono::milliseconds rescan_interval_;
+    std::unique_ptr<Watcher> watcher_;
+
+    std::mutex mutex_;
+    std::unordered_map<std::string, IndexedDirectory> indexed_directories_;
+    std::atomic<size_t> num_scans_ = 0;
+
+    std::atomic<bool> stop_requested_ = false;
+    std::thread background_thread_;
+};
@@ -2,6 +2,8 @@
 
 #include "JsonReader.h"
 
+#include "Utilities/DirectoryIndex.h"
+
 #include <filesystem>
 #include <fstream>
 
@@ -18,6 +20,15 @@ std::optional<json> get_module_list(const std::string &path)
     return module_list.size() > 0 ? std::make_optional(module_list) : std::nullopt;
 }
 
+std::optional<json> get_module_list(const std::string &path, DirectoryIndex &directory_index)
+{
+    const auto json_files = directory_index.find_files(path, ".json");
+    if (!json_files || json_files->empty()) {
+        return std::nullopt;
+    }
+    return json(json_files.value());
+}
+
 std::optional<json> read_json_file(const std::string &filename)
 {
     std::ifstream ifs(filename);
@@ -26,3 +37,60 @@ std::optional<json> read_json_file(const std::string &filename)
     }
     return std::nullopt;
 }
+
+json get_control_reference_items(const json &control_reference)
+{
+    auto items = json::array();
+    if (control_reference.is_object()) {
+        for (const auto &category : control_reference) {
+            if (category.is_object()) {
+                for (const auto &control : category) {
+                    if (control.is_object()) {
+                        items.push_back(control);
+                    }
+                }
+            }
+        }
+    }
+    return items;
+}
+
+bool is_control_reference(const json &control_reference)
+{
+    if (control_reference.is_object()) {
+        for (const auto &category : control_reference) {
+            if (category.is_object()) {
+                for (const auto &control : category) {
+                    if (control.is_object()) {
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+    return false;
+}
+
+std::vector<std::string> get_control_reference_files(const std::string &dcs_bios_path,
+                                                     DirectoryIndex &directory_index)
+{
+    // Other json files of the installation, such as its lua library's, are not control references.
+    const auto control_reference_path = std::filesystem::path(dcs_bios_path) / "doc" / "json";
+    auto json_files = directory_index.find_files(control_reference_path.string(), ".json");
+    if (!json_files) {
+        json_files = directory_index.find_files(dcs_bios_path, ".json");
+    }
+    return json_files.value_or(std::vector<std::string>{});
+}
+
+std::optional<std::string_view> get_valid_json_text(std::string_view text)
+{
+    constexpr std::string_view utf8_byte_order_mark = "\xEF\xBB\xBF";
+    if (text.substr(0, utf8_byte_order_mark.size()) == utf8_byte_order_mark) {
+        text.remove_prefix(utf8_byte_order_mark.size());
+    }
+    if (!json::accept(text.data(), text.data() + text.size())) {
+        return std::nullopt;
+    }
+    return text;
+}
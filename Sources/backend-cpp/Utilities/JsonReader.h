@@ -4,10 +4,45 @@
 
 #include <optional>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "nlohmann\json.hpp"
 using json = nlohmann::json;
 
+class DirectoryIndex;
+
 std::optional<json> get_module_list(const std::string &path);
 
+/**
+ * @brief Get the list of json files within the path as get_module_list(), answered from the directory index.
+ */
+std::optional<json> get_module_list(const std::string &path, DirectoryIndex &directory_index);
+
 std::optional<json> read_json_file(const std::string &filename);
+
+/**
+ * @brief Get the controls of a DCS-BIOS control reference as a flat array, in order of category.
+ * @param control_reference Control reference json, holding an object of controls for each category.
+ */
+json get_control_reference_items(const json &control_reference);
+
+/**
+ * @brief Checks if json holds any controls read by get_control_reference_items(), unlike other json files of DCS-BIOS
+ *        such as its aircraft aliases.
+ */
+bool is_control_reference(const json &control_reference);
+
+/**
+ * @brief Get the control reference json files of a DCS-BIOS installation, answered from the directory index.
+ *        References are found in the installation's doc/json directory, or in the path itself if it has none (e.g.
+ *        if the path already is the doc/json directory).
+ */
+std::vector<std::string> get_control_reference_files(const std::string &dcs_bios_path,
+                                                     DirectoryIndex &directory_index);
+
+/**
+ * @brief Validates json text without building a json object from it, such as the contents of a mapped json file.
+ * @return Json text with any UTF-8 byte order mark removed, or nullopt if the text is not valid json.
+ */
+std::optional<std::string_view> get_valid_json_text(std::string_view text);
@@ -0,0 +1,206 @@
+// Copyright 2026 Charles Tytler
+
+#include "LuaArenaAllocator.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <numeric>
+
+LuaArenaAllocator::LuaArenaAllocator(const size_t memory_limit_bytes) : memory_limit_bytes_(memory_limit_bytes) {}
+
+void *LuaArenaAllocator::allocate(void *allocator, void *ptr, size_t old_size, size_t new_size)
+{
+    return static_cast<LuaArenaAllocator *>(allocator)->reallocate(ptr, old_size, new_size);
+}
+
+void *LuaArenaAllocator::reallocate(void *ptr, const size_t old_size, const size_t new_size)
+{
+    if (new_size == 0) {
+        if (ptr != nullptr) {
+            release(ptr, old_size);
+        }
+        return nullptr;
+    }
+    if (ptr == nullptr) {
+        // When ptr is null Lua passes the type of object being allocated as old_size, rather than a size.
+        return acquire(new_size, true);
+    }
+
+    // Lua assumes that shrinking a block never fails, so only growth is checked against the memory limit.
+    const bool is_growing = bytes_of(new_size) > bytes_of(old_size);
+    if (is_small(old_size) && is_small(new_size) && size_class_of(old_size) == size_class_of(new_size)) {
+        return ptr;
+    }
+    if (!is_small(old_size) && !is_small(new_size)) {
+        if (is_growing && bytes_reserved() + (new_size - old_size) > memory_limit_bytes_) {
+            return nullptr;
+        }
+        void *resized = std::realloc(ptr, new_size);
+        if (resized == nullptr) {
+            if (is_growing) {
+                return nullptr;
+            }
+            // A failed shrink leaves the original block in place, which is still large enough.
+            resized = ptr;
+        }
+        bytes_in_use_ = bytes_in_use_ + new_size - old_size;
+        large_bytes_ = large_bytes_ + new_size - old_size;
+        peak_bytes_in_use_ = std::max(peak_bytes_in_use_, bytes_in_use_);
+        return resized;
+    }
+
+    // Block moves between the small and large allocations, or between small size classes.
+    void *moved = acquire(new_size, is_growing);
+    if (moved == nullptr) {
+        if (is_growing) {
+            return nullptr;
+        }
+        // A shrink which needs a new chunk that cannot be allocated keeps the original block, which is large enough.
+        if (is_small(old_size)) {
+            // Freed later into the free list of the smaller size class, so is counted at that size from now on.
+            bytes_in_use_ -= bytes_of(old_size) - bytes_of(new_size);
+        } else {
+            large_blocks_of_small_size_.push_back({ptr, old_size});
+        }
+        return ptr;
+    }
+    std::memcpy(moved, ptr, std::min(old_size, new_size));
+    release(ptr, old_size);
+    return moved;
+}
+
+void *LuaArenaAllocator::acquire(const size_t size, const bool enforce_limit)
+{
+    const size_t num_bytes = bytes_of(size);
+    void *block = nullptr;
+    if (is_small(size)) {
+        FreeBlock *&free_list = free_lists_[size_class_of(size)];
+        if (free_list != nullptr) {
+            block = free_list;
+            free_list = free_list->next;
+        } else {
+            if (chunk_remaining_ < num_bytes) {
+                if (enforce_limit && bytes_reserved() + CHUNK_SIZE > memory_limit_bytes_) {
+                    return nullptr;
+                }
+                auto chunk = std::unique_ptr<char[]>(new (std::nothrow) char[CHUNK_SIZE]);
+                if (!chunk) {
+                    return nullptr;
+                }
+                chunk_position_ = chunk.get();
+                chunk_remaining_ = CHUNK_SIZE;
+                chunks_.push_back(Chunk{std::move(chunk), 0});
+            }
+            block = chunk_position_;
+            chunk_position_ += num_bytes;
+            chunk_remaining_ -= num_bytes;
+            chunks_.back().carved_bytes += num_bytes;
+        }
+    } else {
+        if (enforce_limit && bytes_reserved() + num_bytes > memory_limit_bytes_) {
+            return nullptr;
+        }
+        // Room to record the block if it is later kept by a shrink is reserved now, as a shrink may not fail.
+        if (large_blocks_of_small_size_.capacity() <= num_large_blocks_) {
+            try {
+                large_blocks_of_small_size_.reserve(2 * (num_large_blocks_ + 1));
+            } catch (const std::bad_alloc &) {
+                return nullptr;
+            }
+        }
+        block = std::malloc(size);
+        if (block == nullptr) {
+            return nullptr;
+        }
+        large_bytes_ += num_bytes;
+        num_large_blocks_++;
+    }
+
+    bytes_in_use_ += num_bytes;
+    peak_bytes_in_use_ = std::max(peak_bytes_in_use_, bytes_in_use_);
+    return block;
+}
+
+void LuaArenaAllocator::release(void *ptr, const size_t size)
+{
+    if (is_small(size) && !large_blocks_of_small_size_.empty()) {
+        const auto large_block = std::find_if(large_blocks_of_small_size_.begin(),
+                                              large_blocks_of_small_size_.end(),
+                                              [ptr](const LargeBlock &block) { return block.ptr == ptr; });
+        if (large_block != large_blocks_of_small_size_.end()) {
+            std::free(ptr);
+            large_bytes_ -= large_block->size;
+            bytes_in_use_ -= large_block->size;
+            num_large_blocks_--;
+            large_blocks_of_small_size_.erase(large_block);
+            return;
+        }
+    }
+    if (is_small(size)) {
+        FreeBlock *&free_list = free_lists_[size_class_of(size)];
+        free_list = new (ptr) FreeBlock{free_list};
+    } else {
+        std::free(ptr);
+        large_bytes_ -= size;
+        num_large_blocks_--;
+    }
+    bytes_in_use_ -= bytes_of(size);
+}
+
+size_t LuaArenaAllocator::release_free_chunks()
+{
+    // Indexes of the chunks in order of address, to find the chunk holding each free block.
+    std::vector<size_t> chunks_by_address(chunks_.size());
+    std::iota(chunks_by_address.begin(), chunks_by_address.end(), 0);
+    std::sort(chunks_by_address.begin(), chunks_by_address.end(), [this](const size_t lhs, const size_t rhs) {
+        return std::less<const char *>()(chunks_[lhs].memory.get(), chunks_[rhs].memory.get());
+    });
+    const auto is_before_chunk = [this](const FreeBlock *block, const size_t i) {
+        return std::less<const char *>()(reinterpret_cast<const char *>(block), chunks_[i].memory.get());
+    };
+    const auto chunk_of = [&chunks_by_address, &is_before_chunk](const FreeBlock *block) {
+        return *(std::upper_bound(chunks_by_address.begin(), chunks_by_address.end(), block, is_before_chunk) - 1);
+    };
+
+    std::vector<size_t> freed_bytes(chunks_.size(), 0);
+    for (size_t size_class = 0; size_class < NUM_SIZE_CLASSES; size_class++) {
+        for (const FreeBlock *block = free_lists_[size_class]; block != nullptr; block = block->next) {
+            freed_bytes[chunk_of(block)] += (size_class + 1) * SIZE_CLASS_GRANULARITY;
+        }
+    }
+    std::vector<bool> is_free(chunks_.size());
+    size_t num_free_chunks = 0;
+    for (size_t i = 0; i < chunks_.size(); i++) {
+        is_free[i] = freed_bytes[i] == chunks_[i].carved_bytes;
+        num_free_chunks += is_free[i] ? 1 : 0;
+    }
+    if (num_free_chunks == 0) {
+        return 0;
+    }
+
+    // Unlink the free blocks of released chunks before releasing them.
+    for (auto &free_list : free_lists_) {
+        for (FreeBlock **link = &free_list; *link != nullptr;) {
+            if (is_free[chunk_of(*link)]) {
+                *link = (*link)->next;
+            } else {
+                link = &(*link)->next;
+            }
+        }
+    }
+    if (is_free.back()) {
+        chunk_position_ = nullptr;
+        chunk_remaining_ = 0;
+    }
+    size_t num_kept = 0;
+    for (size_t i = 0; i < chunks_.size(); i++) {
+        if (!is_free[i]) {
+            chunks_[num_kept++] = std::move(chunks_[i]);
+        }
+    }
+    chunks_.erase(chunks_.begin() + num_kept, chunks_.end());
+    return num_free_chunks;
+}
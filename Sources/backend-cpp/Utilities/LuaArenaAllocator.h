@@ -0,0 +1,130 @@
+// Copyright 2026 Charles Tytler
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Memory allocator for a Lua state, with the same signature as lua_Alloc, which enforces a memory limit.
+ *
+ *   Small blocks, which make up nearly all of Lua's allocations, are carved from large chunks by bumping a pointer and
+ *   are recycled through free lists of fixed size classes, so a state running many scripts reuses its memory rather
+ *   than returning to the system allocator. Larger blocks are allocated individually. The memory limit applies to the
+ *   memory reserved from the system, being whole chunks including their free blocks plus the large blocks, and
+ *   requests which would take it above the limit fail, which Lua reports to the running script as a "not enough
+ *   memory" error. Chunks holding no blocks in use are released by release_free_chunks(), and all chunks when the
+ *   allocator is destroyed, which must be after the Lua state using it is closed.
+ *
+ *   An allocator is not thread-safe and is intended to be used by a single Lua state.
+ */
+class LuaArenaAllocator
+{
+  public:
+    static constexpr size_t CHUNK_SIZE = 64 * 1024;      // Size of each chunk small blocks are carved from.
+    static constexpr size_t SIZE_CLASS_GRANULARITY = 16; // Small block sizes are rounded up to a multiple of this.
+    static constexpr size_t MAX_SMALL_BLOCK_SIZE = 512;  // Blocks larger than this are allocated individually.
+
+    /**
+     * @brief Construct an allocator.
+     * @param memory_limit_bytes Maximum number of bytes which may be in use by the Lua state at once.
+     */
+    explicit LuaArenaAllocator(const size_t memory_limit_bytes);
+
+    // Blocks held by a Lua state refer into the allocator's chunks, so it may not be moved or copied.
+    LuaArenaAllocator(const LuaArenaAllocator &) = delete;
+    LuaArenaAllocator &operator=(const LuaArenaAllocator &) = delete;
+
+    /**
+     * @brief Allocation function to pass to lua_newstate(), with a pointer to the allocator as its user data.
+     */
+    static void *allocate(void *allocator, void *ptr, size_t old_size, size_t new_size);
+
+    /**
+     * @brief Allocates, resizes or frees a block following the rules of lua_Alloc.
+     * @param ptr      Block to resize or free, or nullptr to allocate a new block.
+     * @param old_size Size of the block pointed to by ptr, ignored if ptr is nullptr.
+     * @param new_size Requested size, or 0 to free the block.
+     * @return Pointer to the block of the new size, or nullptr if it was freed or could not be allocated.
+     */
+    void *reallocate(void *ptr, const size_t old_size, const size_t new_size);
+
+    void set_memory_limit(const size_t memory_limit_bytes) { memory_limit_bytes_ = memory_limit_bytes; }
+    size_t memory_limit() const { return memory_limit_bytes_; }
+
+    /**
+     * @brief Number of bytes currently allocated to the Lua state, with small blocks counted at their size class.
+     */
+    size_t bytes_in_use() const { return bytes_in_use_; }
+
+    /**
+     * @brief Largest number of bytes in use at once over the lifetime of the allocator.
+     */
+    size_t peak_bytes_in_use() const { return peak_bytes_in_use_; }
+
+    /**
+     * @brief Number of bytes reserved from the system, which is what is counted against the memory limit.
+     */
+    size_t bytes_reserved() const { return chunks_.size() * CHUNK_SIZE + large_bytes_; }
+
+    /**
+     * @brief Number of chunks currently held for small blocks.
+     */
+    size_t num_chunks() const { return chunks_.size(); }
+
+    /**
+     * @brief Releases the chunks in which every block carved so far has been freed, e.g. after garbage collection.
+     * @return Number of chunks released.
+     */
+    size_t release_free_chunks();
+
+  private:
+    static constexpr size_t NUM_SIZE_CLASSES = MAX_SMALL_BLOCK_SIZE / SIZE_CLASS_GRANULARITY;
+
+    static bool is_small(const size_t size) { return size <= MAX_SMALL_BLOCK_SIZE; }
+    static size_t size_class_of(const size_t size)
+    {
+        return (size + SIZE_CLASS_GRANULARITY - 1) / SIZE_CLASS_GRANULARITY - 1;
+    }
+    /**
+     * @brief Number of bytes a block of the given size occupies.
+     */
+    static size_t bytes_of(const size_t size)
+    {
+        return is_small(size) ? (size_class_of(size) + 1) * SIZE_CLASS_GRANULARITY : size;
+    }
+
+    /**
+     * @brief Allocates a new block, failing if enforce_limit is set and the block would exceed the memory limit.
+     */
+    void *acquire(const size_t size, const bool enforce_limit);
+    void release(void *ptr, const size_t size);
+
+    struct FreeBlock {
+        FreeBlock *next;
+    };
+
+    struct Chunk {
+        std::unique_ptr<char[]> memory;
+        size_t carved_bytes; // Bytes of the chunk carved into blocks, whether in use or freed.
+    };
+
+    struct LargeBlock {
+        void *ptr;
+        size_t size;
+    };
+
+    std::vector<Chunk> chunks_;                              // Chunks which small blocks are carved from, newest last.
+    char *chunk_position_ = nullptr;                         // Start of the unused remainder of the newest chunk.
+    size_t chunk_remaining_ = 0;                             // Size of the unused remainder of the newest chunk.
+    std::array<FreeBlock *, NUM_SIZE_CLASSES> free_lists_{}; // Freed small blocks of each size class.
+    size_t large_bytes_ = 0;                                 // Bytes of the individually allocated blocks.
+    size_t num_large_blocks_ = 0;                            // Number of the individually allocated blocks.
+    std::vector<LargeBlock> large_blocks_of_small_size_;     // Large blocks kept by shrinks to a small size.
+
+    size_t memory_limit_bytes_;
+    size_t bytes_in_use_ = 0;
+    size_t peak_bytes_in_use_ = 0;
+};
@@ -2,8 +2,12 @@
 
 #include "LuaReader.h"
 
+#include "Utilities/DirectoryIndex.h"
+#include "Utilities/LuaStatePool.h"
+
 #include "lua.hpp"
 
+#include <cstdio>
 #include <filesystem>
 #include <iostream>
 #include <string>
@@ -29,6 +33,131 @@ json get_installed_modules(const std::string &dcs_install_path, const std::strin
     return installed_modules_and_result;
 }
 
+json get_installed_modules(const std::string &dcs_install_path,
+                           const std::string &module_subdir,
+                           DirectoryIndex &directory_index)
+{
+    json installed_modules_and_result;
+    installed_modules_and_result["installed_modules"] = json::array();
+    installed_modules_and_result["result"] = "";
+    const auto module_names = directory_index.list_entries(dcs_install_path + module_subdir);
+    if (module_names) {
+        installed_modules_and_result["installed_modules"] = module_names.value();
+        installed_modules_and_result["result"] = "success";
+    } else {
+        installed_modules_and_result["result"] =
+            "DCS Install path [" + dcs_install_path + module_subdir + "] not found.";
+    }
+    return installed_modules_and_result;
+}
+
+namespace
+{
+/**
+ * @brief Formats a Lua number as Lua's tostring does, e.g. 1.0 as "1.0" rather than "1".
+ *
+ *   Formatted here rather than by lua_tolstring, which allocates in the Lua state and so may raise a memory error
+ *   outside of protected mode.
+ */
+std::string lua_number_to_string(lua_State *lua_state, const int index)
+{
+    if (lua_isinteger(lua_state, index)) {
+        return std::to_string(lua_tointeger(lua_state, index));
+    }
+    char buffer[64];
+    std::snprintf(buffer, sizeof(buffer), LUA_NUMBER_FMT, static_cast<LUAI_UACNUMBER>(lua_tonumber(lua_state, index)));
+    std::string value(buffer);
+    if (value.find_first_not_of("-0123456789") == std::string::npos) {
+        value += ".0";
+    }
+    return value;
+}
+
+/**
+ * @brief Converts the Lua value at the given stack index to json, recursing into tables.
+ *
+ *   Integers are converted to json numbers, and floats to strings in Lua's formatting so that a value written as 1.0
+ *   is still shown as "1.0" rather than "1". Tables with consecutive integer keys starting at 1 are converted to
+ *   arrays, all other tables to objects. Functions and other values which have no json representation, and tables
+ *   nested too deeply for the Lua stack, are converted to null.
+ *
+ *   Nothing is allocated in the Lua state, so the conversion raises no Lua errors and is safe outside protected mode.
+ */
+json lua_value_to_json(lua_State *lua_state, const int index)
+{
+    switch (lua_type(lua_state, index)) {
+    case LUA_TNUMBER: {
+        if (lua_isinteger(lua_state, index)) {
+            return lua_tointeger(lua_state, index);
+        }
+        return lua_number_to_string(lua_state, index);
+    }
+    case LUA_TSTRING: {
+        size_t length = 0;
+        const char *value = lua_tolstring(lua_state, index, &length);
+        return std::string(value, length);
+    }
+    case LUA_TBOOLEAN:
+        return static_cast<bool>(lua_toboolean(lua_state, index));
+    case LUA_TTABLE: {
+        if (!lua_checkstack(lua_state, 3)) {
+            return nullptr;
+        }
+        const int table_index = lua_absindex(lua_state, index);
+        const lua_Integer array_length = static_cast<lua_Integer>(lua_rawlen(lua_state, table_index));
+        json converted = (array_length > 0) ? json::array() : json::object();
+        if (array_length > 0) {
+            for (lua_Integer i = 1; i <= array_length; i++) {
+                lua_rawgeti(lua_state, table_index, i);
+                converted.push_back(lua_value_to_json(lua_state, -1));
+                lua_pop(lua_state, 1);
+            }
+            return converted;
+        }
+        lua_pushnil(lua_state);
+        while (lua_next(lua_state, table_index) != 0) {
+            // Numeric keys are named as by Lua's tostring, and keys of other types which are not strings are skipped.
+            if (lua_type(lua_state, -2) == LUA_TSTRING) {
+                size_t length = 0;
+                const char *key = lua_tolstring(lua_state, -2, &length);
+                converted[std::string(key, length)] = lua_value_to_json(lua_state, -1);
+            } else if (lua_type(lua_state, -2) == LUA_TNUMBER) {
+                converted[lua_number_to_string(lua_state, -2)] = lua_value_to_json(lua_state, -1);
+            }
+            lua_pop(lua_state, 1);
+        }
+        return converted;
+    }
+    default:
+        return nullptr;
+    }
+}
+
+/**
+ * @brief Sets the globals read by the clickabledata script and loads it, run protected. Takes the DCS path, module name
+ *        and script path as light userdata, and returns the loaded chunk or error message and the load status.
+ */
+int set_globals_and_load_script(lua_State *lua_state)
+{
+    const auto *dcs_path = static_cast<const char *>(lua_touserdata(lua_state, 1));
+    const auto *module_name = static_cast<const char *>(lua_touserdata(lua_state, 2));
+    const auto *lua_script = static_cast<const char *>(lua_touserdata(lua_state, 3));
+    lua_pushstring(lua_state, dcs_path);
+    lua_setglobal(lua_state, "dcs_install_path");
+    lua_pushstring(lua_state, module_name);
+    lua_setglobal(lua_state, "module_name");
+    const int file_status = luaL_loadfile(lua_state, lua_script);
+    lua_pushinteger(lua_state, file_status);
+    return 2;
+}
+} // namespace
+
+LuaStatePool &clickabledata_lua_state_pool()
+{
+    static LuaStatePool lua_state_pool;
+    return lua_state_pool;
+}
+
 json get_clickabledata(const std::string &dcs_path,
                        const std::string &module_name,
                        const std::string &lua_script)
@@ -37,45 +166,60 @@ json get_clickabledata(const std::string &dcs_path,
     clickabledata_and_result["clickabledata_items"] = json::array();
     clickabledata_and_result["result"] = "";
 
-    // create new Lua state
-    lua_State *lua_state;
-    lua_state = luaL_newstate();
-
-    // load Lua libraries
-    luaL_openlibs(lua_state);
+    // Take a state with the libraries already opened, which is returned to the pool when the lease goes out of scope.
+    LuaStatePool::Lease lease = clickabledata_lua_state_pool().acquire();
+    if (!lease) {
+        clickabledata_and_result["result"] = "Lua state could not be created.";
+        return clickabledata_and_result;
+    }
+    lua_State *lua_state = lease.state();
 
     // Write variables to lua, the below sends to lua: [module_name = "A-10C"]
-    lua_pushstring(lua_state, dcs_path.c_str());
-    lua_setglobal(lua_state, "dcs_install_path");
-    lua_pushstring(lua_state, module_name.c_str());
-    lua_setglobal(lua_state, "module_name");
-
-    // Run the lua script file, expecting multiple return values.
-    const int lua_stack_size = lua_gettop(lua_state);
-    const int file_status = luaL_loadfile(lua_state, lua_script.c_str());
+    // Then load the lua script file. Both are done in protected mode, as allocating in the Lua state may fail with a
+    // memory error like any other Lua error.
+    lua_pushcfunction(lua_state, &set_globals_and_load_script);
+    lua_pushlightuserdata(lua_state, const_cast<char *>(dcs_path.c_str()));
+    lua_pushlightuserdata(lua_state, const_cast<char *>(module_name.c_str()));
+    lua_pushlightuserdata(lua_state, const_cast<char *>(lua_script.c_str()));
+    const int load_status = lua_pcall(lua_state, 3, 2, 0);
+    const int file_status = (load_status != 0) ? load_status : static_cast<int>(lua_tointeger(lua_state, -1));
+    if (load_status == 0) {
+        lua_pop(lua_state, 1);
+    }
     if (file_status != 0) {
         clickabledata_and_result["result"] =
             "Lua file load error (" + std::to_string(file_status) + "): " + lua_tostring(lua_state, -1);
-        lua_close(lua_state);
+        lease.discard();
         return clickabledata_and_result;
     }
-    const int script_status = lua_pcall(lua_state, 0, LUA_MULTRET, 0);
+
+    // Run the lua script, expecting a single table of clickabledata element records.
+    const int script_status = lua_pcall(lua_state, 0, 1, 0);
     if (script_status != 0) {
         clickabledata_and_result["result"] =
             "Lua script runtime error (" + std::to_string(script_status) + "): " + lua_tostring(lua_state, -1);
-        lua_close(lua_state);
+        lease.discard();
         return clickabledata_and_result;
     }
 
-    // Handle each of the return values one at a time.
-    while ((lua_gettop(lua_state) - lua_stack_size) > 0) {
-        clickabledata_and_result["result"] = "success";
-        clickabledata_and_result["clickabledata_items"].push_back(lua_tostring(lua_state, lua_gettop(lua_state)));
-        lua_pop(lua_state, 1);
+    if (!lua_istable(lua_state, -1)) {
+        clickabledata_and_result["result"] = "Lua script did not return a table of clickabledata elements.";
+        lease.discard();
+        return clickabledata_and_result;
     }
 
-    // close the Lua state
-    lua_close(lua_state);
+    // Convert each element record directly to a json object, keeping integer attributes as numbers.
+    const lua_Integer num_elements = static_cast<lua_Integer>(lua_rawlen(lua_state, -1));
+    auto &clickabledata_items = clickabledata_and_result["clickabledata_items"];
+    clickabledata_items.get_ref<json::array_t &>().reserve(static_cast<size_t>(num_elements));
+    for (lua_Integer i = 1; i <= num_elements; i++) {
+        lua_rawgeti(lua_state, -1, i);
+        if (lua_istable(lua_state, -1)) {
+            clickabledata_items.push_back(lua_value_to_json(lua_state, -1));
+        }
+        lua_pop(lua_state, 1);
+    }
+    clickabledata_and_result["result"] = "success";
 
     return clickabledata_and_result;
 }
@@ -6,6 +6,9 @@
 
 using json = nlohmann::json;
 
+class DirectoryIndex;
+class LuaStatePool;
+
 /**
  * @brief Get the installed modules within provided DCS installation directory.
  *
@@ -15,13 +18,31 @@ using json = nlohmann::json;
  */
 json get_installed_modules(const std::string &dcs_install_path, const std::string &module_subdir);
 
+/**
+ * @brief Get the installed modules as get_installed_modules(), answered from the directory index.
+ */
+json get_installed_modules(const std::string &dcs_install_path,
+                           const std::string &module_subdir,
+                           DirectoryIndex &directory_index);
+
+/**
+ * @brief Get the pool of Lua states used by get_clickabledata(), e.g. to change the memory limit of each extraction.
+ */
+LuaStatePool &clickabledata_lua_state_pool();
+
 /**
  * @brief Extract clickabledata elements from a DCS World module.
  *
+ *   The script is run in a state taken from clickabledata_lua_state_pool(), and fails with a memory error if it
+ *   exceeds the pool's memory limit. States are only reused after a script has run successfully.
+ *
  * @param dcs_path    Path to DCS directory (installation or saved games, e.g. "C:\Program Files\Eagle Dynamics\DCS World")
  * @param module_name Name of the module matching the folder naming convention (e.g. "A-10C")
- * @param lua_script  Lua script to run which should return comma-separated strings of clickabledata attributes.
- * @return json       Json array of comma-separated strings, each array element is one clickabledata element.
+ * @param lua_script  Lua script to run which should return an array table of clickabledata element records.
+ * @return json       Json array of objects, each array element is one clickabledata element with its attributes
+ *                    (device, device_id, button_id, element, type, dcs_id, click_value, limit_min, limit_max,
+ *                    description) as typed values, with floats kept as strings in Lua's formatting (e.g. "1.0").
+ *                    Attributes not defined by the module are omitted.
  */
 json get_clickabledata(const std::string &dcs_path,
                        const std::string &module_name,
@@ -0,0 +1,251 @@
+// Copyright 2026 Charles Tytler
+
+#include "LuaStatePool.h"
+
+#include "lua.hpp"
+
+namespace
+{
+// Address used as the registry key of the table holding each state's baseline globals.
+const char BASELINE_REGISTRY_KEY = 0;
+
+/**
+ * @brief Stores a shallow copy of the table at table_index into the baseline table, keyed by the table itself.
+ */
+void snapshot_table(lua_State *lua_state, const int baseline_index, const int table_index)
+{
+    lua_pushvalue(lua_state, table_index);
+    lua_newtable(lua_state);
+    lua_pushnil(lua_state);
+    while (lua_next(lua_state, table_index) != 0) {
+        lua_pushvalue(lua_state, -2);
+        lua_insert(lua_state, -2);
+        lua_rawset(lua_state, -4);
+    }
+    lua_rawset(lua_state, baseline_index);
+}
+
+/**
+ * @brief Restores the table at table_index to hold exactly the fields of its snapshot at snapshot_index.
+ */
+void restore_table(lua_State *lua_state, const int table_index, const int snapshot_index)
+{
+    // Clearing existing fields during traversal is allowed by lua_next.
+    lua_pushnil(lua_state);
+    while (lua_next(lua_state, table_index) != 0) {
+        lua_pop(lua_state, 1);
+        lua_pushvalue(lua_state, -1);
+        const bool in_snapshot = lua_rawget(lua_state, snapshot_index) != LUA_TNIL;
+        lua_pop(lua_state, 1);
+        if (!in_snapshot) {
+            lua_pushvalue(lua_state, -1);
+            lua_pushnil(lua_state);
+            lua_rawset(lua_state, table_index);
+        }
+    }
+    lua_pushnil(lua_state);
+    while (lua_next(lua_state, snapshot_index) != 0) {
+        lua_pushvalue(lua_state, -2);
+        lua_insert(lua_state, -2);
+        lua_rawset(lua_state, table_index);
+    }
+}
+
+/**
+ * @brief Opens the standard libraries and stores the baseline of the global and library tables, run protected.
+ */
+int open_libraries_and_snapshot(lua_State *lua_state)
+{
+    luaL_openlibs(lua_state);
+
+    lua_newtable(lua_state);
+    const int baseline_index = lua_gettop(lua_state);
+
+    // The global table lists itself as _G, so this also snapshots the global table.
+    lua_pushglobaltable(lua_state);
+    const int globals_index = lua_gettop(lua_state);
+    lua_pushnil(lua_state);
+    while (lua_next(lua_state, globals_index) != 0) {
+        if (lua_istable(lua_state, -1)) {
+            snapshot_table(lua_state, baseline_index, lua_gettop(lua_state));
+        }
+        lua_pop(lua_state, 1);
+    }
+    lua_pop(lua_state, 1);
+
+    lua_getfield(lua_state, LUA_REGISTRYINDEX, LUA_LOADED_TABLE);
+    snapshot_table(lua_state, baseline_index, lua_gettop(lua_state));
+    lua_pop(lua_state, 1);
+
+    lua_rawsetp(lua_state, LUA_REGISTRYINDEX, &BASELINE_REGISTRY_KEY);
+    return 0;
+}
+
+/**
+ * @brief Restores all tables stored in the baseline, and removes any metatable set on the global table, run protected.
+ */
+int restore_baseline(lua_State *lua_state)
+{
+    lua_rawgetp(lua_state, LUA_REGISTRYINDEX, &BASELINE_REGISTRY_KEY);
+    const int baseline_index = lua_gettop(lua_state);
+    lua_pushnil(lua_state);
+    while (lua_next(lua_state, baseline_index) != 0) {
+        restore_table(lua_state, lua_gettop(lua_state) - 1, lua_gettop(lua_state));
+        lua_pop(lua_state, 1);
+    }
+
+    lua_pushglobaltable(lua_state);
+    lua_pushnil(lua_state);
+    lua_setmetatable(lua_state, -2);
+    return 0;
+}
+
+/**
+ * @brief Resets a state to its baseline after a script has run.
+ * @return True if the state was reset and may be reused.
+ */
+bool reset_state(lua_State *lua_state)
+{
+    lua_settop(lua_state, 0);
+    lua_gc(lua_state, LUA_GCCOLLECT, 0);
+    lua_pushcfunction(lua_state, &restore_baseline);
+    const bool reset = lua_pcall(lua_state, 0, 0, 0) == LUA_OK;
+    lua_settop(lua_state, 0);
+    lua_gc(lua_state, LUA_GCCOLLECT, 0);
+    return reset;
+}
+} // namespace
+
+LuaStatePool::PooledState::PooledState(const size_t memory_limit_bytes) : allocator(memory_limit_bytes)
+{
+    state = lua_newstate(&LuaArenaAllocator::allocate, &allocator);
+}
+
+LuaStatePool::PooledState::~PooledState()
+{
+    if (state != nullptr) {
+        lua_close(state);
+    }
+}
+
+LuaStatePool::Lease::Lease(LuaStatePool *pool, std::unique_ptr<PooledState> pooled_state)
+    : pool_(pool), pooled_state_(std::move(pooled_state))
+{
+}
+
+LuaStatePool::Lease::~Lease() { release(); }
+
+LuaStatePool::Lease::Lease(Lease &&other) noexcept
+    : pool_(other.pool_), pooled_state_(std::move(other.pooled_state_)), discard_(other.discard_)
+{
+}
+
+LuaStatePool::Lease &LuaStatePool::Lease::operator=(Lease &&other) noexcept
+{
+    if (this != &other) {
+        release();
+        pool_ = other.pool_;
+        pooled_state_ = std::move(other.pooled_state_);
+        discard_ = other.discard_;
+    }
+    return *this;
+}
+
+lua_State *LuaStatePool::Lease::state() const { return pooled_state_ ? pooled_state_->state : nullptr; }
+
+const LuaArenaAllocator *LuaStatePool::Lease::allocator() const
+{
+    return pooled_state_ ? &pooled_state_->allocator : nullptr;
+}
+
+void LuaStatePool::Lease::release()
+{
+    if (pooled_state_ && pool_ != nullptr) {
+        pool_->release(std::move(pooled_state_), discard_);
+    }
+    pooled_state_.reset();
+    discard_ = false;
+}
+
+LuaStatePool::LuaStatePool(const size_t max_idle_states, const size_t memory_limit_bytes)
+    : max_idle_states_(max_idle_states), memory_limit_bytes_(memory_limit_bytes)
+{
+}
+
+LuaStatePool::~LuaStatePool() = default;
+
+LuaStatePool::Lease LuaStatePool::acquire()
+{
+    std::unique_ptr<PooledState> pooled_state;
+    size_t memory_limit_bytes = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        memory_limit_bytes = memory_limit_bytes_;
+        if (!idle_states_.empty()) {
+            pooled_state = std::move(idle_states_.back());
+            idle_states_.pop_back();
+        }
+    }
+
+    if (!pooled_state) {
+        pooled_state = create_state(memory_limit_bytes);
+        if (pooled_state) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            num_states_created_++;
+        }
+    }
+    if (pooled_state) {
+        pooled_state->allocator.set_memory_limit(memory_limit_bytes);
+    }
+    return Lease(this, std::move(pooled_state));
+}
+
+void LuaStatePool::set_memory_limit(const size_t memory_limit_bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    memory_limit_bytes_ = memory_limit_bytes;
+}
+
+size_t LuaStatePool::memory_limit() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return memory_limit_bytes_;
+}
+
+size_t LuaStatePool::num_states_created() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_states_created_;
+}
+
+size_t LuaStatePool::num_idle_states() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return idle_states_.size();
+}
+
+std::unique_ptr<LuaStatePool::PooledState> LuaStatePool::create_state(const size_t memory_limit_bytes)
+{
+    auto pooled_state = std::make_unique<PooledState>(memory_limit_bytes);
+    if (pooled_state->state == nullptr) {
+        return nullptr;
+    }
+    lua_pushcfunction(pooled_state->state, &open_libraries_and_snapshot);
+    if (lua_pcall(pooled_state->state, 0, 0, 0) != LUA_OK) {
+        return nullptr;
+    }
+    return pooled_state;
+}
+
+void LuaStatePool::release(std::unique_ptr<PooledState> pooled_state, const bool discard)
+{
+    if (discard || !reset_state(pooled_state->state)) {
+        return;
+    }
+    // Memory the script used is garbage once the state is reset, so is returned to the system while the state idles.
+    pooled_state->allocator.release_free_chunks();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (idle_states_.size() < max_idle_states_) {
+        idle_states_.push_back(std::move(pooled_state));
+    }
+}
@@ -0,0 +1,122 @@
+// Copyright 2026 Charles Tytler
+
+#pragma once
+
+#include "Utilities/LuaArenaAllocator.h"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+struct lua_State;
+
+/**
+ * @brief Keeps Lua states with the standard libraries already opened, so scripts can be run without creating a new
+ * state each time.
+ *
+ *   Each state allocates through its own LuaArenaAllocator, capped at the pool's memory limit. When a state is returned
+ *   to the pool its stack is cleared and the global table, the standard library tables and package.loaded are restored
+ *   to their contents from when the libraries were opened, so no globals leak from one script into the next. Values
+ *   nested deeper within those tables are not restored. The allocator's free chunks are then released, so an idle
+ *   state holds little more memory than its libraries need.
+ *
+ *   The pool runs its own Lua calls in protected mode, as must users of a lease for any call which may raise an error,
+ *   so errors are returned as results rather than reaching Lua's panic function, which would end the plugin.
+ *
+ *   The pool may be used from multiple threads, each state being used by one thread at a time through its Lease.
+ */
+class LuaStatePool
+{
+    struct PooledState;
+
+  public:
+    static constexpr size_t DEFAULT_MAX_IDLE_STATES = 4;                     // Matches the maximum indexer workers.
+    static constexpr size_t DEFAULT_MEMORY_LIMIT_BYTES = 256 * 1024 * 1024; // Far above any module's clickabledata.
+
+    /**
+     * @brief Exclusive use of a pooled state, which is reset and returned to its pool on destruction.
+     */
+    class Lease
+    {
+      public:
+        Lease(LuaStatePool *pool, std::unique_ptr<PooledState> pooled_state);
+        ~Lease();
+
+        Lease(Lease &&other) noexcept;
+        Lease &operator=(Lease &&other) noexcept;
+        Lease(const Lease &) = delete;
+        Lease &operator=(const Lease &) = delete;
+
+        lua_State *state() const;
+        explicit operator bool() const { return state() != nullptr; }
+
+        /**
+         * @brief Allocator of the state, for inspecting its memory use.
+         */
+        const LuaArenaAllocator *allocator() const;
+
+        /**
+         * @brief Closes the state on release instead of returning it to the pool, e.g. after a script failed.
+         */
+        void discard() { discard_ = true; }
+
+      private:
+        void release();
+
+        LuaStatePool *pool_;
+        std::unique_ptr<PooledState> pooled_state_;
+        bool discard_ = false;
+    };
+
+    /**
+     * @param max_idle_states    Maximum number of states kept for reuse, any further states are closed on release.
+     * @param memory_limit_bytes Maximum memory a state may allocate before a script fails with a memory error.
+     */
+    explicit LuaStatePool(const size_t max_idle_states = DEFAULT_MAX_IDLE_STATES,
+                          const size_t memory_limit_bytes = DEFAULT_MEMORY_LIMIT_BYTES);
+    ~LuaStatePool();
+
+    // Outstanding leases refer back to the pool, so it may not be moved or copied.
+    LuaStatePool(const LuaStatePool &) = delete;
+    LuaStatePool &operator=(const LuaStatePool &) = delete;
+
+    /**
+     * @brief Get a state from the pool, creating a new one only if no idle state is available.
+     * @return Lease of the state, which has no state if a new state could not be created.
+     */
+    Lease acquire();
+
+    /**
+     * @brief Sets the memory limit of states acquired from now on.
+     */
+    void set_memory_limit(const size_t memory_limit_bytes);
+    size_t memory_limit() const;
+
+    /**
+     * @brief Total number of states created by the pool over its lifetime.
+     */
+    size_t num_states_created() const;
+
+    /**
+     * @brief Number of states currently held for reuse.
+     */
+    size_t num_idle_states() const;
+
+  private:
+    struct PooledState {
+        explicit PooledState(const size_t memory_limit_bytes);
+        ~PooledState();
+
+        LuaArenaAllocator allocator; // Declared before the state so it outlives it.
+        lua_State *state = nullptr;
+    };
+
+    static std::unique_ptr<PooledState> create_state(const size_t memory_limit_bytes);
+    void release(std::unique_ptr<PooledState> pooled_state, const bool discard);
+
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<PooledState>> idle_states_;
+    size_t max_idle_states_;
+    size_t memory_limit_bytes_;
+    size_t num_states_created_ = 0;
+};
@@ -0,0 +1,88 @@
+// Copyright 2026 Charles Tytler
+
+#include "MappedFile.h"
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+MappedFile::MappedFile(const std::string &path)
+{
+    file_handle_ = CreateFileA(
+        path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file_handle_ == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("Could not open file for mapping: " + path);
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file_handle_, &file_size)) {
+        CloseHandle(file_handle_);
+        throw std::runtime_error("Could not get size of file: " + path);
+    }
+    size_ = static_cast<size_t>(file_size.QuadPart);
+    if (size_ == 0) {
+        // Empty files cannot be mapped, but are valid to read.
+        return;
+    }
+    mapping_handle_ = CreateFileMappingA(file_handle_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping_handle_ == nullptr) {
+        CloseHandle(file_handle_);
+        throw std::runtime_error("Could not create mapping of file: " + path);
+    }
+    data_ = static_cast<const char *>(MapViewOfFile(mapping_handle_, FILE_MAP_READ, 0, 0, 0));
+    if (data_ == nullptr) {
+        CloseHandle(mapping_handle_);
+        CloseHandle(file_handle_);
+        throw std::runtime_error("Could not map view of file: " + path);
+    }
+}
+
+MappedFile::~MappedFile()
+{
+    if (data_ != nullptr) {
+        UnmapViewOfFile(data_);
+    }
+    if (mapping_handle_ != nullptr) {
+        CloseHandle(mapping_handle_);
+    }
+    CloseHandle(file_handle_);
+}
+#else
+MappedFile::MappedFile(const std::string &path)
+{
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Could not open file for mapping: " + path);
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+        close(fd);
+        throw std::runtime_error("Could not get size of file: " + path);
+    }
+    size_ = static_cast<size_t>(file_stat.st_size);
+    if (size_ > 0) {
+        void *mapping = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            close(fd);
+            throw std::runtime_error("Could not map file: " + path);
+        }
+        data_ = static_cast<const char *>(mapping);
+    }
+    // The mapping remains valid after the file descriptor is closed.
+    close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if (data_ != nullptr) {
+        munmap(const_cast<char *>(data_), size_);
+    }
+}
+#endif
@@ -0,0 +1,41 @@
+// Copyright 2026 Charles Tytler
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @brief Read-only memory mapping of a whole file.
+ *
+ *   The file contents are paged in by the operating system on access rather than read up-front, so large files can be
+ *   used without copying them into memory.
+ */
+class MappedFile
+{
+  public:
+    /**
+     * @brief Maps the file into memory.
+     * @throws std::runtime_error if the file cannot be opened or mapped.
+     */
+    explicit MappedFile(const std::string &path);
+    ~MappedFile();
+
+    // The mapping is released on destruction, so it may not be copied.
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /**
+     * @brief Start of the mapped file contents, valid for the lifetime of the object (nullptr for an empty file).
+     */
+    const char *data() const { return data_; }
+    size_t size() const { return size_; }
+
+  private:
+    const char *data_ = nullptr;
+    size_t size_ = 0;
+#ifdef _WIN32
+    void *file_handle_ = nullptr;
+    void *mapping_handle_ = nullptr;
+#endif
+};
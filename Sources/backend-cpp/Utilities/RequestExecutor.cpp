@@ -0,0 +1,137 @@
+// Copyright 2026 Charles Tytler
+
+#include "RequestExecutor.h"
+
+#include <algorithm>
+
+RequestExecutor::RequestExecutor(const size_t num_workers)
+{
+    for (size_t i = 0; i < std::max<size_t>(num_workers, 1); i++) {
+        workers_.emplace_back(&RequestExecutor::run_worker, this);
+    }
+}
+
+RequestExecutor::~RequestExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        is_stopping_ = true;
+        for (auto &[key, request] : requests_in_flight_) {
+            request->is_cancelled = true;
+        }
+        queue_.clear();
+    }
+    work_available_.notify_all();
+    for (auto &worker : workers_) {
+        worker.join();
+    }
+}
+
+bool RequestExecutor::submit(const std::string &group, const std::string &key, Task task, Completion on_complete)
+{
+    bool is_queued = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (is_stopping_) {
+            return false;
+        }
+        auto &request = requests_in_flight_[key];
+        if (!request) {
+            request = std::make_shared<Request>();
+            request->key = key;
+            request->task = std::move(task);
+            queue_.push_back(request);
+            is_queued = true;
+        }
+        request->waiters.emplace_back(group, std::move(on_complete));
+        if (!group.empty()) {
+            supersede(group, request.get());
+        }
+    }
+    if (is_queued) {
+        work_available_.notify_one();
+    }
+    return is_queued;
+}
+
+void RequestExecutor::cancel_group(const std::string &group)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    supersede(group, nullptr);
+    idle_.notify_all();
+}
+
+void RequestExecutor::wait_until_idle()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this]() { return queue_.empty() && num_running_ == 0; });
+}
+
+void RequestExecutor::supersede(const std::string &group, const Request *kept_request)
+{
+    for (auto it = requests_in_flight_.begin(); it != requests_in_flight_.end();) {
+        auto &request = it->second;
+        if (request.get() == kept_request) {
+            ++it;
+            continue;
+        }
+        auto &waiters = request->waiters;
+        waiters.erase(std::remove_if(waiters.begin(),
+                                     waiters.end(),
+                                     [&group](const auto &waiter) { return waiter.first == group; }),
+                      waiters.end());
+        if (!waiters.empty()) {
+            ++it;
+            continue;
+        }
+        // No group wants the result any more. A running request is flagged, and removed by its worker when it ends.
+        request->is_cancelled = true;
+        queue_.erase(std::remove(queue_.begin(), queue_.end(), request), queue_.end());
+        it = requests_in_flight_.erase(it);
+    }
+}
+
+void RequestExecutor::run_worker()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        work_available_.wait(lock, [this]() { return is_stopping_ || !queue_.empty(); });
+        if (is_stopping_) {
+            return;
+        }
+        const std::shared_ptr<Request> request = queue_.front();
+        queue_.pop_front();
+        num_running_++;
+
+        lock.unlock();
+        json result;
+        try {
+            result = request->task(request->is_cancelled);
+        } catch (const std::exception &e) {
+            result = json({{"result", std::string("Request failed: ") + e.what()}});
+        }
+        lock.lock();
+
+        // Requests with the same key submitted from now on run the task again, as its result may have changed.
+        const auto in_flight = requests_in_flight_.find(request->key);
+        if (in_flight != requests_in_flight_.end() && in_flight->second == request) {
+            requests_in_flight_.erase(in_flight);
+        }
+        const auto waiters = std::move(request->waiters);
+        const bool is_cancelled = request->is_cancelled;
+        lock.unlock();
+        if (!is_cancelled) {
+            for (const auto &[group, on_complete] : waiters) {
+                if (on_complete) {
+                    on_complete(result);
+                }
+            }
+        }
+        lock.lock();
+
+        num_running_--;
+        if (queue_.empty() && num_running_ == 0) {
+            idle_.notify_all();
+        }
+    }
+}
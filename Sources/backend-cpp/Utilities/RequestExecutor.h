@@ -0,0 +1,95 @@
+// Copyright 2026 Charles Tytler
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+using json = nlohmann::json;
+
+/**
+ * @brief Runs requests on background worker threads, for work too slow to run on the thread receiving the requests
+ * (e.g. extracting clickabledata or scanning directories).
+ *
+ *   Each request has a key naming the result it computes, and is submitted on behalf of a group of requests which
+ *   supersede one another (e.g. the ID lookups of one Property Inspector):
+ *     - A request with the same key as one queued or running is not run again; it receives the result of the request
+ *       already in flight.
+ *     - A request supersedes the earlier requests of its group with other keys. Their results are no longer wanted by
+ *       the group, and requests no longer wanted by any group are cancelled: removed from the queue if they have not
+ *       started, or else flagged so the task may stop early, with its result discarded.
+ */
+class RequestExecutor
+{
+  public:
+    using Task = std::function<json(const std::atomic<bool> &is_cancelled)>;
+    using Completion = std::function<void(const json &result)>;
+
+    static constexpr size_t DEFAULT_NUM_WORKERS = 2;
+
+    explicit RequestExecutor(const size_t num_workers = DEFAULT_NUM_WORKERS);
+
+    /**
+     * @brief Cancels queued requests and waits for running requests to finish, without calling their completions.
+     */
+    ~RequestExecutor();
+
+    RequestExecutor(const RequestExecutor &) = delete;
+    RequestExecutor &operator=(const RequestExecutor &) = delete;
+
+    /**
+     * @brief Submits a request to be run in the background.
+     *
+     * @param group       Group of requests superseded by this one, or empty to supersede no requests.
+     * @param key         Key naming the result of the task, so requests with the same key share one run of the task.
+     * @param task        Task computing the result, called from a worker thread unless a request with the same key is
+     *                    already in flight.
+     * @param on_complete Called from a worker thread with the result, unless the request is superseded first.
+     * @return True if the task was queued, or false if the request shares the result of a request in flight.
+     */
+    bool submit(const std::string &group, const std::string &key, Task task, Completion on_complete);
+
+    /**
+     * @brief Cancels all requests of the group, such as when the Property Inspector making them is closed.
+     */
+    void cancel_group(const std::string &group);
+
+    /**
+     * @brief Waits until no requests are queued or running.
+     */
+    void wait_until_idle();
+
+  private:
+    struct Request {
+        std::string key;
+        Task task;
+        std::vector<std::pair<std::string, Completion>> waiters; // Group and completion of each request for the key.
+        std::atomic<bool> is_cancelled{false};
+    };
+
+    /**
+     * @brief Removes the group's waiters from requests other than the kept request, cancelling requests left without
+     *        waiters. Must be called with the mutex held.
+     */
+    void supersede(const std::string &group, const Request *kept_request);
+    void run_worker();
+
+    std::mutex mutex_;
+    std::condition_variable work_available_;
+    std::condition_variable idle_;
+    std::deque<std::shared_ptr<Request>> queue_;
+    std::unordered_map<std::string, std::shared_ptr<Request>> requests_in_flight_; // By key, queued or running.
+    size_t num_running_ = 0;
+    bool is_stopping_ = false;
+    std::vector<std::thread> workers_;
+};
@@ -0,0 +1,212 @@
+// Copyright 2026 Charles Tytler
+
+#include "SearchIndex.h"
+
+#include <algorithm>
+#include <cctype>
+#include <numeric>
+
+namespace
+{
+// Ranks of how a term matches within a field, multiplied by the weight of the field.
+constexpr unsigned MATCH_WITHIN_WORD = 1;
+constexpr unsigned MATCH_WORD_START = 2;
+constexpr unsigned MATCH_WHOLE_WORD = 4;
+constexpr unsigned MATCH_WHOLE_FIELD = 8;
+
+// Terms shorter than this are only matched at the start of a word.
+constexpr size_t TRIGRAM_LENGTH = 3;
+
+bool is_word_character(const char c)
+{
+    const auto byte = static_cast<unsigned char>(c);
+    // Bytes of multibyte UTF-8 characters are kept within words.
+    return byte >= 0x80 || std::isalnum(byte);
+}
+
+std::string to_lowercase(std::string text)
+{
+    for (char &c : text) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return text;
+}
+
+std::vector<std::string> split_words(const std::string &text)
+{
+    std::vector<std::string> words;
+    size_t start = 0;
+    while (start < text.size()) {
+        while (start < text.size() && !is_word_character(text[start])) {
+            start++;
+        }
+        size_t end = start;
+        while (end < text.size() && is_word_character(text[end])) {
+            end++;
+        }
+        if (end > start) {
+            words.push_back(text.substr(start, end - start));
+        }
+        start = end;
+    }
+    return words;
+}
+
+uint32_t trigram_at(const std::string &text, const size_t position)
+{
+    return (static_cast<uint32_t>(static_cast<unsigned char>(text[position])) << 16) |
+           (static_cast<uint32_t>(static_cast<unsigned char>(text[position + 1])) << 8) |
+           static_cast<uint32_t>(static_cast<unsigned char>(text[position + 2]));
+}
+
+std::vector<uint32_t> intersect(const std::vector<uint32_t> &sorted_a, const std::vector<uint32_t> &sorted_b)
+{
+    std::vector<uint32_t> intersection;
+    std::set_intersection(
+        sorted_a.begin(), sorted_a.end(), sorted_b.begin(), sorted_b.end(), std::back_inserter(intersection));
+    return intersection;
+}
+} // namespace
+
+SearchIndex::SearchIndex(json items, const std::vector<std::string> &fields)
+    : items_(items.is_array() ? std::move(items) : json::array())
+{
+    fields_.reserve(items_.size());
+    for (uint32_t item = 0; item < items_.size(); item++) {
+        auto &item_fields = fields_.emplace_back();
+        for (const auto &field : fields) {
+            const auto value = items_[item].is_object() ? items_[item].find(field) : items_[item].end();
+            std::string text;
+            if (value != items_[item].end() && value->is_string()) {
+                text = to_lowercase(value->get<std::string>());
+            } else if (value != items_[item].end() && value->is_number()) {
+                text = value->dump();
+            }
+
+            for (size_t position = 0; position + TRIGRAM_LENGTH <= text.size(); position++) {
+                auto &trigram_items = items_by_trigram_[trigram_at(text, position)];
+                if (trigram_items.empty() || trigram_items.back() != item) {
+                    trigram_items.push_back(item);
+                }
+            }
+            for (auto &word : split_words(text)) {
+                words_.emplace_back(std::move(word), item);
+            }
+            item_fields.push_back(std::move(text));
+        }
+    }
+    std::sort(words_.begin(), words_.end());
+    words_.erase(std::unique(words_.begin(), words_.end()), words_.end());
+}
+
+std::vector<size_t> SearchIndex::search(const std::string &query) const
+{
+    const std::vector<std::string> terms = split_words(to_lowercase(query));
+    if (terms.empty()) {
+        std::vector<size_t> all_items(items_.size());
+        std::iota(all_items.begin(), all_items.end(), 0);
+        return all_items;
+    }
+
+    std::vector<uint32_t> matching_items = candidates(terms.front());
+    for (size_t i = 1; i < terms.size() && !matching_items.empty(); i++) {
+        matching_items = intersect(matching_items, candidates(terms[i]));
+    }
+
+    std::vector<std::pair<unsigned, size_t>> scored_items;
+    for (const uint32_t item : matching_items) {
+        unsigned total_score = 0;
+        for (const auto &term : terms) {
+            const unsigned term_score = score(item, term);
+            if (term_score == 0) {
+                total_score = 0;
+                break;
+            }
+            total_score += term_score;
+        }
+        if (total_score > 0) {
+            scored_items.emplace_back(total_score, item);
+        }
+    }
+    // Items are in array order, which a stable sort keeps among equal scores.
+    std::stable_sort(scored_items.begin(), scored_items.end(), [](const auto &lhs, const auto &rhs) {
+        return lhs.first > rhs.first;
+    });
+
+    std::vector<size_t> ranked_items;
+    ranked_items.reserve(scored_items.size());
+    for (const auto &[item_score, item] : scored_items) {
+        ranked_items.push_back(item);
+    }
+    return ranked_items;
+}
+
+json SearchIndex::page(const std::string &query, const size_t offset, const size_t limit) const
+{
+    const std::vector<size_t> ranked_items = search(query);
+    json page_items = json::array();
+    const size_t end = offset + std::min(limit, MAX_PAGE_SIZE);
+    for (size_t i = offset; i < end && i < ranked_items.size(); i++) {
+        page_items.push_back(items_[ranked_items[i]]);
+    }
+    return json({{"total", ranked_items.size()}, {"offset", offset}, {"items", page_items}});
+}
+
+unsigned SearchIndex::score(const size_t item, const std::string &term) const
+{
+    const auto &item_fields = fields_[item];
+    unsigned best_score = 0;
+    for (size_t i = 0; i < item_fields.size(); i++) {
+        const std::string &field = item_fields[i];
+        const auto field_weight = static_cast<unsigned>(item_fields.size() - i);
+        unsigned match = 0;
+        for (size_t position = field.find(term); position != std::string::npos && match < MATCH_WHOLE_FIELD;
+             position = field.find(term, position + 1)) {
+            const size_t end = position + term.size();
+            const bool starts_word = position == 0 || !is_word_character(field[position - 1]);
+            const bool ends_word = end == field.size() || !is_word_character(field[end]);
+            if (position == 0 && end == field.size()) {
+                match = MATCH_WHOLE_FIELD;
+            } else if (starts_word) {
+                match = std::max(match, ends_word ? MATCH_WHOLE_WORD : MATCH_WORD_START);
+            } else if (term.size() >= TRIGRAM_LENGTH) {
+                match = std::max(match, MATCH_WITHIN_WORD);
+            }
+        }
+        best_score = std::max(best_score, match * field_weight);
+    }
+    return best_score;
+}
+
+std::vector<uint32_t> SearchIndex::candidates(const std::string &term) const
+{
+    if (term.size() < TRIGRAM_LENGTH) {
+        std::vector<uint32_t> items;
+        for (auto it = std::lower_bound(words_.begin(), words_.end(), std::make_pair(term, uint32_t{0}));
+             it != words_.end() && it->first.compare(0, term.size(), term) == 0;
+             ++it) {
+            items.push_back(it->second);
+        }
+        std::sort(items.begin(), items.end());
+        items.erase(std::unique(items.begin(), items.end()), items.end());
+        return items;
+    }
+
+    // Intersect the items of each trigram of the term, starting from the rarest trigram.
+    std::vector<const std::vector<uint32_t> *> trigram_items;
+    for (size_t position = 0; position + TRIGRAM_LENGTH <= term.size(); position++) {
+        const auto found = items_by_trigram_.find(trigram_at(term, position));
+        if (found == items_by_trigram_.end()) {
+            return {};
+        }
+        trigram_items.push_back(&found->second);
+    }
+    std::sort(trigram_items.begin(), trigram_items.end(), [](const auto *lhs, const auto *rhs) {
+        return lhs->size() < rhs->size();
+    });
+    std::vector<uint32_t> items = *trigram_items.front();
+    for (size_t i = 1; i < trigram_items.size() && !items.empty(); i++) {
+        items = intersect(items, *trigram_items[i]);
+    }
+    return items;
+}
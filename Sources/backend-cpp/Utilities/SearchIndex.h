@@ -0,0 +1,69 @@
+// Copyright 2026 Charles Tytler
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+using json = nlohmann::json;
+
+/**
+ * @brief Ranked text search over the items of a json array, such as the controls of a control reference.
+ *
+ *   A query is split into terms at every character that is not a letter or digit, and an item matches when each term
+ *   is found, ignoring case, in one of its searched fields. Terms of three or more characters may match anywhere within
+ *   a field and are looked up in an index of field trigrams; shorter terms must match the start of a word and are
+ *   looked up in a sorted index of words.
+ *
+ *   Matches are ranked by how well each term matches (a whole word, the start of a word, or within a word) and by the
+ *   weight of the field it matches in. The index is not modified after construction, so it may be searched from
+ *   multiple threads.
+ */
+class SearchIndex
+{
+  public:
+    static constexpr size_t DEFAULT_PAGE_SIZE = 50;
+    static constexpr size_t MAX_PAGE_SIZE = 500;
+
+    /**
+     * @param items Json array of objects to search.
+     * @param fields Names of the fields of each item to search, in decreasing order of weight. String and number
+     *               values are searched, other values are ignored.
+     */
+    SearchIndex(json items, const std::vector<std::string> &fields);
+
+    size_t num_items() const { return items_.size(); }
+
+    /**
+     * @brief Get the positions of matching items in the array, best match first.
+     *        An empty query matches every item, in array order.
+     */
+    std::vector<size_t> search(const std::string &query) const;
+
+    /**
+     * @brief Get a page of matching items, best match first.
+     * @param limit Maximum number of items in the page, no more than MAX_PAGE_SIZE.
+     * @return Json object holding the "total" number of matches, the "offset" of the page and its "items".
+     */
+    json page(const std::string &query, const size_t offset, const size_t limit) const;
+
+  private:
+    /**
+     * @brief Score of how well the term matches the item, or 0 if it does not match any searched field.
+     */
+    unsigned score(const size_t item, const std::string &term) const;
+
+    /**
+     * @brief Get the items which may contain the term, in ascending order.
+     */
+    std::vector<uint32_t> candidates(const std::string &term) const;
+
+    json items_;
+    std::vector<std::vector<std::string>> fields_; // Lowercase searched fields of each item.
+    std::unordered_map<uint32_t, std::vector<uint32_t>> items_by_trigram_;
+    std::vector<std::pair<std::string, uint32_t>> words_; // Lowercase words of searched fields and their items, sorted.
+};
@@ -46,6 +46,15 @@ std::optional<std::pair<std::string, std::string>> split_pair(const std::string
     return std::nullopt;
 }
 
+std::optional<std::pair<std::string_view, std::string_view>> split_pair_view(std::string_view str, const char delim)
+{
+    const auto delim_loc = str.find(delim);
+    if (delim_loc != std::string_view::npos && delim_loc > 0) {
+        return std::make_pair(str.substr(0, delim_loc), str.substr(delim_loc + 1));
+    }
+    return std::nullopt;
+}
+
 std::optional<std::pair<std::string, std::string>>
 pop_key_and_value(std::stringstream &ss, const char token_delim, const char key_value_delim)
 {
@@ -56,3 +65,15 @@ pop_key_and_value(std::stringstream &ss, const char token_delim, const char key_
     }
     return std::nullopt;
 }
+
+std::optional<std::pair<std::string_view, std::string_view>>
+pop_key_and_value(std::string_view &remaining, const char token_delim, const char key_value_delim)
+{
+    if (remaining.empty()) {
+        return std::nullopt;
+    }
+    const auto token_end = remaining.find(token_delim);
+    const std::string_view token = remaining.substr(0, token_end);
+    remaining = (token_end != std::string_view::npos) ? remaining.substr(token_end + 1) : std::string_view();
+    return split_pair_view(token, key_value_delim);
+}
@@ -5,6 +5,7 @@
 #include <optional>
 #include <sstream>
 #include <string>
+#include <string_view>
 
 /**
  * @brief Helper function to identify if a string represents an integer.
@@ -28,6 +29,15 @@ bool is_number(const std::string &str);
  */
 std::optional<std::pair<std::string, std::string>> split_pair(const std::string &str, const char delim);
 
+/**
+ * @brief Splits a string into a pair of views into it given a delimiter character, without copying.
+ *
+ * @param str [in] String containing two substrings separated by a delimiter.
+ * @param key_value_delim [in] Delimiter separating two substrings.
+ * @return Optional: Pair if it was found, nullopt if delimiter split was unsuccessful.
+ */
+std::optional<std::pair<std::string_view, std::string_view>> split_pair_view(std::string_view str, const char delim);
+
 /**
  * @brief Get the next key and value pair from a delimited stringstream.
  *    Example stringstream using token_delim(,) and key_value_delim(:):
@@ -40,3 +50,14 @@ std::optional<std::pair<std::string, std::string>> split_pair(const std::string
  */
 std::optional<std::pair<std::string, std::string>>
 pop_key_and_value(std::stringstream &ss, const char token_delim, const char key_value_delim);
+
+/**
+ * @brief Get the next key and value pair from a delimited string without copying, advancing past it.
+ *
+ * @param remaining [in,out]   Remaining delimited string.
+ * @param token_delim [in]     Delimiter separating key-value pairs.
+ * @param key_value_delim [in] Delimiter separating key from value.
+ * @return Optional: Views of the key-value pair if it was found, nullopt if no remaining key-value pairs in string.
+ */
+std::optional<std::pair<std::string_view, std::string_view>>
+pop_key_and_value(std::string_view &remaining, const char token_delim, const char key_value_delim);
@@ -1,13 +1,44 @@
 // Copyright 2020 Charles Tytler
 
-#pragma comment(lib, "Ws2_32.lib")
-
 #include "UdpSocket.h"
 
-#include <WS2tcpip.h>
+#include <cstring>
+#include <stdexcept>
 
+#ifdef _WIN32
+#pragma comment(lib, "Ws2_32.lib")
+#include <WS2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <cerrno>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/time.h>
+#include <unistd.h>
+#define closesocket close
+#endif
+
+namespace
+{
 // Set default timeout for socket.
-DWORD socket_timeout_ms = 1;
+constexpr int socket_timeout_ms = 1;
+
+int last_socket_error()
+{
+#ifdef _WIN32
+    return WSAGetLastError();
+#else
+    return errno;
+#endif
+}
+
+void cleanup_socket_library()
+{
+#ifdef _WIN32
+    WSACleanup();
+#endif
+}
+} // namespace
 
 UdpSocket::UdpSocket(const std::string &ip_address,
                      const std::string &rx_port,
@@ -21,6 +52,7 @@ UdpSocket::UdpSocket(const std::string &ip_address,
         throw std::runtime_error(error_msg);
     }
 
+#ifdef _WIN32
     // Initialize Windows Sockets DLL to version 2.2.
     WSADATA wsaData;
     const auto err = WSAStartup(MAKEWORD(2, 2), &wsaData);
@@ -29,6 +61,7 @@ UdpSocket::UdpSocket(const std::string &ip_address,
             "Could not startup Windows socket library -- WSA Error: " + std::to_string(WSAGetLastError());
         throw std::runtime_error(error_msg);
     }
+#endif
 
     // Define socket address info settings for UDP protocol.
     addrinfo hints;
@@ -44,23 +77,26 @@ UdpSocket::UdpSocket(const std::string &ip_address,
     if (result != 0) {
         const std::string error_msg = "Could not get valid address info from requested IP: " + ip_address +
                                       " Rx_Port: " + rx_port + " Tx_Port: " + tx_port +
-                                      " -- WSA Error: " + std::to_string(WSAGetLastError());
-        WSACleanup();
+                                      " -- Socket Error: " + std::to_string(last_socket_error());
+        cleanup_socket_library();
         throw std::runtime_error(error_msg);
     }
 
     socket_id_ = socket(local_port->ai_family, local_port->ai_socktype, local_port->ai_protocol);
 
     // Socket options: allow reuse of address, and set timeout.
-    const u_int yes = 1;
+    const int yes = 1;
+#ifdef _WIN32
+    const DWORD timeout = socket_timeout_ms;
+#else
+    const timeval timeout{0, socket_timeout_ms * 1000};
+#endif
     result = setsockopt(socket_id_, SOL_SOCKET, SO_REUSEADDR, (const char *)&yes, sizeof(yes));
-    result =
-        result ||
-        setsockopt(socket_id_, SOL_SOCKET, SO_RCVTIMEO, (const char *)&socket_timeout_ms, sizeof(socket_timeout_ms));
+    result = result || setsockopt(socket_id_, SOL_SOCKET, SO_RCVTIMEO, (const char *)&timeout, sizeof(timeout));
     if (result != 0) {
         const std::string error_msg =
-            "Failure in setting socket options -- WSA Error: " + std::to_string(WSAGetLastError());
-        WSACleanup();
+            "Failure in setting socket options -- Socket Error: " + std::to_string(last_socket_error());
+        cleanup_socket_library();
         throw std::runtime_error(error_msg);
     }
 
@@ -69,22 +105,27 @@ UdpSocket::UdpSocket(const std::string &ip_address,
     freeaddrinfo(local_port);
     if (result != 0) {
         const std::string error_msg =
-            "Could not bind UDP address to socket -- WSA Error: " + std::to_string(WSAGetLastError());
+            "Could not bind UDP address to socket -- Socket Error: " + std::to_string(last_socket_error());
         closesocket(socket_id_);
-        WSACleanup();
+        cleanup_socket_library();
         throw std::runtime_error(error_msg);
     }
 
     if (!multicast_addr.empty()) {
         ip_mreq mreq;
+#ifdef _WIN32
         const std::wstring multicast_addr_L = std::wstring(multicast_addr.begin(), multicast_addr.end());
         InetPton(AF_INET, multicast_addr_L.c_str(), &mreq.imr_multiaddr.s_addr);
+#else
+        inet_pton(AF_INET, multicast_addr.c_str(), &mreq.imr_multiaddr.s_addr);
+#endif
         mreq.imr_interface.s_addr = htonl(std::stoi(receive_ip_address));
         result = setsockopt(socket_id_, IPPROTO_IP, IP_ADD_MEMBERSHIP, (char *)&mreq, sizeof(mreq));
         if (result != 0) {
-            const std::string error_msg = "Failure in setting Multicast membership in socket options -- WSA Error: " +
-                                          std::to_string(WSAGetLastError());
-            WSACleanup();
+            const std::string error_msg =
+                "Failure in setting Multicast membership in socket options -- Socket Error: " +
+                std::to_string(last_socket_error());
+            cleanup_socket_library();
             throw std::runtime_error(error_msg);
         }
     }
@@ -103,34 +144,45 @@ UdpSocket::~UdpSocket()
 {
     // Delete opened socket.
     closesocket(socket_id_);
-    WSACleanup();
+    cleanup_socket_library();
 }
 
 int UdpSocket::receive_bytes(char *buffer, const int buffer_size)
 {
     // Sender address - dummy variable as it is unused outside recvfrom.
     sockaddr sender_addr;
-    int sender_addr_size = sizeof(sender_addr);
 
     // Receive next UDP message.
-    int num_bytes_receieved = recvfrom(socket_id_, buffer, buffer_size, 0, &sender_addr, &sender_addr_size);
+#ifdef _WIN32
+    int sender_addr_size = sizeof(sender_addr);
+#else
+    socklen_t sender_addr_size = sizeof(sender_addr);
+#endif
+    const int num_bytes_receieved =
+        static_cast<int>(recvfrom(socket_id_, buffer, buffer_size, 0, &sender_addr, &sender_addr_size));
 
     if (dest_addr_len_ == 0) {
         dest_addr_ = sender_addr;
-        dest_addr_len_ = sender_addr_size;
+        dest_addr_len_ = static_cast<int>(sender_addr_size);
     }
 
     return num_bytes_receieved;
 }
 
+DatagramBufferPool::Buffer UdpSocket::receive_datagram()
+{
+    auto buffer = receive_buffer_pool_.acquire();
+    const int num_bytes_received = receive_bytes(buffer.data(), buffer.capacity());
+    buffer.set_size(num_bytes_received > 0 ? num_bytes_received : 0);
+    return buffer;
+}
+
 std::stringstream UdpSocket::receive_stream()
 {
-    constexpr int MAX_UDP_MSG_SIZE = 1024; // Maximum UDP buffer size to read.
-    char msg[MAX_UDP_MSG_SIZE] = {0};
-    (void)receive_bytes(msg, MAX_UDP_MSG_SIZE);
+    const auto datagram = receive_datagram();
 
     std::stringstream ss;
-    ss << msg;
+    ss.write(datagram.data(), datagram.size());
     return ss;
 }
 
@@ -2,8 +2,16 @@
 
 #pragma once
 
+#include "Utilities/DatagramBufferPool.h"
+
 #include <sstream>
+
+#ifdef _WIN32
 #include <winsock2.h>
+#else
+#include <sys/socket.h>
+#define SOCKET_ERROR (-1) // Returned on failure to receive or send, as with Windows sockets.
+#endif
 
 class UdpSocket
 {
@@ -41,6 +49,12 @@ class UdpSocket
      */
     int receive_bytes(char *buffer, const int buffer_size);
 
+    /**
+     * @brief Reads the next UDP datagram into a pooled buffer large enough to hold any datagram.
+     * @return Buffer holding the received datagram, with a size of 0 if nothing was received.
+     */
+    DatagramBufferPool::Buffer receive_datagram();
+
     /**
      * @brief Reads the UDP buffer returning data in a string stream.
      * @return String stream of received messages.
@@ -60,7 +74,13 @@ class UdpSocket
     int send_string(const std::string &message);
 
   private:
-    SOCKET socket_id_;      // Socket which is binded to the rx port.
+#ifdef _WIN32
+    SOCKET socket_id_; // Socket which is binded to the rx port.
+#else
+    int socket_id_; // Socket which is binded to the rx port.
+#endif
     sockaddr dest_addr_;    // UDP address info for port which will be transmitted to.
     int dest_addr_len_ = 0; // Size of dest address.
+
+    DatagramBufferPool receive_buffer_pool_; // Reusable buffers for received datagrams.
 };
@@ -0,0 +1,60 @@
+// Copyright 2026 Charles Tytler
+
+#include "benchmark/benchmark.h"
+
+#include "Utilities/Decimal.h"
+
+#include <string>
+#include <vector>
+
+namespace bench
+{
+
+// Values in the formats received from ExportScript and DCS-BIOS exports.
+const std::vector<std::string> decimal_strings = {"0", "1", "-1", "0.25", "0.7500", "123.456", "-0.0010", "65535"};
+
+static void Decimal_Parse(benchmark::State &state)
+{
+    size_t i = 0;
+    for (auto _ : state) {
+        Decimal value(decimal_strings[i++ % decimal_strings.size()]);
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(Decimal_Parse);
+
+static void Decimal_Format(benchmark::State &state)
+{
+    std::vector<Decimal> values;
+    for (const auto &str : decimal_strings) {
+        values.emplace_back(str);
+    }
+    size_t i = 0;
+    for (auto _ : state) {
+        const std::string str = values[i++ % values.size()].str();
+        benchmark::DoNotOptimize(str.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(Decimal_Format);
+
+static void Decimal_Arithmetic(benchmark::State &state)
+{
+    // Typical increment action update: step, wrap against limits and compare.
+    const Decimal step("0.05");
+    const Decimal min("0");
+    const Decimal max("1.0");
+    Decimal value("0.5");
+    for (auto _ : state) {
+        value += step;
+        if (value > max) {
+            value = value - max + min;
+        }
+        benchmark::DoNotOptimize(value * Decimal(2));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(Decimal_Arithmetic);
+
+} // namespace bench
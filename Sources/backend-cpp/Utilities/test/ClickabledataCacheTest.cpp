@@ -0,0 +1,161 @@
+// Copyright 2026 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "Utilities/ClickabledataCache.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
+namespace test
+{
+class ClickabledataCacheTest : public ::testing::Test
+{
+  protected:
+    ClickabledataCacheTest()
+    {
+        std::filesystem::remove_all(root);
+        std::filesystem::create_directories(cockpit_path / "Scripts");
+        write_file(cockpit_path / "Scripts" / "clickabledata.lua", "elements = {}");
+        write_file(cockpit_path / "Scripts" / "devices.lua", "devices = {}");
+        write_file(lua_script, "return");
+    }
+
+    ~ClickabledataCacheTest() { std::filesystem::remove_all(root); }
+
+    static void write_file(const std::filesystem::path &path, const std::string &contents)
+    {
+        std::ofstream(path) << contents;
+    }
+
+    ClickabledataCache::Extractor counting_extractor()
+    {
+        return [this](const std::string &, const std::string &module_name, const std::string &) {
+            num_extractions++;
+            return json({{"clickabledata_items", json::array({module_name + std::to_string(num_extractions)})},
+                         {"result", "success"}});
+        };
+    }
+
+    const std::filesystem::path root = "clickabledata_cache_test";
+    const std::string dcs_path = (root / "DCS").string();
+    const std::filesystem::path cockpit_path = root / "DCS" / "Mods" / "aircraft" / "A-10C" / "Cockpit";
+    const std::string lua_script = (root / "extract.lua").string();
+    const std::string cache_directory = (root / "cache").string();
+    int num_extractions = 0;
+};
+
+TEST_F(ClickabledataCacheTest, extraction_is_cached)
+{
+    ClickabledataCache cache(cache_directory, counting_extractor());
+    const json first = cache.get_clickabledata(dcs_path, "A-10C", lua_script);
+    const json second = cache.get_clickabledata(dcs_path, "A-10C", lua_script);
+    EXPECT_EQ(1, num_extractions);
+    EXPECT_EQ("success", second["result"]);
+    EXPECT_EQ(json::array({"A-10C1"}), second["clickabledata_items"]);
+    EXPECT_EQ(first, second);
+}
+
+TEST_F(ClickabledataCacheTest, cache_persists_on_disk)
+{
+    {
+        ClickabledataCache cache(cache_directory, counting_extractor());
+        cache.get_clickabledata(dcs_path, "A-10C", lua_script);
+    }
+    ClickabledataCache reopened_cache(cache_directory, counting_extractor());
+    const json result = reopened_cache.get_clickabledata(dcs_path, "A-10C", lua_script);
+    EXPECT_EQ(1, num_extractions);
+    EXPECT_EQ(json::array({"A-10C1"}), result["clickabledata_items"]);
+}
+
+TEST_F(ClickabledataCacheTest, least_recently_used_entry_beyond_memory_limit_is_only_on_disk)
+{
+    ClickabledataCache cache(cache_directory, counting_extractor());
+    const int num_modules = static_cast<int>(ClickabledataCache::MAX_ENTRIES_IN_MEMORY) + 1;
+    for (int i = 0; i < num_modules; i++) {
+        const std::string module = "Module" + std::to_string(i);
+        const auto module_cockpit_path = root / "DCS" / "Mods" / "aircraft" / module / "Cockpit";
+        std::filesystem::create_directories(module_cockpit_path);
+        write_file(module_cockpit_path / "clickabledata.lua", "elements = {}");
+        cache.get_clickabledata(dcs_path, module, lua_script);
+        if (i == num_modules - 2) {
+            // Used again before the last module is added, so Module1 is the least recently used.
+            cache.get_clickabledata(dcs_path, "Module0", lua_script);
+        }
+    }
+    EXPECT_EQ(num_modules, num_extractions);
+
+    // Only the least recently used entry was dropped from memory when the last was added.
+    std::filesystem::remove_all(cache_directory);
+    cache.get_clickabledata(dcs_path, "Module" + std::to_string(num_modules - 1), lua_script);
+    cache.get_clickabledata(dcs_path, "Module0", lua_script);
+    cache.get_clickabledata(dcs_path, "Module2", lua_script);
+    EXPECT_EQ(num_modules, num_extractions);
+    cache.get_clickabledata(dcs_path, "Module1", lua_script);
+    EXPECT_EQ(num_modules + 1, num_extractions);
+}
+
+TEST_F(ClickabledataCacheTest, fingerprint_of_entry_in_memory_is_checked_after_interval)
+{
+    ClickabledataCache cache(cache_directory, counting_extractor());
+    cache.get_clickabledata(dcs_path, "A-10C", lua_script);
+
+    // Within the interval the entry in memory is served without walking the module's folder.
+    write_file(cockpit_path / "Scripts" / "devices.lua", "devices = {UFC = 1}");
+    EXPECT_EQ(json::array({"A-10C1"}), cache.get_clickabledata(dcs_path, "A-10C", lua_script)["clickabledata_items"]);
+    EXPECT_EQ(1, num_extractions);
+
+    ClickabledataCache unchecked_cache(cache_directory, counting_extractor(), std::chrono::milliseconds(0));
+    unchecked_cache.get_clickabledata(dcs_path, "A-10C", lua_script);
+    EXPECT_EQ(2, num_extractions);
+}
+
+TEST_F(ClickabledataCacheTest, module_update_invalidates_cache)
+{
+    // Fingerprints are checked on every request, as once the interval has passed.
+    ClickabledataCache cache(cache_directory, counting_extractor(), std::chrono::milliseconds(0));
+    cache.get_clickabledata(dcs_path, "A-10C", lua_script);
+
+    // Change the size of a Lua file loaded by the module, as a DCS update would.
+    write_file(cockpit_path / "Scripts" / "devices.lua", "devices = {UFC = 1}");
+    const json updated = cache.get_clickabledata(dcs_path, "A-10C", lua_script);
+    EXPECT_EQ(2, num_extractions);
+    EXPECT_EQ(json::array({"A-10C2"}), updated["clickabledata_items"]);
+
+    // A newly added Lua file also invalidates the cache.
+    write_file(cockpit_path / "command_defs.lua", "");
+    cache.get_clickabledata(dcs_path, "A-10C", lua_script);
+    EXPECT_EQ(3, num_extractions);
+}
+
+TEST_F(ClickabledataCacheTest, failed_extraction_is_not_cached)
+{
+    ClickabledataCache cache(cache_directory, [this](const std::string &, const std::string &, const std::string &) {
+        num_extractions++;
+        return json({{"clickabledata_items", json::array()}, {"result", "Lua script runtime error"}});
+    });
+    EXPECT_EQ("Lua script runtime error", cache.get_clickabledata(dcs_path, "A-10C", lua_script)["result"]);
+    cache.get_clickabledata(dcs_path, "A-10C", lua_script);
+    EXPECT_EQ(2, num_extractions);
+}
+
+TEST_F(ClickabledataCacheTest, missing_module_is_not_cached)
+{
+    ClickabledataCache cache(cache_directory, counting_extractor());
+    EXPECT_EQ(0, ClickabledataCache::module_fingerprint(dcs_path, "F-16C_50", lua_script));
+    cache.get_clickabledata(dcs_path, "F-16C_50", lua_script);
+    cache.get_clickabledata(dcs_path, "F-16C_50", lua_script);
+    EXPECT_EQ(2, num_extractions);
+}
+
+TEST_F(ClickabledataCacheTest, fingerprint_differs_by_module)
+{
+    std::filesystem::create_directories(root / "DCS" / "Mods" / "aircraft" / "C-101" / "Cockpit");
+    const auto a10_fingerprint = ClickabledataCache::module_fingerprint(dcs_path, "A-10C", lua_script);
+    const auto c101_fingerprint = ClickabledataCache::module_fingerprint(dcs_path, "C-101CC", lua_script);
+    EXPECT_NE(0, a10_fingerprint);
+    EXPECT_NE(0, c101_fingerprint);
+    EXPECT_NE(a10_fingerprint, c101_fingerprint);
+}
+} // namespace test
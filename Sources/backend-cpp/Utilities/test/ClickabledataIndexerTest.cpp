@@ -0,0 +1,183 @@
+// Copyright 2026 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "Utilities/ClickabledataIndexer.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <set>
+
+namespace test
+{
+class ClickabledataIndexerTest : public ::testing::Test
+{
+  protected:
+    ClickabledataIndexerTest()
+    {
+        std::filesystem::remove_all(root);
+        for (const auto &module : modules) {
+            const auto cockpit_path = root / "DCS" / "Mods" / "aircraft" / module / "Cockpit";
+            std::filesystem::create_directories(cockpit_path);
+            std::ofstream(cockpit_path / "clickabledata.lua") << "elements = {}";
+        }
+    }
+
+    ~ClickabledataIndexerTest() { std::filesystem::remove_all(root); }
+
+    json extract(const std::string &module_name)
+    {
+        num_extractions++;
+        std::this_thread::sleep_for(extraction_time);
+        return json({{"clickabledata_items", json::array({module_name})}, {"result", "success"}});
+    }
+
+    const std::filesystem::path root = "clickabledata_indexer_test";
+    const std::string dcs_path = (root / "DCS").string();
+    const std::vector<std::string> modules = {"A-10C", "AV8BNA", "F-16C_50", "FA-18C_hornet", "M-2000C"};
+    std::atomic<int> num_extractions{0};
+    std::chrono::milliseconds extraction_time{0};
+    ClickabledataCache cache{(root / "cache").string(),
+                             [this](const std::string &, const std::string &module_name, const std::string &) {
+                                 return extract(module_name);
+                             }};
+};
+
+TEST_F(ClickabledataIndexerTest, indexes_all_modules_into_cache)
+{
+    std::mutex progress_mutex;
+    std::vector<ClickabledataIndexer::Progress> progress;
+    {
+        ClickabledataIndexer indexer(cache, "extract.lua", 2);
+        indexer.start(ClickabledataIndexer::jobs_for_installed_modules(dcs_path, modules),
+                      [&progress_mutex, &progress](const ClickabledataIndexer::Progress &update) {
+                          std::lock_guard<std::mutex> lock(progress_mutex);
+                          progress.push_back(update);
+                      });
+        while (indexer.is_running()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    EXPECT_EQ(modules.size(), num_extractions);
+    ASSERT_EQ(modules.size(), progress.size());
+    std::set<std::string> indexed_modules;
+    for (size_t i = 0; i < progress.size(); i++) {
+        const auto &update = progress[i];
+        EXPECT_EQ(i + 1, update.num_completed);
+        EXPECT_EQ(modules.size(), update.num_jobs);
+        EXPECT_TRUE(update.success);
+        indexed_modules.insert(update.module_name);
+    }
+    EXPECT_EQ(std::set<std::string>(modules.begin(), modules.end()), indexed_modules);
+
+    // Lookups are now served from the cache.
+    EXPECT_EQ(json::array({"F-16C_50"}),
+              cache.get_clickabledata(dcs_path, "F-16C_50", "extract.lua")["clickabledata_items"]);
+    EXPECT_EQ(modules.size(), num_extractions);
+}
+
+TEST_F(ClickabledataIndexerTest, cancel_stops_remaining_jobs)
+{
+    extraction_time = std::chrono::milliseconds(20);
+    ClickabledataIndexer indexer(cache, "extract.lua", 1);
+    indexer.start(ClickabledataIndexer::jobs_for_installed_modules(dcs_path, modules));
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    indexer.cancel();
+    EXPECT_FALSE(indexer.is_running());
+    EXPECT_LT(num_extractions, static_cast<int>(modules.size()));
+}
+
+TEST_F(ClickabledataIndexerTest, restart_after_cancel_reports_only_new_jobs)
+{
+    extraction_time = std::chrono::milliseconds(20);
+    std::mutex progress_mutex;
+    std::vector<std::string> progress_modules;
+    const auto record_progress = [&progress_mutex, &progress_modules](const ClickabledataIndexer::Progress &update) {
+        std::lock_guard<std::mutex> lock(progress_mutex);
+        progress_modules.push_back(update.module_name);
+    };
+    ClickabledataIndexer indexer(cache, "extract.lua", 1);
+    indexer.start({{dcs_path, "A-10C"}}, record_progress);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    indexer.start({{dcs_path, "M-2000C"}}, record_progress);
+    while (indexer.is_running()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::lock_guard<std::mutex> lock(progress_mutex);
+    EXPECT_EQ(std::vector<std::string>({"M-2000C"}), progress_modules);
+}
+
+TEST_F(ClickabledataIndexerTest, added_progress_callback_receives_latest_progress)
+{
+    ClickabledataIndexer indexer(cache, "extract.lua", 1);
+    EXPECT_FALSE(indexer.add_progress_callback([](const ClickabledataIndexer::Progress &) {}));
+
+    indexer.start(ClickabledataIndexer::jobs_for_installed_modules(dcs_path, modules));
+    while (indexer.is_running()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // A callback added after indexing has completed is immediately given the final progress.
+    std::vector<ClickabledataIndexer::Progress> progress;
+    EXPECT_TRUE(indexer.add_progress_callback(
+        [&progress](const ClickabledataIndexer::Progress &update) { progress.push_back(update); }));
+    ASSERT_EQ(1, progress.size());
+    EXPECT_EQ(modules.size(), progress[0].num_completed);
+    EXPECT_EQ(modules.size(), progress[0].num_jobs);
+}
+
+TEST_F(ClickabledataIndexerTest, added_progress_callback_receives_remaining_progress)
+{
+    extraction_time = std::chrono::milliseconds(20);
+    std::mutex progress_mutex;
+    std::vector<size_t> first_completed;
+    std::vector<size_t> second_completed;
+    ClickabledataIndexer indexer(cache, "extract.lua", 1);
+    indexer.start(ClickabledataIndexer::jobs_for_installed_modules(dcs_path, modules),
+                  [&progress_mutex, &first_completed](const ClickabledataIndexer::Progress &update) {
+                      std::lock_guard<std::mutex> lock(progress_mutex);
+                      first_completed.push_back(update.num_completed);
+                  });
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    indexer.add_progress_callback([&progress_mutex, &second_completed](const ClickabledataIndexer::Progress &update) {
+        std::lock_guard<std::mutex> lock(progress_mutex);
+        second_completed.push_back(update.num_completed);
+    });
+    while (indexer.is_running()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // Both callbacks end with the final progress, and the added callback receives reports in order from when it was
+    // added.
+    std::lock_guard<std::mutex> lock(progress_mutex);
+    ASSERT_EQ(modules.size(), first_completed.size());
+    ASSERT_FALSE(second_completed.empty());
+    EXPECT_EQ(modules.size(), second_completed.back());
+    for (size_t i = 1; i < second_completed.size(); i++) {
+        EXPECT_EQ(second_completed[i - 1] + 1, second_completed[i]);
+    }
+}
+
+TEST_F(ClickabledataIndexerTest, lookup_during_indexing_waits_for_extraction)
+{
+    extraction_time = std::chrono::milliseconds(20);
+    ClickabledataIndexer indexer(cache, "extract.lua", 1);
+    indexer.start({{dcs_path, "A-10C"}});
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    EXPECT_EQ(json::array({"A-10C"}), cache.get_clickabledata(dcs_path, "A-10C", "extract.lua")["clickabledata_items"]);
+    EXPECT_EQ(1, num_extractions);
+}
+
+TEST(ClickabledataIndexerJobsTest, multi_version_modules_are_expanded)
+{
+    const auto jobs = ClickabledataIndexer::jobs_for_installed_modules("DCS", {"C-101", "L-39C", "A-10C"});
+    std::vector<std::string> module_names;
+    for (const auto &job : jobs) {
+        EXPECT_EQ("DCS", job.dcs_path);
+        module_names.push_back(job.module_name);
+    }
+    EXPECT_EQ(std::vector<std::string>({"C-101CC", "C-101EB", "L-39C", "L-39ZA", "A-10C"}), module_names);
+}
+} // namespace test
@@ -0,0 +1,65 @@
+// Copyright 2026 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "Utilities/DatagramBufferPool.h"
+
+namespace test
+{
+TEST(DatagramBufferPoolTest, acquire_buffer_of_max_datagram_size)
+{
+    DatagramBufferPool pool;
+    auto buffer = pool.acquire();
+    EXPECT_NE(buffer.data(), nullptr);
+    EXPECT_EQ(buffer.capacity(), DatagramBufferPool::MAX_DATAGRAM_SIZE);
+    EXPECT_EQ(buffer.size(), 0);
+    EXPECT_EQ(pool.num_buffers_allocated(), 1);
+}
+
+TEST(DatagramBufferPoolTest, released_buffers_are_reused)
+{
+    DatagramBufferPool pool;
+    const char *first_storage = nullptr;
+    {
+        auto buffer = pool.acquire();
+        buffer.set_size(10);
+        first_storage = buffer.data();
+    }
+    for (int i = 0; i < 5; i++) {
+        auto buffer = pool.acquire();
+        EXPECT_EQ(buffer.data(), first_storage);
+        EXPECT_EQ(buffer.size(), 0);
+    }
+    EXPECT_EQ(pool.num_buffers_allocated(), 1);
+}
+
+TEST(DatagramBufferPoolTest, pool_grows_while_buffers_are_held)
+{
+    DatagramBufferPool pool;
+    {
+        auto first = pool.acquire();
+        auto second = pool.acquire();
+        EXPECT_NE(first.data(), second.data());
+    }
+    EXPECT_EQ(pool.num_buffers_allocated(), 2);
+
+    // Both buffers are available again without further allocation.
+    auto first = pool.acquire();
+    auto second = pool.acquire();
+    EXPECT_EQ(pool.num_buffers_allocated(), 2);
+}
+
+TEST(DatagramBufferPoolTest, moved_buffer_returns_to_pool_once)
+{
+    DatagramBufferPool pool;
+    {
+        auto buffer = pool.acquire();
+        buffer.set_size(4);
+        auto moved_buffer = std::move(buffer);
+        EXPECT_EQ(moved_buffer.size(), 4);
+    }
+    auto first = pool.acquire();
+    auto second = pool.acquire();
+    EXPECT_EQ(pool.num_buffers_allocated(), 2);
+}
+} // namespace test
@@ -0,0 +1,174 @@
+// Copyright 2026 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "Utilities/DatagramCapture.h"
+
+#include <cstdio>
+#include <iterator>
+
+namespace test
+{
+
+class DatagramCaptureTestFixture : public ::testing::Test
+{
+  public:
+    ~DatagramCaptureTestFixture() { std::remove(capture_path.c_str()); }
+
+    std::vector<char> read_capture() const
+    {
+        std::ifstream file(capture_path, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    const std::string capture_path = "datagram_capture_test.sdcap";
+};
+
+TEST_F(DatagramCaptureTestFixture, write_and_read_records)
+{
+    {
+        DatagramCaptureWriter writer(capture_path, 1234567890);
+        writer.write(0, "\x55\x55\x55\x55", 4, 1000);
+        writer.write(1, "header*761=1", 12, 33'000'000);
+        writer.write(0, "", 0, 66'000'000);
+        EXPECT_EQ(3, writer.num_records());
+    }
+    const auto capture = read_capture();
+    DatagramCaptureReader reader(capture.data(), capture.size());
+    EXPECT_TRUE(reader.has_stored_index());
+    EXPECT_EQ(1234567890, reader.start_time_unix_ns());
+    EXPECT_EQ(3, reader.num_records());
+    EXPECT_EQ(66'000'000, reader.duration_ns());
+
+    auto record = reader.next();
+    ASSERT_TRUE(record);
+    EXPECT_EQ(1000, record->timestamp_ns);
+    EXPECT_EQ(0, record->channel);
+    EXPECT_EQ(std::string("\x55\x55\x55\x55"), std::string(record->data, record->size));
+
+    record = reader.next();
+    ASSERT_TRUE(record);
+    EXPECT_EQ(33'000'000, record->timestamp_ns);
+    EXPECT_EQ(1, record->channel);
+    EXPECT_EQ("header*761=1", std::string(record->data, record->size));
+
+    record = reader.next();
+    ASSERT_TRUE(record);
+    EXPECT_EQ(0, record->size);
+    EXPECT_FALSE(reader.next());
+
+    // Reading may be restarted from the first record.
+    reader.rewind();
+    EXPECT_EQ(1000, reader.next()->timestamp_ns);
+}
+
+TEST_F(DatagramCaptureTestFixture, timestamps_do_not_go_backwards)
+{
+    {
+        DatagramCaptureWriter writer(capture_path, 0);
+        writer.write(0, "a", 1, 5000);
+        writer.write(0, "b", 1, 4000);
+    }
+    const auto capture = read_capture();
+    DatagramCaptureReader reader(capture.data(), capture.size());
+    EXPECT_EQ(5000, reader.next()->timestamp_ns);
+    EXPECT_EQ(5000, reader.next()->timestamp_ns);
+}
+
+TEST_F(DatagramCaptureTestFixture, seek_to_timestamp)
+{
+    const int num_records = 3 * DatagramCapture::INDEX_INTERVAL + 10;
+    {
+        DatagramCaptureWriter writer(capture_path, 0);
+        for (int i = 0; i < num_records; i++) {
+            const std::string payload = std::to_string(i);
+            writer.write(0, payload.data(), payload.size(), i * 1'000'000ULL);
+        }
+    }
+    const auto capture = read_capture();
+    DatagramCaptureReader reader(capture.data(), capture.size());
+
+    reader.seek(700'000'000);
+    EXPECT_EQ("700", std::string(reader.next()->data, 3));
+
+    // Seek to a time between records positions the reader at the following record.
+    reader.seek(299'500'000);
+    EXPECT_EQ(300'000'000, reader.next()->timestamp_ns);
+
+    reader.seek(0);
+    EXPECT_EQ(0, reader.next()->timestamp_ns);
+
+    reader.seek(num_records * 1'000'000ULL);
+    EXPECT_FALSE(reader.next());
+}
+
+TEST_F(DatagramCaptureTestFixture, read_capture_without_index)
+{
+    {
+        DatagramCaptureWriter writer(capture_path, 0);
+        for (int i = 0; i < 300; i++) {
+            writer.write(i % 2, "data", 4, i * 1000ULL);
+        }
+    }
+    auto capture = read_capture();
+    // Simulate a recording which was interrupted part-way through writing the index and the record before it.
+    const size_t index_size = 2 * sizeof(DatagramCapture::IndexEntry) + DatagramCapture::TRAILER_SIZE;
+    capture.resize(capture.size() - index_size - 2);
+
+    DatagramCaptureReader reader(capture.data(), capture.size());
+    EXPECT_FALSE(reader.has_stored_index());
+    EXPECT_EQ(299, reader.num_records());
+    EXPECT_EQ(298'000, reader.duration_ns());
+    reader.seek(290'000);
+    const auto record = reader.next();
+    ASSERT_TRUE(record);
+    EXPECT_EQ(290'000, record->timestamp_ns);
+    EXPECT_EQ(0, record->channel);
+}
+
+TEST_F(DatagramCaptureTestFixture, corrupt_index_entry_count_is_not_used)
+{
+    {
+        DatagramCaptureWriter writer(capture_path, 0);
+        for (int i = 0; i < 300; i++) {
+            writer.write(0, "data", 4, i * 1000ULL);
+        }
+    }
+    auto capture = read_capture();
+    // A count which overflows to the size of the stored index when multiplied by the size of an index entry.
+    const size_t count_offset = capture.size() - DatagramCapture::TRAILER_SIZE + 8;
+    capture[count_offset + 7] = static_cast<char>(capture[count_offset + 7] | 0x20);
+
+    DatagramCaptureReader reader(capture.data(), capture.size());
+    EXPECT_FALSE(reader.has_stored_index());
+    const auto record = reader.next();
+    ASSERT_TRUE(record);
+    EXPECT_EQ("data", std::string(record->data, record->size));
+}
+
+TEST_F(DatagramCaptureTestFixture, failed_write_throws)
+{
+    // Writes to /dev/full fail as on a full disk.
+    if (!std::ifstream("/dev/full")) {
+        GTEST_SKIP() << "No /dev/full on this platform";
+    }
+    DatagramCaptureWriter writer("/dev/full", 0);
+    const std::vector<char> datagram(4096, 'x');
+    EXPECT_THROW(
+        {
+            for (int i = 0; i < 1000; i++) {
+                writer.write(0, datagram.data(), datagram.size(), i * 1000ULL);
+            }
+            writer.close();
+        },
+        std::runtime_error);
+}
+
+TEST(DatagramCaptureTest, invalid_capture_throws)
+{
+    const std::string not_a_capture = "This is not a datagram capture file.";
+    EXPECT_THROW(DatagramCaptureReader(not_a_capture.data(), not_a_capture.size()), std::runtime_error);
+    EXPECT_THROW(DatagramCaptureReader(not_a_capture.data(), 4), std::runtime_error);
+}
+
+} // namespace test
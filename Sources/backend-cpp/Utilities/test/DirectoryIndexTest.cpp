@@ -0,0 +1,107 @@
+// Copyright 2026 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "Utilities/DirectoryIndex.h"
+
+#include <filesystem>
+#include <fstream>
+#include <functional>
+
+namespace test
+{
+class DirectoryIndexTest : public ::testing::Test
+{
+  protected:
+    DirectoryIndexTest()
+    {
+        std::filesystem::remove_all(root);
+        std::filesystem::create_directories(root / "A-10C" / "Scripts");
+        std::filesystem::create_directories(root / "F-16C_50");
+        write_file(root / "A-10C" / "A-10C.json");
+        write_file(root / "A-10C" / "Scripts" / "devices.json");
+        write_file(root / "A-10C" / "readme.txt");
+        write_file(root / "F-16C_50" / "F-16C_50.json");
+    }
+
+    ~DirectoryIndexTest() { std::filesystem::remove_all(root); }
+
+    static void write_file(const std::filesystem::path &path) { std::ofstream(path) << "{}"; }
+
+    // Waits until the condition holds, as the index is updated by a background thread.
+    static bool eventually(const std::function<bool()> &condition)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (std::chrono::steady_clock::now() < deadline) {
+            if (condition()) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return condition();
+    }
+
+    const std::filesystem::path root = "directory_index_test";
+};
+
+TEST_F(DirectoryIndexTest, find_files_recursively)
+{
+    DirectoryIndex index;
+    const auto json_files = index.find_files(root.string(), ".json");
+    ASSERT_TRUE(json_files);
+    EXPECT_EQ(std::vector<std::string>({(root / "A-10C" / "A-10C.json").string(),
+                                        (root / "A-10C" / "Scripts" / "devices.json").string(),
+                                        (root / "F-16C_50" / "F-16C_50.json").string()}),
+              json_files.value());
+}
+
+TEST_F(DirectoryIndexTest, list_entries_of_directory)
+{
+    DirectoryIndex index;
+    const auto entries = index.list_entries((root / "A-10C").string());
+    ASSERT_TRUE(entries);
+    EXPECT_EQ(std::vector<std::string>({"A-10C.json", "Scripts", "readme.txt"}), entries.value());
+}
+
+TEST_F(DirectoryIndexTest, missing_directory_is_not_found)
+{
+    DirectoryIndex index;
+    EXPECT_FALSE(index.find_files((root / "missing").string(), ".json"));
+    EXPECT_FALSE(index.list_entries((root / "missing").string()));
+}
+
+TEST_F(DirectoryIndexTest, repeated_listings_are_served_from_memory)
+{
+    DirectoryIndex index;
+    for (int i = 0; i < 5; i++) {
+        EXPECT_EQ(3, index.find_files(root.string(), ".json").value().size());
+        EXPECT_EQ(2, index.list_entries(root.string()).value().size());
+    }
+    // One scan each for the recursive and non-recursive index of the directory.
+    EXPECT_EQ(2, index.num_scans());
+}
+
+TEST_F(DirectoryIndexTest, added_and_removed_files_are_indexed)
+{
+    DirectoryIndex index(std::chrono::milliseconds(500));
+    ASSERT_EQ(3, index.find_files(root.string(), ".json").value().size());
+
+    std::filesystem::create_directories(root / "AH-64D" / "Cockpit");
+    write_file(root / "AH-64D" / "Cockpit" / "AH-64D.json");
+    EXPECT_TRUE(eventually([&]() { return index.find_files(root.string(), ".json").value().size() == 4; }));
+
+    std::filesystem::remove_all(root / "A-10C");
+    EXPECT_TRUE(eventually([&]() { return index.find_files(root.string(), ".json").value().size() == 2; }));
+    EXPECT_EQ(std::vector<std::string>({(root / "AH-64D" / "Cockpit" / "AH-64D.json").string(),
+                                        (root / "F-16C_50" / "F-16C_50.json").string()}),
+              index.find_files(root.string(), ".json").value());
+}
+
+TEST_F(DirectoryIndexTest, removed_directory_is_no_longer_found)
+{
+    DirectoryIndex index(std::chrono::milliseconds(500));
+    ASSERT_TRUE(index.list_entries((root / "F-16C_50").string()));
+    std::filesystem::remove_all(root / "F-16C_50");
+    EXPECT_TRUE(eventually([&]() { return !index.list_entries((root / "F-16C_50").string()); }));
+}
+} // namespace test
@@ -2,8 +2,12 @@
 
 #include "gtest/gtest.h"
 
+#include "Utilities/DirectoryIndex.h"
 #include "Utilities/JsonReader.h"
 
+#include <filesystem>
+#include <fstream>
+
 namespace test
 {
 TEST(JsonReaderTest, getModuleListNonexistantPath)
@@ -13,6 +17,13 @@ TEST(JsonReaderTest, getModuleListNonexistantPath)
     EXPECT_FALSE(maybe_module_list);
 }
 
+TEST(JsonReaderTest, getModuleListFromDirectoryIndexNonexistantPath)
+{
+    DirectoryIndex directory_index;
+    const auto maybe_module_list = get_module_list("non-existant-path", directory_index);
+    EXPECT_FALSE(maybe_module_list);
+}
+
 TEST(JsonReaderTest, getModuleTestPath)
 {
     const std::string path = "Sources\\backend-cpp\\Utilities\\test";
@@ -70,4 +81,53 @@ TEST(JsonReaderTest, readSampleJsonFile)
     EXPECT_EQ(json_obj["field2"]["d"], 4);
 }
 
+TEST(JsonReaderTest, getControlReferenceItems)
+{
+    const json control_reference = json::parse(R"({
+        "Fuel Panel": {"FUEL_QTY": {"identifier": "FUEL_QTY"}, "FUEL_SYS_MASTER": {"identifier": "FUEL_SYS_MASTER"}},
+        "UFC": {"UFC_ENT": {"identifier": "UFC_ENT"}, "not_a_control": 1}
+    })");
+    const json items = get_control_reference_items(control_reference);
+    ASSERT_EQ(3, items.size());
+    EXPECT_EQ("FUEL_QTY", items[0]["identifier"]);
+    EXPECT_EQ("FUEL_SYS_MASTER", items[1]["identifier"]);
+    EXPECT_EQ("UFC_ENT", items[2]["identifier"]);
+    EXPECT_TRUE(get_control_reference_items(json::array()).empty());
+}
+
+TEST(JsonReaderTest, isControlReference)
+{
+    EXPECT_TRUE(is_control_reference(json::parse(R"({"UFC": {"UFC_ENT": {"identifier": "UFC_ENT"}}})")));
+    EXPECT_FALSE(is_control_reference(json::parse(R"({"A-10C": ["CommonData", "MetadataStart"]})")));
+    EXPECT_FALSE(is_control_reference(json::parse(R"({"UFC": {}})")));
+    EXPECT_FALSE(is_control_reference(json::array()));
+}
+
+TEST(JsonReaderTest, getControlReferenceFilesFromDocJson)
+{
+    const std::filesystem::path root = "control_reference_files_test";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root / "doc" / "json");
+    std::filesystem::create_directories(root / "lib");
+    std::ofstream(root / "doc" / "json" / "A-10C.json") << "{}";
+    std::ofstream(root / "lib" / "settings.json") << "{}";
+
+    DirectoryIndex directory_index;
+    const auto files = get_control_reference_files(root.string(), directory_index);
+    ASSERT_EQ(1, files.size());
+    EXPECT_EQ("A-10C.json", std::filesystem::path(files[0]).filename().string());
+    // A path without a doc/json directory is searched itself.
+    EXPECT_EQ(1, get_control_reference_files((root / "lib").string(), directory_index).size());
+    EXPECT_TRUE(get_control_reference_files((root / "missing").string(), directory_index).empty());
+    std::filesystem::remove_all(root);
+}
+
+TEST(JsonReaderTest, validateJsonText)
+{
+    EXPECT_EQ(R"({"a": [1, 2]})", get_valid_json_text(R"({"a": [1, 2]})").value());
+    EXPECT_EQ("[]", get_valid_json_text("\xEF\xBB\xBF[]").value());
+    EXPECT_FALSE(get_valid_json_text(R"({"a": [1, 2})"));
+    EXPECT_FALSE(get_valid_json_text(""));
+}
+
 } // namespace test
\ No newline at end of file
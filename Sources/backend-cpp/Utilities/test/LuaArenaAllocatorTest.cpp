@@ -0,0 +1,139 @@
+// Copyright 2026 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "Utilities/LuaArenaAllocator.h"
+
+#include <cstring>
+#include <vector>
+
+namespace test
+{
+TEST(LuaArenaAllocatorTest, small_blocks_are_carved_from_one_chunk)
+{
+    LuaArenaAllocator allocator(1024 * 1024);
+    void *first = allocator.reallocate(nullptr, 0, 24);
+    void *second = allocator.reallocate(nullptr, 0, 100);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(1, allocator.num_chunks());
+    EXPECT_EQ(32 + 112, allocator.bytes_in_use());
+
+    allocator.reallocate(first, 24, 0);
+    allocator.reallocate(second, 100, 0);
+    EXPECT_EQ(0, allocator.bytes_in_use());
+    EXPECT_EQ(32 + 112, allocator.peak_bytes_in_use());
+}
+
+TEST(LuaArenaAllocatorTest, freed_small_blocks_are_reused)
+{
+    LuaArenaAllocator allocator(1024 * 1024);
+    void *first = allocator.reallocate(nullptr, 0, 40);
+    allocator.reallocate(first, 40, 0);
+    for (int i = 0; i < 5; i++) {
+        // Any size within the same size class reuses the freed block.
+        void *block = allocator.reallocate(nullptr, 0, 33 + i);
+        EXPECT_EQ(first, block);
+        allocator.reallocate(block, 33 + i, 0);
+    }
+    EXPECT_EQ(1, allocator.num_chunks());
+}
+
+TEST(LuaArenaAllocatorTest, resize_keeps_contents)
+{
+    LuaArenaAllocator allocator(1024 * 1024);
+    char *block = static_cast<char *>(allocator.reallocate(nullptr, 0, 16));
+    std::memcpy(block, "lua arena test", 15);
+
+    // Within the same size class the block is resized in place.
+    EXPECT_EQ(block, allocator.reallocate(block, 16, 15));
+
+    // Growing into a larger size class and then into a large block moves the contents.
+    block = static_cast<char *>(allocator.reallocate(block, 15, 200));
+    ASSERT_NE(block, nullptr);
+    EXPECT_STREQ("lua arena test", block);
+    block = static_cast<char *>(allocator.reallocate(block, 200, 4096));
+    ASSERT_NE(block, nullptr);
+    EXPECT_STREQ("lua arena test", block);
+    EXPECT_EQ(4096, allocator.bytes_in_use());
+
+    // Shrinking back to a small block also keeps the contents.
+    block = static_cast<char *>(allocator.reallocate(block, 4096, 20));
+    ASSERT_NE(block, nullptr);
+    EXPECT_STREQ("lua arena test", block);
+    EXPECT_EQ(32, allocator.bytes_in_use());
+    allocator.reallocate(block, 20, 0);
+    EXPECT_EQ(0, allocator.bytes_in_use());
+}
+
+TEST(LuaArenaAllocatorTest, allocation_fails_beyond_memory_limit)
+{
+    LuaArenaAllocator allocator(4096);
+    void *large = allocator.reallocate(nullptr, 0, 4000);
+    ASSERT_NE(large, nullptr);
+    EXPECT_EQ(nullptr, allocator.reallocate(nullptr, 0, 1000));
+    EXPECT_EQ(nullptr, allocator.reallocate(large, 4000, 5000));
+    EXPECT_EQ(4000, allocator.bytes_in_use());
+
+    // Shrinking succeeds regardless of the limit, freeing memory for new allocations.
+    void *shrunk = allocator.reallocate(large, 4000, 1000);
+    ASSERT_NE(shrunk, nullptr);
+    EXPECT_NE(nullptr, allocator.reallocate(nullptr, 0, 1000));
+}
+
+TEST(LuaArenaAllocatorTest, whole_chunks_count_toward_memory_limit)
+{
+    LuaArenaAllocator allocator(LuaArenaAllocator::CHUNK_SIZE + 1024);
+    void *small = allocator.reallocate(nullptr, 0, 16);
+    ASSERT_NE(small, nullptr);
+    EXPECT_EQ(LuaArenaAllocator::CHUNK_SIZE, allocator.bytes_reserved());
+
+    // Free blocks in the chunk still count, so only the remainder of the limit is available to large blocks.
+    allocator.reallocate(small, 16, 0);
+    EXPECT_EQ(nullptr, allocator.reallocate(nullptr, 0, 2048));
+    EXPECT_NE(nullptr, allocator.reallocate(nullptr, 0, 1024));
+    EXPECT_EQ(LuaArenaAllocator::CHUNK_SIZE + 1024, allocator.bytes_reserved());
+}
+
+TEST(LuaArenaAllocatorTest, release_free_chunks_keeps_chunks_in_use)
+{
+    LuaArenaAllocator allocator(1024 * 1024);
+    const size_t blocks_per_chunk = LuaArenaAllocator::CHUNK_SIZE / LuaArenaAllocator::MAX_SMALL_BLOCK_SIZE;
+    std::vector<void *> blocks;
+    for (size_t i = 0; i < 2 * blocks_per_chunk + 1; i++) {
+        blocks.push_back(allocator.reallocate(nullptr, 0, LuaArenaAllocator::MAX_SMALL_BLOCK_SIZE));
+        ASSERT_NE(blocks.back(), nullptr);
+    }
+    EXPECT_EQ(3, allocator.num_chunks());
+    EXPECT_EQ(0, allocator.release_free_chunks());
+
+    // Only the block carved from the newest chunk is still in use.
+    for (size_t i = 0; i < 2 * blocks_per_chunk; i++) {
+        allocator.reallocate(blocks[i], LuaArenaAllocator::MAX_SMALL_BLOCK_SIZE, 0);
+    }
+    EXPECT_EQ(2, allocator.release_free_chunks());
+    EXPECT_EQ(1, allocator.num_chunks());
+    EXPECT_EQ(LuaArenaAllocator::CHUNK_SIZE, allocator.bytes_reserved());
+
+    // Allocation continues from the kept chunk, and a new chunk once all are released.
+    void *block = allocator.reallocate(nullptr, 0, 24);
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ(1, allocator.num_chunks());
+    allocator.reallocate(block, 24, 0);
+    allocator.reallocate(blocks.back(), LuaArenaAllocator::MAX_SMALL_BLOCK_SIZE, 0);
+    EXPECT_EQ(1, allocator.release_free_chunks());
+    EXPECT_EQ(0, allocator.bytes_reserved());
+    EXPECT_NE(nullptr, allocator.reallocate(nullptr, 0, 24));
+    EXPECT_EQ(1, allocator.num_chunks());
+}
+
+TEST(LuaArenaAllocatorTest, lua_alloc_function_forwards_to_allocator)
+{
+    LuaArenaAllocator allocator(1024 * 1024);
+    void *block = LuaArenaAllocator::allocate(&allocator, nullptr, 0, 64);
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ(64, allocator.bytes_in_use());
+    EXPECT_EQ(nullptr, LuaArenaAllocator::allocate(&allocator, block, 64, 0));
+    EXPECT_EQ(0, allocator.bytes_in_use());
+}
+} // namespace test
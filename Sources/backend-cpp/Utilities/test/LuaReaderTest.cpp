@@ -7,8 +7,23 @@
 #include "nlohmann/json.hpp"
 using json = nlohmann::json;
 
+#include <filesystem>
+#include <fstream>
+
 namespace test
 {
+/**
+ * @brief Writes a clickabledata extraction script to a file and runs it through get_clickabledata().
+ */
+json get_clickabledata_from_script(const std::string &script)
+{
+    const std::string lua_script = "lua_reader_test_script.lua";
+    std::ofstream(lua_script) << script;
+    json returned_values = get_clickabledata("path", "module", lua_script);
+    std::filesystem::remove(lua_script);
+    return returned_values;
+}
+
 TEST(LuaReaderTest, get_installed_modules_bad_path)
 {
     const std::string dcs_install_path = "non-existant-path";
@@ -28,4 +43,53 @@ TEST(LuaReaderTest, nonexistant_lua_file)
     EXPECT_EQ(0, returned_values["clickabledata_items"].size());
 }
 
+TEST(LuaReaderTest, clickabledata_typed_records)
+{
+    json returned_values = get_clickabledata_from_script(
+        "return {{device = 'UFC', device_id = 25, button_id = 3001, element = 'PNT_1', type = 'btn', dcs_id = 171,"
+        " click_value = 1.0, limit_min = 0.0, limit_max = 0.5, description = 'Button 1, left'}}");
+    EXPECT_EQ("success", returned_values["result"]);
+    ASSERT_EQ(1, returned_values["clickabledata_items"].size());
+    const json expected_element = {{"device", "UFC"},
+                                   {"device_id", 25},
+                                   {"button_id", 3001},
+                                   {"element", "PNT_1"},
+                                   {"type", "btn"},
+                                   {"dcs_id", 171},
+                                   {"click_value", "1.0"},
+                                   {"limit_min", "0.0"},
+                                   {"limit_max", "0.5"},
+                                   {"description", "Button 1, left"}};
+    EXPECT_EQ(expected_element, returned_values["clickabledata_items"][0]);
+}
+
+TEST(LuaReaderTest, clickabledata_nil_attributes_omitted)
+{
+    json returned_values = get_clickabledata_from_script(
+        "return {{device = 'UFC', device_id = 25, description = nil}, {element = 'PNT_2'}}");
+    EXPECT_EQ("success", returned_values["result"]);
+    ASSERT_EQ(2, returned_values["clickabledata_items"].size());
+    EXPECT_EQ(json({{"device", "UFC"}, {"device_id", 25}}), returned_values["clickabledata_items"][0]);
+    EXPECT_EQ(json({{"element", "PNT_2"}}), returned_values["clickabledata_items"][1]);
+}
+
+TEST(LuaReaderTest, clickabledata_nested_tables)
+{
+    json returned_values = get_clickabledata_from_script(
+        "return {{element = 'PNT_3', arg = {101, 102}, hint = {text = 'Knob', cycle = true}, empty = {}}}");
+    EXPECT_EQ("success", returned_values["result"]);
+    ASSERT_EQ(1, returned_values["clickabledata_items"].size());
+    const json &element = returned_values["clickabledata_items"][0];
+    EXPECT_EQ(json::array({101, 102}), element["arg"]);
+    EXPECT_EQ(json({{"text", "Knob"}, {"cycle", true}}), element["hint"]);
+    EXPECT_EQ(json::object(), element["empty"]);
+}
+
+TEST(LuaReaderTest, clickabledata_script_not_returning_table)
+{
+    json returned_values = get_clickabledata_from_script("return 42");
+    EXPECT_EQ("Lua script did not return a table of clickabledata elements.", returned_values["result"]);
+    EXPECT_EQ(0, returned_values["clickabledata_items"].size());
+}
+
 } // namespace test
\ No newline at end of file
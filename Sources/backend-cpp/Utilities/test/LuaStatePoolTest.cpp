@@ -0,0 +1,106 @@
+// Copyright 2026 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "Utilities/LuaStatePool.h"
+
+#include "lua.hpp"
+
+#include <string>
+
+namespace test
+{
+namespace
+{
+// Runs a chunk of Lua in the state, returning its error message or an empty string on success.
+std::string run_lua(lua_State *lua_state, const std::string &chunk)
+{
+    if (luaL_dostring(lua_state, chunk.c_str()) != LUA_OK) {
+        const std::string error = lua_tostring(lua_state, -1);
+        lua_pop(lua_state, 1);
+        return error;
+    }
+    return "";
+}
+} // namespace
+
+TEST(LuaStatePoolTest, states_are_reused_after_release)
+{
+    LuaStatePool pool;
+    lua_State *first_state = nullptr;
+    {
+        auto lease = pool.acquire();
+        ASSERT_TRUE(lease);
+        first_state = lease.state();
+        EXPECT_EQ(0, pool.num_idle_states());
+    }
+    EXPECT_EQ(1, pool.num_idle_states());
+
+    auto lease = pool.acquire();
+    EXPECT_EQ(first_state, lease.state());
+    EXPECT_EQ(1, pool.num_states_created());
+}
+
+TEST(LuaStatePoolTest, globals_are_reset_on_release)
+{
+    LuaStatePool pool;
+    {
+        auto lease = pool.acquire();
+        EXPECT_EQ("", run_lua(lease.state(), "module_name = 'A-10C'; print = nil; string.extra = 1;"
+                                             "setmetatable(_G, {__index = function() return 'missing' end})"));
+    }
+
+    auto lease = pool.acquire();
+    EXPECT_EQ("", run_lua(lease.state(), "assert(module_name == nil); assert(type(print) == 'function');"
+                                         "assert(string.extra == nil); assert(getmetatable(_G) == nil)"));
+    EXPECT_EQ(1, pool.num_states_created());
+}
+
+TEST(LuaStatePoolTest, discarded_states_are_not_reused)
+{
+    LuaStatePool pool;
+    {
+        auto lease = pool.acquire();
+        lease.discard();
+    }
+    EXPECT_EQ(0, pool.num_idle_states());
+    auto lease = pool.acquire();
+    EXPECT_TRUE(lease);
+    EXPECT_EQ(2, pool.num_states_created());
+}
+
+TEST(LuaStatePoolTest, idle_states_are_limited)
+{
+    LuaStatePool pool(1);
+    {
+        auto first = pool.acquire();
+        auto second = pool.acquire();
+        EXPECT_NE(first.state(), second.state());
+    }
+    EXPECT_EQ(1, pool.num_idle_states());
+    EXPECT_EQ(2, pool.num_states_created());
+}
+
+TEST(LuaStatePoolTest, memory_used_by_script_is_released)
+{
+    LuaStatePool pool;
+    size_t bytes_reserved_while_running = 0;
+    {
+        auto lease = pool.acquire();
+        EXPECT_EQ("", run_lua(lease.state(), "data = {} for i = 1, 1e5 do data[i] = {i} end"));
+        bytes_reserved_while_running = lease.allocator()->bytes_reserved();
+    }
+    auto lease = pool.acquire();
+    EXPECT_LT(lease.allocator()->bytes_reserved(), bytes_reserved_while_running / 10);
+}
+
+TEST(LuaStatePoolTest, runaway_script_fails_with_memory_error)
+{
+    LuaStatePool pool(1, 4 * 1024 * 1024);
+    auto lease = pool.acquire();
+    const std::string error = run_lua(lease.state(), "local t = {} for i = 1, 1e8 do t[i] = tostring(i) end");
+    EXPECT_NE(std::string::npos, error.find("not enough memory"));
+    EXPECT_LE(lease.allocator()->peak_bytes_in_use(), 4 * 1024 * 1024);
+    EXPECT_LE(lease.allocator()->bytes_reserved(), 4 * 1024 * 1024);
+}
+} // namespace test
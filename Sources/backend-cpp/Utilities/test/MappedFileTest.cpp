@@ -0,0 +1,39 @@
+// Copyright 2026 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "Utilities/MappedFile.h"
+
+#include <cstdio>
+#include <fstream>
+
+namespace test
+{
+
+TEST(MappedFileTest, map_file_contents)
+{
+    const std::string path = "mapped_file_test.bin";
+    const std::string contents("mapped\0contents", 15);
+    std::ofstream(path, std::ios::binary) << contents;
+    {
+        MappedFile file(path);
+        ASSERT_EQ(contents.size(), file.size());
+        EXPECT_EQ(contents, std::string(file.data(), file.size()));
+    }
+    std::remove(path.c_str());
+}
+
+TEST(MappedFileTest, map_empty_file)
+{
+    const std::string path = "mapped_file_test_empty.bin";
+    std::ofstream(path, std::ios::binary).close();
+    {
+        MappedFile file(path);
+        EXPECT_EQ(0, file.size());
+    }
+    std::remove(path.c_str());
+}
+
+TEST(MappedFileTest, missing_file_throws) { EXPECT_THROW(MappedFile("nonexistent_file.bin"), std::runtime_error); }
+
+} // namespace test
@@ -0,0 +1,172 @@
+// Copyright 2026 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "Utilities/RequestExecutor.h"
+
+#include <chrono>
+#include <future>
+#include <map>
+#include <thread>
+
+namespace test
+{
+class RequestExecutorTest : public ::testing::Test
+{
+  protected:
+    // Task which blocks its worker until released, so later requests stay queued.
+    RequestExecutor::Task blocking_task(const json &result)
+    {
+        return [this, result](const std::atomic<bool> &) {
+            release_future.wait();
+            return result;
+        };
+    }
+
+    RequestExecutor::Completion record_result(const std::string &name)
+    {
+        return [this, name](const json &result) {
+            std::lock_guard<std::mutex> lock(mutex);
+            results[name] = result;
+        };
+    }
+
+    std::promise<void> release;
+    std::shared_future<void> release_future = release.get_future().share();
+    std::mutex mutex;
+    std::map<std::string, json> results;
+};
+
+TEST_F(RequestExecutorTest, complete_request_with_result)
+{
+    RequestExecutor executor;
+    EXPECT_TRUE(executor.submit(
+        "context", "module", [](const std::atomic<bool> &) { return json({{"result", "success"}}); },
+        record_result("lookup")));
+    executor.wait_until_idle();
+    EXPECT_EQ(json({{"result", "success"}}), results["lookup"]);
+}
+
+TEST_F(RequestExecutorTest, duplicate_requests_share_one_run)
+{
+    RequestExecutor executor;
+    std::atomic<int> num_runs = 0;
+    const auto counted_task = [&num_runs, this](const std::atomic<bool> &) {
+        num_runs++;
+        release_future.wait();
+        return json(num_runs.load());
+    };
+    EXPECT_TRUE(executor.submit("first_context", "A-10C", counted_task, record_result("first")));
+    EXPECT_FALSE(executor.submit("second_context", "A-10C", counted_task, record_result("second")));
+    release.set_value();
+    executor.wait_until_idle();
+
+    EXPECT_EQ(1, num_runs);
+    EXPECT_EQ(json(1), results["first"]);
+    EXPECT_EQ(json(1), results["second"]);
+
+    // Once finished, the same key is run again.
+    EXPECT_TRUE(executor.submit("first_context", "A-10C", counted_task, record_result("third")));
+    executor.wait_until_idle();
+    EXPECT_EQ(json(2), results["third"]);
+}
+
+TEST_F(RequestExecutorTest, superseded_queued_request_is_not_run)
+{
+    RequestExecutor executor(1);
+    executor.submit("", "busy", blocking_task("busy"), record_result("busy"));
+
+    std::atomic<bool> superseded_task_ran = false;
+    executor.submit(
+        "context",
+        "A-10C",
+        [&superseded_task_ran](const std::atomic<bool> &) {
+            superseded_task_ran = true;
+            return json("A-10C");
+        },
+        record_result("A-10C"));
+    executor.submit("context", "F-16C_50", blocking_task("F-16C_50"), record_result("F-16C_50"));
+    release.set_value();
+    executor.wait_until_idle();
+
+    EXPECT_FALSE(superseded_task_ran);
+    EXPECT_EQ(0, results.count("A-10C"));
+    EXPECT_EQ(json("F-16C_50"), results["F-16C_50"]);
+    EXPECT_EQ(json("busy"), results["busy"]);
+}
+
+TEST_F(RequestExecutorTest, superseded_running_request_is_cancelled)
+{
+    RequestExecutor executor(1);
+    std::promise<void> started;
+    executor.submit(
+        "context",
+        "A-10C",
+        [&started](const std::atomic<bool> &is_cancelled) {
+            started.set_value();
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (!is_cancelled && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            return json(is_cancelled.load());
+        },
+        record_result("A-10C"));
+    started.get_future().wait();
+    executor.submit(
+        "context", "F-16C_50", [](const std::atomic<bool> &) { return json("F-16C_50"); }, record_result("F-16C_50"));
+    executor.wait_until_idle();
+
+    EXPECT_EQ(0, results.count("A-10C"));
+    EXPECT_EQ(json("F-16C_50"), results["F-16C_50"]);
+}
+
+TEST_F(RequestExecutorTest, request_wanted_by_other_group_is_not_cancelled)
+{
+    RequestExecutor executor(1);
+    executor.submit("", "busy", blocking_task("busy"), nullptr);
+    executor.submit("first_context", "A-10C", blocking_task("A-10C"), record_result("first"));
+    executor.submit("second_context", "A-10C", blocking_task("A-10C"), record_result("second"));
+    executor.submit("first_context", "F-16C_50", blocking_task("F-16C_50"), record_result("F-16C_50"));
+    release.set_value();
+    executor.wait_until_idle();
+
+    EXPECT_EQ(0, results.count("first"));
+    EXPECT_EQ(json("A-10C"), results["second"]);
+    EXPECT_EQ(json("F-16C_50"), results["F-16C_50"]);
+}
+
+TEST_F(RequestExecutorTest, cancel_group)
+{
+    RequestExecutor executor(1);
+    executor.submit("", "busy", blocking_task("busy"), nullptr);
+    executor.submit("context", "A-10C", blocking_task("A-10C"), record_result("A-10C"));
+    executor.cancel_group("context");
+    release.set_value();
+    executor.wait_until_idle();
+    EXPECT_TRUE(results.empty());
+}
+
+TEST_F(RequestExecutorTest, task_exception_is_reported_as_result)
+{
+    RequestExecutor executor;
+    executor.submit(
+        "context",
+        "A-10C",
+        [](const std::atomic<bool> &) -> json { throw std::runtime_error("Lua error"); },
+        record_result("A-10C"));
+    executor.wait_until_idle();
+    EXPECT_EQ("Request failed: Lua error", results["A-10C"]["result"]);
+}
+
+TEST_F(RequestExecutorTest, destroy_with_queued_requests)
+{
+    {
+        RequestExecutor executor(1);
+        executor.submit("", "busy", blocking_task("busy"), nullptr);
+        executor.submit("context", "A-10C", blocking_task("A-10C"), record_result("A-10C"));
+        release.set_value();
+    }
+    // The queued request may or may not have started before destruction, but the executor must not hang.
+    SUCCEED();
+}
+} // namespace test
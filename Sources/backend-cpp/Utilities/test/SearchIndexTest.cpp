@@ -0,0 +1,108 @@
+// Copyright 2026 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "Utilities/SearchIndex.h"
+
+namespace test
+{
+static const json controls = json::parse(R"([
+    {"identifier": "FUEL_SYS_MASTER", "description": "Fuel System Master Switch", "category": "Fuel Panel"},
+    {"identifier": "FUEL_QTY", "description": "Fuel Quantity", "category": "Fuel Panel"},
+    {"identifier": "UFC_ENT", "description": "UFC Enter", "category": "UFC"},
+    {"identifier": "MASTER_ARM", "description": "Master Arm Switch", "category": "Armament"},
+    {"identifier": "AAP_STEER", "description": "Steer Point Selector", "category": "AAP", "dcs_id": 3009}
+])");
+
+static std::vector<std::string> identifiers(const SearchIndex &index, const std::string &query)
+{
+    std::vector<std::string> found;
+    for (const size_t item : index.search(query)) {
+        found.push_back(index.page("", item, 1)["items"][0]["identifier"]);
+    }
+    return found;
+}
+
+TEST(SearchIndexTest, empty_query_matches_all_items_in_order)
+{
+    const SearchIndex index(controls, {"identifier", "description", "category"});
+    EXPECT_EQ(5, index.num_items());
+    EXPECT_EQ(std::vector<size_t>({0, 1, 2, 3, 4}), index.search(""));
+    EXPECT_EQ(std::vector<size_t>({0, 1, 2, 3, 4}), index.search(" _ "));
+}
+
+TEST(SearchIndexTest, match_substring_ignoring_case)
+{
+    const SearchIndex index(controls, {"identifier", "description", "category"});
+    EXPECT_EQ(std::vector<std::string>({"FUEL_QTY"}), identifiers(index, "quant"));
+    EXPECT_EQ(std::vector<std::string>({"FUEL_QTY"}), identifiers(index, "UANTIT"));
+    EXPECT_TRUE(identifiers(index, "hydraulic").empty());
+}
+
+TEST(SearchIndexTest, every_term_must_match)
+{
+    const SearchIndex index(controls, {"identifier", "description", "category"});
+    EXPECT_EQ(std::vector<std::string>({"FUEL_SYS_MASTER"}), identifiers(index, "master fuel"));
+    EXPECT_EQ(std::vector<std::string>({"FUEL_SYS_MASTER"}), identifiers(index, "FUEL_SYS"));
+    EXPECT_TRUE(identifiers(index, "master quantity").empty());
+}
+
+TEST(SearchIndexTest, short_terms_match_start_of_words)
+{
+    const SearchIndex index(controls, {"identifier", "description", "category"});
+    EXPECT_EQ(std::vector<std::string>({"UFC_ENT"}), identifiers(index, "uf"));
+    EXPECT_EQ(std::vector<std::string>({"MASTER_ARM"}), identifiers(index, "ar"));
+    // "as" is within "Master", but starts no word.
+    EXPECT_TRUE(identifiers(index, "as").empty());
+}
+
+TEST(SearchIndexTest, rank_whole_words_and_weighted_fields_first)
+{
+    const SearchIndex index(controls, {"identifier", "description", "category"});
+    // "master" is a whole identifier word of both, so they rank in array order.
+    EXPECT_EQ(std::vector<std::string>({"FUEL_SYS_MASTER", "MASTER_ARM"}), identifiers(index, "master"));
+    // "ste" starts a word of AAP_STEER, but is only within "System" and "Master" of the others.
+    EXPECT_EQ(std::vector<std::string>({"AAP_STEER", "FUEL_SYS_MASTER", "MASTER_ARM"}), identifiers(index, "ste"));
+}
+
+TEST(SearchIndexTest, search_number_fields)
+{
+    const SearchIndex index(controls, {"identifier", "dcs_id"});
+    EXPECT_EQ(std::vector<std::string>({"AAP_STEER"}), identifiers(index, "3009"));
+}
+
+TEST(SearchIndexTest, page_of_results)
+{
+    const SearchIndex index(controls, {"identifier", "description", "category"});
+    const json first_page = index.page("switch", 0, 1);
+    EXPECT_EQ(2, first_page["total"]);
+    EXPECT_EQ(0, first_page["offset"]);
+    ASSERT_EQ(1, first_page["items"].size());
+    EXPECT_EQ(controls[0], first_page["items"][0]);
+
+    const json second_page = index.page("switch", 1, 10);
+    ASSERT_EQ(1, second_page["items"].size());
+    EXPECT_EQ(controls[3], second_page["items"][0]);
+
+    EXPECT_TRUE(index.page("switch", 5, 10)["items"].empty());
+}
+
+TEST(SearchIndexTest, page_size_is_limited)
+{
+    json many_items = json::array();
+    for (size_t i = 0; i < SearchIndex::MAX_PAGE_SIZE + 10; i++) {
+        many_items.push_back({{"identifier", "CONTROL_" + std::to_string(i)}});
+    }
+    const SearchIndex index(many_items, {"identifier"});
+    const json page = index.page("control", 0, SearchIndex::MAX_PAGE_SIZE + 10);
+    EXPECT_EQ(SearchIndex::MAX_PAGE_SIZE + 10, page["total"]);
+    EXPECT_EQ(SearchIndex::MAX_PAGE_SIZE, page["items"].size());
+}
+
+TEST(SearchIndexTest, items_other_than_array_are_empty)
+{
+    const SearchIndex index(json::object(), {"identifier"});
+    EXPECT_EQ(0, index.num_items());
+    EXPECT_TRUE(index.search("").empty());
+}
+} // namespace test
@@ -189,4 +189,34 @@ TEST(StringUtilitiesTest, pop_key_and_value_missing_token_delim)
     EXPECT_EQ("value1key2=value2", key_and_value.value().second);
 }
 
+TEST(StringUtilitiesTest, split_pair_view_valid)
+{
+    const auto string_pair = split_pair_view("key=value", '=');
+    EXPECT_TRUE(string_pair);
+    EXPECT_EQ("key", string_pair.value().first);
+    EXPECT_EQ("value", string_pair.value().second);
+}
+
+TEST(StringUtilitiesTest, split_pair_view_empty_first)
+{
+    EXPECT_FALSE(split_pair_view("=value", '='));
+    EXPECT_FALSE(split_pair_view("keyvalue", '='));
+}
+
+TEST(StringUtilitiesTest, pop_key_and_value_view_multiple_tokens)
+{
+    std::string_view remaining = "key1=value1,key2=,key3";
+    auto key_and_value = pop_key_and_value(remaining, ',', '=');
+    EXPECT_TRUE(key_and_value);
+    EXPECT_EQ("key1", key_and_value.value().first);
+    EXPECT_EQ("value1", key_and_value.value().second);
+    key_and_value = pop_key_and_value(remaining, ',', '=');
+    EXPECT_TRUE(key_and_value);
+    EXPECT_EQ("key2", key_and_value.value().first);
+    EXPECT_EQ("", key_and_value.value().second);
+    key_and_value = pop_key_and_value(remaining, ',', '=');
+    EXPECT_FALSE(key_and_value);
+    EXPECT_TRUE(remaining.empty());
+}
+
 } // namespace test
\ No newline at end of file
@@ -76,6 +76,24 @@ TEST_F(UdpSocketTestFixture, send_and_receive_bytes)
     EXPECT_EQ(num_bytes_received, EXPECTED_NUM_BYTES);
 }
 
+TEST_F(UdpSocketTestFixture, send_and_receive_string_with_null_chars)
+{
+    const std::string test_message("before\0after", 12);
+    sender_socket.send_string(test_message);
+    std::stringstream ss_received = receiver_socket.receive_stream();
+    EXPECT_EQ(ss_received.str(), test_message);
+}
+
+TEST_F(UdpSocketTestFixture, receive_large_datagram)
+{
+    // Datagrams larger than the previous fixed 1024 byte buffer are received whole.
+    const std::string test_message(8000, 'x');
+    sender_socket.send_string(test_message);
+    const auto datagram = receiver_socket.receive_datagram();
+    EXPECT_EQ(datagram.size(), test_message.size());
+    EXPECT_EQ(std::string(datagram.data(), datagram.size()), test_message);
+}
+
 TEST_F(UdpSocketTestFixture, receive_timeout)
 {
     // Expect timeout after 100 msec.
@@ -85,6 +103,8 @@ TEST_F(UdpSocketTestFixture, receive_timeout)
     char buffer[1024];
     const int num_bytes_received = receiver_socket.receive_bytes(buffer, 1024);
     EXPECT_EQ(num_bytes_received, SOCKET_ERROR);
+
+    EXPECT_EQ(receiver_socket.receive_datagram().size(), 0);
 }
 
 TEST_F(UdpSocketTestFixture, dynamic_tx_port_discovery)
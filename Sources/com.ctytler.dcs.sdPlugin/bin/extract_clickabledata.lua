@@ -1,4 +1,6 @@
 -- Calling script must define dcs_install_path and module_name as global variables.
+-- Returns an array of records, one for each clickable element class, with fields:
+--   device, device_id, button_id, element, type, dcs_id, click_value, limit_min, limit_max, description
 -- Examples below:
         -- dcs_install_path = [[C:\Program Files\Eagle Dynamics\DCS World OpenBeta]]
         -- module_name = "A-10C"
@@ -87,12 +89,9 @@ end
 
 function get_index_value(table, index)
 	if (table ~= nil) then
-        value = table[index]
-        if (value ~= nil) then
-            return value
-        end
+        return table[index]
 	end
-	return ""
+	return nil
 end
 
 function collect_element_attributes(elements)
@@ -120,12 +119,12 @@ function collect_element_attributes(elements)
 			local gain = get_index_value(gains,idx)
 			
 			-- For LEV and MOVABLE_LEV types, use gain as the click value if available
-			if (class == 4 or class == 5) and (gain ~= nil and gain ~= "") then
+			if (class == 4 or class == 5) and (gain ~= nil) then
 				arg_value = gain
 			end
 			
-			local arg_lim1 = ""
-			local arg_lim2 = ""
+			local arg_lim1 = nil
+			local arg_lim2 = nil
 			if (arg_lim ~= nil) then
 				if (type(arg_lim) == "table") then
 					arg_lim1 = arg_lim[1]
@@ -140,12 +139,20 @@ function collect_element_attributes(elements)
 					arg_lim1 = arg_lim
 				end
 			end
-            if (device_id == nil) then
-                device_id = "" 
-            end
+			-- Attributes which are not defined by the module are left out of the record.
 			count = count + 1
-			collected_element_attributes[count] = string.format('%s(%s),%s,%s,%s,%s,%s,%s,%s,%s',
-					device_name, device_id, command_id, element_name, class_name, arg, arg_value, arg_lim1, arg_lim2, hint)
+			collected_element_attributes[count] = {
+				device = device_name,
+				device_id = device_id,
+				button_id = command_id,
+				element = element_name,
+				type = class_name,
+				dcs_id = arg,
+				click_value = arg_value,
+				limit_min = arg_lim1,
+				limit_max = arg_lim2,
+				description = hint
+			}
 		end
 	end
 	return collected_element_attributes
@@ -181,5 +188,5 @@ function load_module(module_name)
 	return element_list
 end
 
-list = load_module(module_name)
-return table.unpack(list)
\ No newline at end of file
+-- Return the list of element records as a single table, which avoids the Lua stack size limit on number of elements.
+return load_module(module_name)
\ No newline at end of file
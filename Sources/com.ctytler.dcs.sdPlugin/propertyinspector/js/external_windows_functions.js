@@ -113,6 +113,12 @@ function sendToIdLookupWindowClickabledata(clickabledata_elements) {
     }
 }
 
+function sendToIdLookupWindowIndexProgress(progress) {
+    if (window.idLookupWindow && !window.idLookupWindow.closed) {
+        window.idLookupWindow.gotClickabledataIndexProgress(progress);
+    }
+}
+
 function sendToConfigWindow(payload) {
     if (window.configWindow) {
         window.configWindow.handlePropInspectorMessage(payload);
@@ -132,6 +132,20 @@ function callbackRequestIdLookup(clear_search=false) {
 }
 
 
+/**
+ * Displays progress of the plugin indexing the clickabledata of all installed modules in the background.
+ *
+ * @param {Json} progress Object with the number of modules "completed" out of "total".
+ */
+function gotClickabledataIndexProgress(progress) {
+    var progress_elem = document.getElementById("clickabledata_index_progress");
+    if (progress.completed < progress.total) {
+        progress_elem.textContent = "Indexing modules: " + progress.completed + " / " + progress.total;
+    } else {
+        progress_elem.textContent = "All " + progress.total + " modules indexed";
+    }
+}
+
 /**
  * Sets the drop-down "select_module" to a specific module name.
  * 
@@ -173,6 +187,26 @@ function clearSearchQuery() {
     window.opener.global_settings["last_search_query"] = "";
 }
 
+/**
+ * Returns the table cell text of a clickabledata element record, with missing attributes left blank.
+ *
+ * @param {Json} element Clickabledata element record received from the plugin.
+ */
+function clickabledataCells(element) {
+    const text = (value) => (value === undefined || value === null) ? "" : String(value);
+    return [
+        text(element.device) + "(" + text(element.device_id) + ")", // Device
+        text(element.button_id),   // Button ID
+        text(element.element),     // Element
+        text(element.type),        // Type
+        text(element.dcs_id),      // DCS ID
+        text(element.click_value), // Click Value
+        text(element.limit_min),   // Limit Min
+        text(element.limit_max),   // Limit Max
+        text(element.description)  // Description
+    ];
+}
+
 /**
  * Populates table with clickabledata elements in each row, sorted by column values.
  * 
@@ -182,19 +216,18 @@ function gotClickabledata(clickabledata_elements) {
     if (clickabledata_elements.length > 0) {
         // Create rows in a new table body so it is easy to replace any old content.
         var new_table_body = document.createElement('tbody');
-        clickabledata_elements.sort();
-        for (const element of clickabledata_elements) {
-            var split_elem = element.split(',');
+        // Sort rows by their cell text, column by column starting with the device.
+        var rows = clickabledata_elements.map(clickabledataCells);
+        rows.sort((a, b) => {
+            const a_key = a.join(',');
+            const b_key = b.join(',');
+            return (a_key < b_key) ? -1 : ((a_key > b_key) ? 1 : 0);
+        });
+        for (const cells of rows) {
             var new_row = new_table_body.insertRow();
-            new_row.insertCell(0).appendChild(document.createTextNode(split_elem[0])); // Device
-            new_row.insertCell(1).appendChild(document.createTextNode(split_elem[1])); // Button ID
-            new_row.insertCell(2).appendChild(document.createTextNode(split_elem[2])); // Element
-            new_row.insertCell(3).appendChild(document.createTextNode(split_elem[3])); // Type
-            new_row.insertCell(4).appendChild(document.createTextNode(split_elem[4])); // DCS ID
-            new_row.insertCell(5).appendChild(document.createTextNode(split_elem[5])); // Click Value
-            new_row.insertCell(6).appendChild(document.createTextNode(split_elem[6])); // Limit Min
-            new_row.insertCell(7).appendChild(document.createTextNode(split_elem[7])); // Limit Max
-            new_row.insertCell(8).appendChild(document.createTextNode(split_elem[8])); // Description
+            for (var i = 0; i < cells.length; i++) {
+                new_row.insertCell(i).appendChild(document.createTextNode(cells[i]));
+            }
             new_row.addEventListener('click', function () { selectRow(this) });
         }
         var document_table_body = document.getElementById("clickabledata_table").getElementsByTagName('tbody')[0];
@@ -48,6 +48,10 @@ function callbackReceivedPayloadFromPlugin(payload) {
     sendToIdLookupWindowClickabledata(payload.clickabledata);
   }
 
+  if (payload.event == "ClickabledataIndexProgress") {
+    sendToIdLookupWindowIndexProgress(payload);
+  }
+
   if (payload.event == "ModuleList") {
     console.log("Sending module list");
     configWindowChannel.postMessage({
@@ -42,13 +42,23 @@ interface ControlOutputString {
   type: "string"
 }
 
+// Page of the controls of a module which match a search query, best match first.
+interface ControlReferenceSearchResults {
+  filename: string,
+  query: string,
+  total: number,
+  offset: number,
+  items: Array<ControlData>,
+}
+
 export type {
   ModuleControlsJson,
   ControlCategory,
   ControlData,
   ControlInput,
   ControlOutputInteger,
-  ControlOutputString
+  ControlOutputString,
+  ControlReferenceSearchResults
 }
 
 
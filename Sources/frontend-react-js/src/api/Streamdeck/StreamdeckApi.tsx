@@ -5,7 +5,7 @@
  * 
  */
 
-import { ModuleControlsJson } from "../DcsBios/ControlReferenceInterface";
+import { ControlReferenceSearchResults, ModuleControlsJson } from "../DcsBios/ControlReferenceInterface";
 
 export default interface StreamdeckApi {
     commFns: StreamdeckCommFns;
@@ -13,6 +13,7 @@ export default interface StreamdeckApi {
     globalSettings: StreamdeckGlobalSettings;
     moduleList: string[];
     moduleControlRefs: ModuleControlsJson | undefined;
+    controlReferenceSearchResults: ControlReferenceSearchResults | undefined;
 }
 
 export interface StreamdeckCommFns {
@@ -37,6 +38,8 @@ export interface StreamdeckCommFns {
     requestModuleList(path: string): void,
     // Request reference data for an individual module.
     requestModule(filename: string): void,
+    // Request a page of the controls of a module which match a search query.
+    searchControlReference(filename: string, query: string, offset: number, limit: number): void,
 }
 
 export interface StreamdeckButtonSettings {
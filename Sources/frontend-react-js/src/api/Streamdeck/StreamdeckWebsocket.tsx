@@ -1,6 +1,6 @@
 import { useState, useEffect, useRef } from 'react';
 import StreamdeckApi, { defaultButtonSettings, defaultGlobalSettings, StreamdeckButtonSettings, StreamdeckCommFns } from './StreamdeckApi';
-import { ModuleControlsJson } from '../DcsBios/ControlReferenceInterface';
+import { ControlData, ControlReferenceSearchResults, ModuleControlsJson } from '../DcsBios/ControlReferenceInterface';
 
 export interface StreamdeckSocketSettings {
     port: number,
@@ -25,6 +25,7 @@ export function useStreamdeckWebsocket(socketSettings: StreamdeckSocketSettings)
     const [globalSettings, setGlobalSettingsState] = useState(defaultGlobalSettings());
     const [moduleList, setModuleList] = useState<string[]>(["No modules found..."]);
     const [moduleControlRefs, setModuleControlRefs] = useState<ModuleControlsJson>();
+    const [controlReferenceSearchResults, setControlReferenceSearchResults] = useState<ControlReferenceSearchResults>();
     const websocket = useRef<WebSocket | null>(null);
 
     // Protocol to send messages to the Streamdeck application.
@@ -102,6 +103,10 @@ export function useStreamdeckWebsocket(socketSettings: StreamdeckSocketSettings)
             sendToPlugin({ event: "requestControlReferenceJson", filename: filename });
             send('logMessage', { payload: { message: "[ConfigWindow] Send message to plugin: (requestControlReferenceJson) at " + filename } });
         },
+
+        searchControlReference: function (filename: string, query: string, offset: number, limit: number) {
+            sendToPlugin({ event: "SearchControlReference", filename: filename, query: query, offset: offset, limit: limit });
+        },
     };
 
     // This message registers this Websocket binding as the Property Inspector
@@ -125,6 +130,11 @@ export function useStreamdeckWebsocket(socketSettings: StreamdeckSocketSettings)
         settings?: Record<string, string>,
         moduleList?: string[],
         jsonFile?: ModuleControlsJson,
+        filename?: string,
+        query?: string,
+        total?: number,
+        offset?: number,
+        items?: ControlData[],
     }
 
     function onReceivedMessage(msg: string) {
@@ -165,6 +175,15 @@ export function useStreamdeckWebsocket(socketSettings: StreamdeckSocketSettings)
                     case "JsonFile":
                         if (msg.payload.jsonFile) { setModuleControlRefs(msg.payload.jsonFile); }
                         break;
+                    case "ControlReferenceSearchResults":
+                        setControlReferenceSearchResults({
+                            filename: msg.payload.filename || "",
+                            query: msg.payload.query || "",
+                            total: msg.payload.total || 0,
+                            offset: msg.payload.offset || 0,
+                            items: msg.payload.items || [],
+                        });
+                        break;
                     case "DebugDcsGameState":
                         // Do Nothing.
                         break;
@@ -212,7 +231,7 @@ export function useStreamdeckWebsocket(socketSettings: StreamdeckSocketSettings)
         }
     }, []);
 
-    return { commFns, buttonSettings, globalSettings, moduleList, moduleControlRefs } as const;
+    return { commFns, buttonSettings, globalSettings, moduleList, moduleControlRefs, controlReferenceSearchResults } as const;
 }
 
 /**
@@ -7,7 +7,7 @@ import SelectedControlRef from "../modals/SelectedControlRef";
 import Table from "./Table";
 import SearchBar from "./SearchBar";
 import { ControlData } from "../api/DcsBios/ControlReferenceInterface";
-import { flattenModuleControlsJson, getModuleName } from "../api/DcsBios/Utilities";
+import { getModuleName } from "../api/DcsBios/Utilities";
 
 import StreamdeckApi from "../api/Streamdeck/StreamdeckApi";
 
@@ -15,22 +15,28 @@ interface Props {
   sdApi: StreamdeckApi;
 }
 
+// Number of controls requested per page of search results.
+const PAGE_SIZE = 50;
+// Delay after the last change of the search query before it is sent to the plugin.
+const SEARCH_DEBOUNCE_MS = 200;
+
 function DcsBiosIdLookup({ sdApi }: Props): JSX.Element {
   /******* Internal State  *******/
   /*
    ** Internal State
    */
-  const [fullModuleControlRefs, setFullModuleControlRefs] = useState<ControlData[]>([]); // eslint-disable-line @typescript-eslint/no-unused-vars
   const [selectedModule, setSelectedModule] = useState(sdApi.globalSettings.last_selected_module);
   const [searchQuery, setSearchQuery] = useState("");
+  const [pageOffset, setPageOffset] = useState(0);
   const [selectedControlReference, setSelectedControlReference] = useState<ControlData | null>(null);
 
-  const filteredControlRefs = fullModuleControlRefs.filter(
-    (control) =>
-      control.category.toUpperCase().includes(searchQuery) ||
-      control.identifier.toUpperCase().includes(searchQuery) ||
-      control.description.toUpperCase().includes(searchQuery)
-  );
+  // The plugin searches the module's control reference and answers with one page of results, so results of another
+  // module are never shown while a search is pending.
+  const searchResults = sdApi.controlReferenceSearchResults;
+  const isModuleSearched = searchResults !== undefined && searchResults.filename === selectedModule;
+  const controlRefs = isModuleSearched ? searchResults.items : [];
+  const totalResults = isModuleSearched ? searchResults.total : 0;
+  const resultsOffset = isModuleSearched ? searchResults.offset : 0;
 
   /*
    ** Handlers
@@ -47,15 +53,20 @@ function DcsBiosIdLookup({ sdApi }: Props): JSX.Element {
     setSelectedModule(sdApi.globalSettings.last_selected_module || sdApi.moduleList[0])
   }, [sdApi.moduleList])
 
+  // A new module or query starts again from the first page.
   useEffect(() => {
-    sdApi.commFns.requestModule(selectedModule);
-  }, [selectedModule])
+    setPageOffset(0);
+  }, [selectedModule, searchQuery])
 
   useEffect(() => {
-    if (sdApi.moduleControlRefs) {
-      setFullModuleControlRefs(flattenModuleControlsJson(sdApi.moduleControlRefs));
+    if (!selectedModule) {
+      return;
     }
-  }, [sdApi.moduleControlRefs])
+    const timer = setTimeout(() => {
+      sdApi.commFns.searchControlReference(selectedModule, searchQuery, pageOffset, PAGE_SIZE);
+    }, SEARCH_DEBOUNCE_MS);
+    return () => clearTimeout(timer);
+  }, [selectedModule, searchQuery, pageOffset])
 
 
   /*
@@ -71,6 +82,23 @@ function DcsBiosIdLookup({ sdApi }: Props): JSX.Element {
     return null;
   }
 
+  function ShowPageControls() {
+    if (totalResults <= PAGE_SIZE) {
+      return null;
+    }
+    return (
+      <div className={classes.paging}>
+        <button onClick={() => setPageOffset(Math.max(0, resultsOffset - PAGE_SIZE))} disabled={resultsOffset === 0}>
+          Previous
+        </button>
+        <span>{resultsOffset + 1}-{resultsOffset + controlRefs.length} of {totalResults}</span>
+        <button onClick={() => setPageOffset(resultsOffset + PAGE_SIZE)} disabled={resultsOffset + PAGE_SIZE >= totalResults}>
+          Next
+        </button>
+      </div>
+    );
+  }
+
   return (
     <div className={classes.main}>
       <SearchBar
@@ -81,11 +109,12 @@ function DcsBiosIdLookup({ sdApi }: Props): JSX.Element {
         sdApi={sdApi}
       />
       <Table
-        tableData={filteredControlRefs}
-        // Still show empty table if filtered set is empty, but full set is not.
-        isDataLoaded={fullModuleControlRefs.length > 0}
+        tableData={controlRefs}
+        // Still show empty table if no controls match the query, once the module has been searched.
+        isDataLoaded={isModuleSearched}
         getSelectedControlData={handleControlReferenceSelect}
       />
+      <ShowPageControls />
       <ShowSelectedControlRef />
     </div>
   );
@@ -1,5 +1,6 @@
 import { useEffect, useState, useCallback, useRef } from "react";
 import { ActionInfo, SocketSettings } from "../types/StreamDeckTypes";
+import { ClickabledataSearchResults } from "../windows/IdLookupWindow";
 
 /**
  * Simplified Stream Deck Property Inspector hook
@@ -101,7 +102,7 @@ export function usePropertyInspector<T extends Record<string, unknown>>(): UsePr
           if (jsonObj.event === "sendToPropertyInspector") {
             const payload = jsonObj.payload;
             
-            // Forward InstalledModules and Clickabledata to IdLookupWindow
+            // Forward InstalledModules and ClickabledataSearchResults to IdLookupWindow
             // Suit exactement le pattern de sendToIdLookupWindowInstalledModules() et sendToIdLookupWindowClickabledata()
             if (payload.event === "InstalledModules" && payload.installed_modules) {
               if (window.idLookupWindow && !window.idLookupWindow.closed) {
@@ -114,13 +115,13 @@ export function usePropertyInspector<T extends Record<string, unknown>>(): UsePr
               }
             }
             
-            if (payload.event === "Clickabledata" && payload.clickabledata) {
+            if (payload.event === "ClickabledataSearchResults" && payload.items) {
               if (window.idLookupWindow && !window.idLookupWindow.closed) {
                 const idLookupWin = window.idLookupWindow as Window & { 
-                  gotClickabledata?: (data: string[]) => void 
+                  gotClickabledataSearchResults?: (results: ClickabledataSearchResults) => void 
                 };
-                if (idLookupWin.gotClickabledata) {
-                  idLookupWin.gotClickabledata(payload.clickabledata);
+                if (idLookupWin.gotClickabledataSearchResults) {
+                  idLookupWin.gotClickabledataSearchResults(payload as ClickabledataSearchResults);
                 }
               }
             }
@@ -191,7 +192,7 @@ export function usePropertyInspector<T extends Record<string, unknown>>(): UsePr
     websocketRef.current.send(JSON.stringify(json));
   }, [connected, context, actionUUID]);
 
-  // Send to plugin for global operations (RequestInstalledModules, RequestIdLookup)
+  // Send to plugin for global operations (RequestInstalledModules, SearchClickabledata)
   // Uses Property Inspector UUID instead of action context - matches original JavaScript behavior
   const sendToPluginGlobal = useCallback((payload: Record<string, unknown>) => {
     if (!websocketRef.current || !connected) {
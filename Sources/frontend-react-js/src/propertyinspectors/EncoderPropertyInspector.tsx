@@ -2,6 +2,7 @@ import React, { useEffect, useState, useCallback } from "react";
 import { usePropertyInspector } from "../hooks/usePropertyInspector";
 import { EncoderSettings } from "../types/PropertyInspectorTypes";
 import { ExternalWindowCallback, GlobalSettings } from "../types/StreamDeckTypes";
+import { ClickabledataSearchRequest } from "../windows/IdLookupWindow";
 import { ValueMappingList } from "../components/ValueMappingList";
 import { ValueMappingData } from "../components/ValueMappingRow";
 import styles from "./CommonPropertyInspector.module.css";
@@ -120,18 +121,22 @@ const EncoderPropertyInspector: React.FC = () => {
         });
       }
 
-      // Handle RequestIdLookup - forward to plugin
-      if (parameter.event === "RequestIdLookup" && parameter.payload) {
+      // Handle SearchClickabledata - forward to plugin
+      if (parameter.event === "SearchClickabledata" && parameter.payload) {
         if (!connected) {
-          console.error("Cannot send RequestIdLookup: not connected to Stream Deck");
+          console.error("Cannot send SearchClickabledata: not connected to Stream Deck");
           return;
         }
-        const payload = parameter.payload as { dcs_install_path: string; dcs_savedgames_path?: string; module: string };
+        const payload = parameter.payload as ClickabledataSearchRequest;
         sendToPluginGlobal({
-          event: "RequestIdLookup",
+          event: "SearchClickabledata",
           dcs_install_path: payload.dcs_install_path,
           dcs_savedgames_path: payload.dcs_savedgames_path || "",
           module: payload.module,
+          query: payload.query,
+          offset: payload.offset,
+          limit: payload.limit,
+          refresh: payload.refresh,
         });
       }
 
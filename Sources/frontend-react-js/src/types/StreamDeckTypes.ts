@@ -2,7 +2,7 @@
  * Common Stream Deck types used across the application
  */
 
-import { ClickableDataRow } from '../windows/IdLookupWindow';
+import { ClickableDataRow, ClickabledataSearchResults } from '../windows/IdLookupWindow';
 
 // Stream Deck WebSocket message types
 export interface StreamDeckMessage {
@@ -83,7 +83,7 @@ export interface WindowRefs {
 // Extended window interface for ID Lookup window with callbacks
 export interface IdLookupWindowExt extends Window {
   gotInstalledModules?: (modulesList: string[]) => void;
-  gotClickabledata?: (data: string[]) => void;  // C++ sends array of comma-separated strings
+  gotClickabledataSearchResults?: (results: ClickabledataSearchResults) => void;  // C++ sends one page of matching records
 }
 
 // Property Inspector window interface (for window.opener)
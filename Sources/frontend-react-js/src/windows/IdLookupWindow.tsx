@@ -5,7 +5,7 @@
  * sans ajouter de complexité inutile.
  */
 
-import { useState, useEffect } from "react";
+import { useState, useEffect, useRef } from "react";
 import styles from "./IdLookupWindow.module.css";
 
 // Types pour la communication avec window.opener
@@ -35,14 +35,71 @@ export interface ClickableDataRow {
   description: string;
 }
 
+// Clickabledata element record as sent by the C++ plugin, attributes not defined by the module are omitted.
+// Integer attributes are numbers, and float attributes are strings as formatted by Lua (e.g. "1.0").
+export interface ClickabledataElement {
+  device?: string;
+  device_id?: number | string;
+  button_id?: number | string;
+  element?: string;
+  type?: string;
+  dcs_id?: number | string;
+  click_value?: number | string;
+  limit_min?: number | string;
+  limit_max?: number | string;
+  description?: string;
+}
+
+// Query of a module's clickabledata, answered by the C++ plugin with one page of matching element records.
+export interface ClickabledataSearchRequest {
+  dcs_install_path: string;
+  dcs_savedgames_path?: string;
+  module: string;
+  query: string;
+  offset: number;
+  limit: number;
+  refresh: boolean; // Index the module again, e.g. after it was updated.
+}
+
+// Page of matching element records as sent by the C++ plugin, best match first.
+export interface ClickabledataSearchResults {
+  module: string;
+  query: string;
+  total: number;
+  offset: number;
+  items: ClickabledataElement[];
+}
+
 // Étendre Window pour les callbacks
 declare global {
   interface Window {
     gotInstalledModules?: (modulesList: string[]) => void;
-    gotClickabledata?: (data: string[]) => void;
+    gotClickabledataSearchResults?: (results: ClickabledataSearchResults) => void;
   }
 }
 
+// Number of elements requested per page of search results.
+const PAGE_SIZE = 50;
+// Delay after the last change of the search query before it is sent to the plugin.
+const SEARCH_DEBOUNCE_MS = 200;
+
+// Convert a typed element record to a table row, missing attributes are left blank.
+const toClickableDataRow = (element: ClickabledataElement): ClickableDataRow => {
+  const text = (value: number | string | undefined) => (value === undefined || value === null ? "" : String(value));
+  return {
+    device: `${text(element.device)}(${text(element.device_id)})`,
+    device_id: text(element.device_id),
+    button_id: text(element.button_id),
+    element: text(element.element),
+    type: text(element.type),
+    dcs_id: text(element.dcs_id),
+    click_value: text(element.click_value),
+    limit_min: text(element.limit_min),
+    limit_max: text(element.limit_max),
+    description: text(element.description),
+  };
+};
+
 const IdLookupWindow: React.FC = () => {
   // États basés sur le DOM du HTML original
   const [dcsInstallPath, setDcsInstallPath] = useState("C:\\Program Files\\Eagle Dynamics\\DCS World");
@@ -50,8 +107,22 @@ const IdLookupWindow: React.FC = () => {
   const [modules, setModules] = useState<string[]>([]);
   const [selectedModule, setSelectedModule] = useState("");
   const [searchQuery, setSearchQuery] = useState("");
-  const [clickableData, setClickableData] = useState<ClickableDataRow[]>([]);
+  const [pageOffset, setPageOffset] = useState(0);
+  const [searchResults, setSearchResults] = useState<{
+    module: string;
+    total: number;
+    offset: number;
+    rows: ClickableDataRow[];
+  } | null>(null);
   const [selectedRow, setSelectedRow] = useState<ClickableDataRow | null>(null);
+  // Set when a module is selected, so its first search indexes it again.
+  const refreshNextSearch = useRef(true);
+
+  // Results of another module are never shown while a search of the selected module is pending.
+  const isModuleSearched = searchResults !== null && searchResults.module === selectedModule;
+  const clickableData = isModuleSearched ? searchResults.rows : [];
+  const totalResults = isModuleSearched ? searchResults.total : 0;
+  const resultsOffset = isModuleSearched ? searchResults.offset : 0;
 
   /**
    * Équivalent de sendmessage() du code original
@@ -106,31 +177,55 @@ const IdLookupWindow: React.FC = () => {
 
   /**
    * Équivalent de callbackRequestIdLookup() du code original
+   * Selecting a module clears the search, the module is then searched by the effect below
    */
-  const requestIdLookup = (clearSearch = false, moduleOverride?: string) => {
-    setClickableData([]);
+  const selectModule = (module: string) => {
+    setSelectedModule(module);
     setSelectedRow(null);
-    
-    if (clearSearch) {
-      setSearchQuery("");
-      if (window.opener) {
-        const opener = window.opener as OpenerWindow;
-        opener.global_settings.last_search_query = "";
+    setSearchQuery("");
+    refreshNextSearch.current = true;
+
+    if (window.opener) {
+      const opener = window.opener as OpenerWindow;
+      if (module) {
+        opener.global_settings.last_selected_module = module;
       }
+      opener.global_settings.last_search_query = "";
+      sendMessage("UpdateGlobalSettings", opener.global_settings);
     }
+  };
 
-    const moduleToUse = moduleOverride || selectedModule;
-    if (moduleToUse) {
-      const payload = {
+  /**
+   * A new module or query starts again from the first page
+   */
+  useEffect(() => {
+    setPageOffset(0);
+  }, [selectedModule, searchQuery]);
+
+  /**
+   * Requests a page of the selected module's clickabledata matching the query, once typing pauses
+   */
+  useEffect(() => {
+    if (!selectedModule) {
+      return;
+    }
+    const timer = setTimeout(() => {
+      const request: ClickabledataSearchRequest = {
         dcs_install_path: dcsInstallPath,
         dcs_savedgames_path: dcsSavedGamesPath,
-        module: moduleToUse,
+        module: selectedModule,
+        query: searchQuery,
+        offset: pageOffset,
+        limit: PAGE_SIZE,
+        refresh: refreshNextSearch.current,
       };
-      sendMessage("RequestIdLookup", payload);
-    }
-
-    updateGlobalSettings();
-  };
+      refreshNextSearch.current = false;
+      sendMessage("SearchClickabledata", request);
+    }, SEARCH_DEBOUNCE_MS);
+    return () => clearTimeout(timer);
+    // Paths are only used once a module is selected, so editing them does not search
+    // eslint-disable-next-line
+  }, [selectedModule, searchQuery, pageOffset]);
 
   /**
    * Équivalent de modifyInstalledModulesList() du code original
@@ -152,21 +247,6 @@ const IdLookupWindow: React.FC = () => {
     return modified;
   };
 
-  /**
-   * Filtre les données clickable selon la recherche
-   */
-  const filteredClickableData = clickableData.filter((row) => {
-    if (!searchQuery) return true;
-    
-    const query = searchQuery.toLowerCase();
-    return (
-      row.device.toLowerCase().includes(query) ||
-      row.element.toLowerCase().includes(query) ||
-      row.dcs_id.toLowerCase().includes(query) ||
-      row.description.toLowerCase().includes(query)
-    );
-  });
-
   /**
    * Gestionnaire de sélection de ligne
    */
@@ -287,49 +367,22 @@ const IdLookupWindow: React.FC = () => {
       const lastModule = opener.global_settings.last_selected_module || "";
       const lastQuery = opener.global_settings.last_search_query || "";
       
-      if (lastModule) {
+      // The last module is searched with the last query once selected, keeping the search query
+      if (lastModule && modified.includes(lastModule)) {
+        refreshNextSearch.current = true;
         setSelectedModule(lastModule);
       }
       setSearchQuery(lastQuery);
-      
-      // Trigger requestIdLookup automatically if we had a last module
-      // clear_search=false to keep the search query
-      // Use captured paths from closure to avoid React state timing issues
-      if (lastModule && modified.includes(lastModule)) {
-        const payload = {
-          dcs_install_path: installPath,
-          dcs_savedgames_path: savedGamesPath,
-          module: lastModule,
-        };
-        sendMessage("RequestIdLookup", payload);
-      }
     };
 
-    // Exposer gotClickabledata pour que le Property Inspector puisse l'appeler
-    window.gotClickabledata = (data: string[]) => {
-      // Parser les données (format CSV)
-      const parsed = data.map((element: string) => {
-        const parts = element.split(',');
-        const deviceStr = parts[0] || "";
-        const deviceId = deviceStr.includes('(') && deviceStr.includes(')')
-          ? deviceStr.split('(').pop()?.split(')')[0] || ""
-          : "";
-
-        return {
-          device: deviceStr,
-          device_id: deviceId,
-          button_id: parts[1] || "",
-          element: parts[2] || "",
-          type: parts[3] || "",
-          dcs_id: parts[4] || "",
-          click_value: parts[5] || "",
-          limit_min: parts[6] || "",
-          limit_max: parts[7] || "",
-          description: parts[8] || "",
-        };
+    // Exposer gotClickabledataSearchResults pour que le Property Inspector puisse l'appeler
+    window.gotClickabledataSearchResults = (results: ClickabledataSearchResults) => {
+      setSearchResults({
+        module: results.module,
+        total: results.total,
+        offset: results.offset,
+        rows: results.items.map(toClickableDataRow),
       });
-
-      setClickableData(parsed);
     };
 
     // Demander les modules au démarrage si les chemins sont déjà configurés
@@ -343,7 +396,7 @@ const IdLookupWindow: React.FC = () => {
     // Cleanup
     return () => {
       delete window.gotInstalledModules;
-      delete window.gotClickabledata;
+      delete window.gotClickabledataSearchResults;
     };
     // sendMessage is stable
     // eslint-disable-next-line
@@ -389,13 +442,7 @@ const IdLookupWindow: React.FC = () => {
           <select
             id="moduleSelect"
             value={selectedModule}
-            onChange={(e) => {
-              setSelectedModule(e.target.value);
-              // Auto-request when module changes
-              if (e.target.value) {
-                setTimeout(() => requestIdLookup(true), 50);
-              }
-            }}
+            onChange={(e) => selectModule(e.target.value)}
             className={styles.moduleSelect}
           >
             <option value="">-- Select Module --</option>
@@ -439,18 +486,18 @@ const IdLookupWindow: React.FC = () => {
             </tr>
           </thead>
           <tbody>
-            {filteredClickableData.length === 0 ? (
+            {clickableData.length === 0 ? (
               <tr>
                 <td colSpan={9} className={styles.noData}>
                   {selectedModule
-                    ? searchQuery
+                    ? isModuleSearched && searchQuery
                       ? "No results matching your search"
                       : "Loading clickable data..."
                     : "Select a module to view clickable data"}
                 </td>
               </tr>
             ) : (
-              filteredClickableData.map((row, index) => (
+              clickableData.map((row, index) => (
                 <tr
                   key={index}
                   onClick={() => handleRowClick(row)}
@@ -472,6 +519,18 @@ const IdLookupWindow: React.FC = () => {
         </table>
       </div>
 
+      {totalResults > PAGE_SIZE && (
+        <div className={styles.paging}>
+          <button onClick={() => setPageOffset(Math.max(0, resultsOffset - PAGE_SIZE))} disabled={resultsOffset === 0}>
+            Previous
+          </button>
+          <span>{resultsOffset + 1}-{resultsOffset + clickableData.length} of {totalResults}</span>
+          <button onClick={() => setPageOffset(resultsOffset + PAGE_SIZE)} disabled={resultsOffset + PAGE_SIZE >= totalResults}>
+            Next
+          </button>
+        </div>
+      )}
+
       {selectedRow && (
         <div className={styles.importSection}>
           <h3>Import Selection to:</h3>
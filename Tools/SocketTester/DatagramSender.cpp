@@ -0,0 +1,75 @@
+// Copyright 2026 Charles Tytler
+
+#include "DatagramSender.h"
+
+#include <cstring>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <WS2tcpip.h>
+#include <winsock2.h>
+#pragma comment(lib, "Ws2_32.lib")
+#else
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#define INVALID_SOCKET (-1)
+#define closesocket close
+#endif
+
+DatagramSender::DatagramSender(const std::string &ip_address, const std::string &port)
+{
+#ifdef _WIN32
+    WSADATA wsaData;
+    if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) {
+        throw std::runtime_error("Could not startup Windows socket library");
+    }
+#endif
+    addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_DGRAM;
+    addrinfo *destination;
+    if (getaddrinfo(ip_address.c_str(), port.c_str(), &hints, &destination) != 0) {
+        throw std::runtime_error("Could not get valid address info from requested IP: " + ip_address + " Port: " + port);
+    }
+    static_assert(sizeof(sockaddr_in) <= sizeof(dest_addr_), "Destination storage too small for IPv4 address");
+    memcpy(dest_addr_, destination->ai_addr, sizeof(sockaddr_in));
+    freeaddrinfo(destination);
+
+    socket_id_ = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (socket_id_ == INVALID_SOCKET) {
+        throw std::runtime_error("Could not open UDP socket");
+    }
+
+    // Multicast addresses are 224.0.0.0 to 239.255.255.255.
+    const auto dest_ip = ntohl(reinterpret_cast<const sockaddr_in *>(dest_addr_)->sin_addr.s_addr);
+    is_multicast_ = (dest_ip >> 28) == 0xE;
+    if (is_multicast_) {
+        const int ttl = 1;
+        const int loop = 1;
+        setsockopt(socket_id_, IPPROTO_IP, IP_MULTICAST_TTL, reinterpret_cast<const char *>(&ttl), sizeof(ttl));
+        setsockopt(socket_id_, IPPROTO_IP, IP_MULTICAST_LOOP, reinterpret_cast<const char *>(&loop), sizeof(loop));
+    }
+}
+
+DatagramSender::~DatagramSender()
+{
+    closesocket(socket_id_);
+#ifdef _WIN32
+    WSACleanup();
+#endif
+}
+
+bool DatagramSender::send(const std::string &datagram)
+{
+    const auto num_bytes_sent = sendto(socket_id_,
+                                       datagram.data(),
+                                       static_cast<int>(datagram.size()),
+                                       0,
+                                       reinterpret_cast<const sockaddr *>(dest_addr_),
+                                       sizeof(sockaddr_in));
+    return num_bytes_sent == static_cast<decltype(num_bytes_sent)>(datagram.size());
+}
@@ -0,0 +1,44 @@
+// Copyright 2026 Charles Tytler
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Sends UDP datagrams to a fixed unicast or multicast destination.
+ *
+ *   Unlike UdpSocket, the sender does not bind a receive port and builds on both Windows and POSIX systems, so the load
+ *   generator can be run from any machine on the network.
+ */
+class DatagramSender
+{
+  public:
+    /**
+     * @brief Opens a socket to send to the destination. Multicast destinations are sent with a TTL of 1 and loopback
+     * enabled, so that a plugin on the same machine receives them.
+     * @throws std::runtime_error if the destination is invalid or the socket cannot be opened.
+     */
+    DatagramSender(const std::string &ip_address, const std::string &port);
+    ~DatagramSender();
+
+    DatagramSender(const DatagramSender &) = delete;
+    DatagramSender &operator=(const DatagramSender &) = delete;
+
+    /**
+     * @brief Sends a single datagram.
+     * @return True if the datagram was accepted by the network stack.
+     */
+    bool send(const std::string &datagram);
+
+    bool is_multicast() const { return is_multicast_; }
+
+  private:
+#ifdef _WIN32
+    uintptr_t socket_id_;
+#else
+    int socket_id_;
+#endif
+    bool is_multicast_ = false;
+    alignas(8) char dest_addr_[16] = {0}; // Storage for the IPv4 sockaddr_in of the destination.
+};
@@ -0,0 +1,211 @@
+// Copyright 2026 Charles Tytler
+
+#include "LoadGenerator.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+
+namespace
+{
+constexpr unsigned int WORDS_PER_STRING = DcsBiosLoadGenerator::STRING_LENGTH / 2;
+constexpr size_t BLOCK_HEADER_SIZE = 4; // Address and count words of each write.
+constexpr const char *EXPORT_SCRIPT_HEADER = "File*";
+
+/**
+ * @brief Picks count distinct indices in [0, range) at random.
+ */
+std::vector<size_t> pick_indices(std::mt19937 &random, const size_t range, const size_t count)
+{
+    // Partial Fisher-Yates shuffle, drawing without replacement so no index is picked twice.
+    std::vector<size_t> indices(range);
+    std::iota(indices.begin(), indices.end(), 0);
+    const size_t num_picked = std::min(count, range);
+    for (size_t i = 0; i < num_picked; i++) {
+        std::uniform_int_distribution<size_t> distribution(i, range - 1);
+        std::swap(indices[i], indices[distribution(random)]);
+    }
+    indices.resize(num_picked);
+    return indices;
+}
+
+std::string random_text(std::mt19937 &random, const size_t length)
+{
+    static const char charset[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 -.";
+    std::uniform_int_distribution<size_t> distribution(0, sizeof(charset) - 2);
+    std::string text(length, ' ');
+    for (auto &c : text) {
+        c = charset[distribution(random)];
+    }
+    return text;
+}
+} // namespace
+
+DcsBiosLoadGenerator::DcsBiosLoadGenerator(const LoadGeneratorSettings &settings)
+    : settings_(settings), random_(settings.seed)
+{
+    const auto num_words = std::max<unsigned int>(
+        WORDS_PER_STRING, static_cast<unsigned int>(settings.address_coverage * ADDRESS_SPACE_WORDS));
+    words_.assign(std::min(num_words, ADDRESS_SPACE_WORDS), 0);
+    word_changed_.assign(words_.size(), false);
+    // Roughly one string per 64 words of cockpit, as in typical aircraft modules.
+    num_string_fields_ = std::max<unsigned int>(1, static_cast<unsigned int>(words_.size()) / 64);
+    for (unsigned int field = 0; field < num_string_fields_; field++) {
+        const std::string text = random_text(random_, STRING_LENGTH);
+        for (unsigned int word = 0; word < WORDS_PER_STRING; word++) {
+            words_[field * WORDS_PER_STRING + word] =
+                static_cast<uint8_t>(text[2 * word]) | (static_cast<uint8_t>(text[2 * word + 1]) << 8);
+        }
+    }
+    for (size_t word = num_string_fields_ * WORDS_PER_STRING; word < words_.size(); word++) {
+        words_[word] = static_cast<uint16_t>(random_());
+    }
+}
+
+const std::vector<std::string> &DcsBiosLoadGenerator::next_frame()
+{
+    const size_t first_integer_word = num_string_fields_ * WORDS_PER_STRING;
+    if (!sent_full_state_) {
+        std::fill(word_changed_.begin(), word_changed_.end(), true);
+        sent_full_state_ = true;
+    } else {
+        const auto num_integer_words = words_.size() - first_integer_word;
+        const auto num_changes = static_cast<size_t>(settings_.change_ratio * num_integer_words);
+        for (const auto index : pick_indices(random_, num_integer_words, num_changes)) {
+            words_[first_integer_word + index] ^= static_cast<uint16_t>(1u << (random_() % 16));
+            word_changed_[first_integer_word + index] = true;
+        }
+        for (const auto field : pick_indices(random_, num_string_fields_, settings_.string_churn)) {
+            const std::string text = random_text(random_, STRING_LENGTH);
+            for (unsigned int word = 0; word < WORDS_PER_STRING; word++) {
+                const auto index = field * WORDS_PER_STRING + word;
+                words_[index] = static_cast<uint8_t>(text[2 * word]) | (static_cast<uint8_t>(text[2 * word + 1]) << 8);
+                word_changed_[index] = true;
+            }
+        }
+    }
+
+    datagrams_.clear();
+    start_datagram();
+    // Aircraft name, exported at the start of every frame.
+    const std::string aircraft_name = "LoadGenerator";
+    append_word(0x0000);
+    append_word(static_cast<uint16_t>(aircraft_name.size() + 1));
+    datagrams_.back().append(aircraft_name);
+    datagrams_.back().push_back('\0');
+
+    // Merge runs of changed words into single writes.
+    size_t word = 0;
+    while (word < words_.size()) {
+        if (!word_changed_[word]) {
+            word++;
+            continue;
+        }
+        const size_t run_start = word;
+        while (word < words_.size() && word_changed_[word]) {
+            word_changed_[word] = false;
+            word++;
+        }
+        append_write(static_cast<unsigned int>(run_start), static_cast<unsigned int>(word - run_start));
+    }
+
+    // End of frame marker.
+    if (datagrams_.back().size() + BLOCK_HEADER_SIZE + 2 > settings_.max_datagram_size) {
+        datagrams_.emplace_back();
+    }
+    append_word(0xFFFE);
+    append_word(2);
+    append_word(frame_count_++);
+    return datagrams_;
+}
+
+void DcsBiosLoadGenerator::append_write(const unsigned int first_word, const unsigned int num_words)
+{
+    unsigned int word = first_word;
+    const unsigned int end_word = first_word + num_words;
+    while (word < end_word) {
+        // Writes which do not fit in the current datagram are split, continuing in the next datagram.
+        if (datagrams_.back().size() + BLOCK_HEADER_SIZE + 2 > settings_.max_datagram_size) {
+            datagrams_.emplace_back();
+        }
+        const size_t space = settings_.max_datagram_size - datagrams_.back().size() - BLOCK_HEADER_SIZE;
+        const auto count = std::min<unsigned int>(end_word - word, static_cast<unsigned int>(space / 2));
+        append_word(static_cast<uint16_t>(FIRST_ADDRESS + 2 * word));
+        append_word(static_cast<uint16_t>(2 * count));
+        for (unsigned int i = 0; i < count; i++) {
+            append_word(words_[word + i]);
+        }
+        word += count;
+    }
+}
+
+void DcsBiosLoadGenerator::append_word(const uint16_t word)
+{
+    datagrams_.back().push_back(static_cast<char>(word & 0xFF));
+    datagrams_.back().push_back(static_cast<char>(word >> 8));
+}
+
+void DcsBiosLoadGenerator::start_datagram()
+{
+    datagrams_.emplace_back();
+    datagrams_.back().reserve(settings_.max_datagram_size);
+    datagrams_.back().append("\x55\x55\x55\x55");
+}
+
+ExportScriptLoadGenerator::ExportScriptLoadGenerator(const LoadGeneratorSettings &settings)
+    : settings_(settings), random_(settings.seed)
+{
+    const auto num_ids = std::max(1, std::min(ID_RANGE, static_cast<int>(settings.address_coverage * ID_RANGE)));
+    values_.resize(num_ids);
+    value_changed_.assign(num_ids, false);
+    num_string_ids_ = std::max<size_t>(1, values_.size() / 64);
+    for (size_t index = 0; index < values_.size(); index++) {
+        values_[index] = (index < num_string_ids_) ? random_text(random_, 8) : "0.00";
+    }
+}
+
+const std::vector<std::string> &ExportScriptLoadGenerator::next_frame()
+{
+    if (!sent_full_state_) {
+        std::fill(value_changed_.begin(), value_changed_.end(), true);
+        sent_full_state_ = true;
+    } else {
+        const auto num_numeric_ids = values_.size() - num_string_ids_;
+        const auto num_changes = static_cast<size_t>(settings_.change_ratio * num_numeric_ids);
+        std::uniform_real_distribution<double> value_distribution(0.0, 1.0);
+        for (const auto index : pick_indices(random_, num_numeric_ids, num_changes)) {
+            char value[16];
+            snprintf(value, sizeof(value), "%.2f", value_distribution(random_));
+            values_[num_string_ids_ + index] = value;
+            value_changed_[num_string_ids_ + index] = true;
+        }
+        for (const auto index : pick_indices(random_, num_string_ids_, settings_.string_churn)) {
+            values_[index] = random_text(random_, 8);
+            value_changed_[index] = true;
+        }
+    }
+
+    datagrams_.clear();
+    for (size_t index = 0; index < values_.size(); index++) {
+        if (value_changed_[index]) {
+            append_token(index);
+            value_changed_[index] = false;
+        }
+    }
+    if (datagrams_.empty()) {
+        // A datagram is still sent each frame when nothing has changed.
+        datagrams_.emplace_back(EXPORT_SCRIPT_HEADER);
+    }
+    return datagrams_;
+}
+
+void ExportScriptLoadGenerator::append_token(const size_t index)
+{
+    const std::string token = std::to_string(index + 1) + "=" + values_[index];
+    if (datagrams_.empty() || datagrams_.back().size() + token.size() + 1 > settings_.max_datagram_size) {
+        datagrams_.emplace_back(EXPORT_SCRIPT_HEADER);
+    } else {
+        datagrams_.back().push_back(':');
+    }
+    datagrams_.back().append(token);
+}
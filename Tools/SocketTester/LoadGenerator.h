@@ -0,0 +1,89 @@
+// Copyright 2026 Charles Tytler
+
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+struct LoadGeneratorSettings {
+    double address_coverage = 0.25; // Fraction of the cockpit address space (or ExportScript ID range) with values.
+    double change_ratio = 0.05;     // Fraction of values changed in each frame.
+    int string_churn = 2;           // Number of string values rewritten in each frame.
+    size_t max_datagram_size = 1472; // Frames larger than this are split across datagrams.
+    unsigned int seed = 1;           // Seed of the random changes, so that runs can be repeated.
+};
+
+/**
+ * @brief Generates valid DCS-BIOS export frames for a synthetic cockpit.
+ *
+ *   The cockpit occupies a contiguous range of addresses, the start of which holds fixed-length string fields and the
+ *   remainder integer data. The first frame exports every address, and each following frame exports only the words
+ *   changed since the previous frame, merged into contiguous writes, as DCS-BIOS does.
+ */
+class DcsBiosLoadGenerator
+{
+  public:
+    static constexpr unsigned int FIRST_ADDRESS = 0x1000;   // Start of the cockpit address range.
+    static constexpr unsigned int ADDRESS_SPACE_WORDS = 0x4000; // Number of words at full address space coverage.
+    static constexpr unsigned int STRING_LENGTH = 16;        // Length in bytes of each string field.
+
+    DcsBiosLoadGenerator(const LoadGeneratorSettings &settings);
+
+    /**
+     * @brief Generates the next frame.
+     * @return Datagrams of the frame, in order, valid until the next call.
+     */
+    const std::vector<std::string> &next_frame();
+
+    size_t num_words() const { return words_.size(); }
+
+  private:
+    void append_write(const unsigned int first_word, const unsigned int num_words);
+    void append_word(const uint16_t word);
+    void start_datagram();
+
+    LoadGeneratorSettings settings_;
+    std::mt19937 random_;
+    std::vector<uint16_t> words_;         // Current value of each word of the cockpit.
+    std::vector<bool> word_changed_;      // Set for words changed in the frame being generated.
+    unsigned int num_string_fields_;      // Number of string fields at the start of the address range.
+    uint16_t frame_count_ = 0;            // Exported at the end of each frame, as DCS-BIOS does.
+    bool sent_full_state_ = false;
+    std::vector<std::string> datagrams_;
+};
+
+/**
+ * @brief Generates valid DCS ExportScript datagrams for a synthetic cockpit.
+ *
+ *   The cockpit exports the IDs from 1 up to its coverage of the ID range, the first of which hold string values and
+ *   the remainder numeric values. The first frame exports every ID, and each following frame exports only the changed
+ *   IDs.
+ */
+class ExportScriptLoadGenerator
+{
+  public:
+    static constexpr int ID_RANGE = 4000; // Number of IDs at full coverage.
+
+    ExportScriptLoadGenerator(const LoadGeneratorSettings &settings);
+
+    /**
+     * @brief Generates the next frame.
+     * @return Datagrams of the frame, in order, valid until the next call.
+     */
+    const std::vector<std::string> &next_frame();
+
+    size_t num_ids() const { return values_.size(); }
+
+  private:
+    void append_token(const size_t index);
+
+    LoadGeneratorSettings settings_;
+    std::mt19937 random_;
+    std::vector<std::string> values_; // Current value of each ID, indexed from ID 1.
+    std::vector<bool> value_changed_; // Set for IDs changed in the frame being generated.
+    size_t num_string_ids_;
+    bool sent_full_state_ = false;
+    std::vector<std::string> datagrams_;
+};
@@ -1,23 +1,49 @@
 // Copyright 2021 Charles Tytler
 
 #include "Utilities/UdpSocket.cpp"
+#include "Utilities/DatagramCapture.h"
+#include "DatagramSender.h"
+#include "LoadGenerator.h"
+#include <atomic>
 #include <bitset>
+#include <chrono>
 #include <csignal>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 /**
  *  This tool is currently set up to connect to DCS-BIOS and print out received data in Hex format.
+ *
+ *  Alternatively, received datagrams can be recorded to a capture file for later replay:
+ *    SocketTester --record <file> [--protocol dcs-bios|export-script|both]
+ *
+ *  Or synthetic simulator data can be sent to the plugin to load test it:
+ *    SocketTester --generate dcs-bios|export-script [options]
  */
 
+namespace
+{
+// Capture channels match the values of the Protocol enum used by the plugin.
+constexpr uint8_t DCS_BIOS_CHANNEL = 0;
+constexpr uint8_t EXPORT_SCRIPT_CHANNEL = 1;
+
+std::atomic<bool> stop_requested{false};
+} // namespace
+
 void signalInteruptHandler(int sig)
 {
     std::cout << "Stopped." << std::endl;
     std::exit(sig);
 }
 
-int main()
+void signalInteruptStopHandler(int) { stop_requested = true; }
+
+int dump_dcs_bios_hex()
 {
     signal(SIGINT, signalInteruptHandler);
 
@@ -47,3 +73,222 @@ int main()
 
     return 0;
 }
+
+int record_capture(const std::string &capture_path, const bool record_dcs_bios, const bool record_export_script)
+{
+    std::unique_ptr<UdpSocket> dcs_bios_socket;
+    std::unique_ptr<UdpSocket> export_script_socket;
+    if (record_dcs_bios) {
+        dcs_bios_socket = std::make_unique<UdpSocket>("127.0.0.1", "5010", "7778", "239.255.50.10");
+    }
+    if (record_export_script) {
+        export_script_socket = std::make_unique<UdpSocket>("127.0.0.1", "1725", "26027");
+    }
+
+    const auto start_time = std::chrono::steady_clock::now();
+    const int64_t start_time_unix_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch())
+            .count();
+    DatagramCaptureWriter writer(capture_path, start_time_unix_ns);
+
+    // Let the main loop finish so that the capture index is written on exit.
+    signal(SIGINT, signalInteruptStopHandler);
+    std::cout << "Recording to " << capture_path << "  |  Press CTRL+C to stop." << std::endl;
+
+    // Each socket is received on its own thread, so a datagram is timestamped as soon as it arrives rather than after
+    // the other socket's receive timeout.
+    std::mutex writer_mutex;
+    bool write_failed = false;
+    const auto record_from = [&writer, &writer_mutex, &write_failed, &start_time](UdpSocket *socket,
+                                                                                   const uint8_t channel) {
+        while (!stop_requested) {
+            const auto datagram = socket->receive_datagram();
+            if (datagram.size() > 0) {
+                const auto elapsed = std::chrono::steady_clock::now() - start_time;
+                std::lock_guard<std::mutex> lock(writer_mutex);
+                try {
+                    writer.write(channel,
+                                 datagram.data(),
+                                 datagram.size(),
+                                 std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+                } catch (const std::runtime_error &e) {
+                    // Stop recording, rather than leave a capture which silently ends early.
+                    std::cout << e.what() << std::endl;
+                    write_failed = true;
+                    stop_requested = true;
+                }
+            }
+        }
+    };
+    std::vector<std::thread> recorders;
+    if (dcs_bios_socket) {
+        recorders.emplace_back(record_from, dcs_bios_socket.get(), DCS_BIOS_CHANNEL);
+    }
+    if (export_script_socket) {
+        recorders.emplace_back(record_from, export_script_socket.get(), EXPORT_SCRIPT_CHANNEL);
+    }
+    for (auto &recorder : recorders) {
+        recorder.join();
+    }
+
+    if (write_failed) {
+        std::cout << "Stopped. Capture is truncated after " << writer.num_records() << " datagrams." << std::endl;
+        return 1;
+    }
+    try {
+        writer.close();
+    } catch (const std::runtime_error &e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    std::cout << "Stopped. Recorded " << writer.num_records() << " datagrams." << std::endl;
+    return 0;
+}
+
+struct GenerateOptions {
+    std::string protocol;
+    std::string ip_address;      // Destination, which may be a multicast group.
+    std::string port;            // Destination port.
+    double frame_rate = 30.0;    // Frames per second, or 0 to send as fast as possible.
+    double packet_loss = 0.0;    // Fraction of datagrams to drop rather than send.
+    double duration_s = 0.0;     // Time to send for, or 0 to send until stopped.
+    LoadGeneratorSettings generator;
+};
+
+template <typename Generator> int generate_load(const GenerateOptions &options)
+{
+    DatagramSender sender(options.ip_address, options.port);
+    Generator generator(options.generator);
+    std::mt19937 loss_random(options.generator.seed);
+    std::bernoulli_distribution drop_datagram(options.packet_loss);
+
+    signal(SIGINT, signalInteruptStopHandler);
+    std::cout << "Sending " << options.protocol << " to " << options.ip_address << ":" << options.port
+              << (sender.is_multicast() ? " (multicast)" : "") << "  |  Press CTRL+C to stop." << std::endl;
+
+    using Clock = std::chrono::steady_clock;
+    const auto start_time = Clock::now();
+    const auto frame_period = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(options.frame_rate > 0 ? 1.0 / options.frame_rate : 0.0));
+    auto next_frame_time = start_time;
+    auto next_report_time = start_time + std::chrono::seconds(1);
+    uint64_t num_frames = 0, num_datagrams = 0, num_bytes = 0, num_dropped = 0, num_failed = 0;
+    uint64_t frames_at_last_report = 0, bytes_at_last_report = 0;
+
+    while (!stop_requested) {
+        const auto now = Clock::now();
+        if (options.duration_s > 0 && now - start_time >= std::chrono::duration<double>(options.duration_s)) {
+            break;
+        }
+        for (const auto &datagram : generator.next_frame()) {
+            if (drop_datagram(loss_random)) {
+                num_dropped++;
+                continue;
+            }
+            if (!sender.send(datagram)) {
+                num_failed++;
+            }
+            num_datagrams++;
+            num_bytes += datagram.size();
+        }
+        num_frames++;
+
+        if (now >= next_report_time) {
+            std::cout << std::dec << "frames/s: " << (num_frames - frames_at_last_report)
+                      << "  KiB/s: " << (num_bytes - bytes_at_last_report) / 1024 << "  datagrams: " << num_datagrams
+                      << "  dropped: " << num_dropped << "  send failures: " << num_failed << std::endl;
+            frames_at_last_report = num_frames;
+            bytes_at_last_report = num_bytes;
+            next_report_time += std::chrono::seconds(1);
+        }
+        if (options.frame_rate > 0) {
+            next_frame_time += frame_period;
+            std::this_thread::sleep_until(next_frame_time);
+        }
+    }
+
+    std::cout << "Stopped. Sent " << num_frames << " frames in " << num_datagrams << " datagrams (" << num_bytes
+              << " bytes), dropped " << num_dropped << "." << std::endl;
+    return 0;
+}
+
+void print_usage()
+{
+    std::cout << "Usage: SocketTester [--record <file> [--protocol dcs-bios|export-script|both]]\n"
+                 "       SocketTester --generate dcs-bios|export-script [--target <ip>] [--port <port>]\n"
+                 "                    [--rate <frames/s, 0 = max>] [--coverage <0-1>] [--change-ratio <0-1>]\n"
+                 "                    [--string-churn <strings/frame>] [--loss <0-1>] [--max-datagram <bytes>]\n"
+                 "                    [--duration <s>] [--seed <n>]"
+              << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    std::string capture_path;
+    std::string protocol = "both";
+    GenerateOptions generate;
+    try {
+        for (int i = 1; i < argc; i++) {
+            const std::string arg = argv[i];
+            const bool has_value = i + 1 < argc;
+            if (arg == "--record" && has_value) {
+                capture_path = argv[++i];
+            } else if (arg == "--protocol" && has_value) {
+                protocol = argv[++i];
+            } else if (arg == "--generate" && has_value) {
+                generate.protocol = argv[++i];
+            } else if (arg == "--target" && has_value) {
+                generate.ip_address = argv[++i];
+            } else if (arg == "--port" && has_value) {
+                generate.port = argv[++i];
+            } else if (arg == "--rate" && has_value) {
+                generate.frame_rate = std::stod(argv[++i]);
+            } else if (arg == "--coverage" && has_value) {
+                generate.generator.address_coverage = std::stod(argv[++i]);
+            } else if (arg == "--change-ratio" && has_value) {
+                generate.generator.change_ratio = std::stod(argv[++i]);
+            } else if (arg == "--string-churn" && has_value) {
+                generate.generator.string_churn = std::stoi(argv[++i]);
+            } else if (arg == "--loss" && has_value) {
+                generate.packet_loss = std::stod(argv[++i]);
+            } else if (arg == "--max-datagram" && has_value) {
+                generate.generator.max_datagram_size = std::max(64, std::stoi(argv[++i]));
+            } else if (arg == "--duration" && has_value) {
+                generate.duration_s = std::stod(argv[++i]);
+            } else if (arg == "--seed" && has_value) {
+                generate.generator.seed = static_cast<unsigned int>(std::stoul(argv[++i]));
+            } else {
+                print_usage();
+                return 1;
+            }
+        }
+    } catch (const std::exception &) {
+        print_usage();
+        return 1;
+    }
+
+    if (!generate.protocol.empty()) {
+        // Defaults match the plugin's connection settings for each protocol.
+        if (generate.protocol == "dcs-bios") {
+            generate.ip_address = generate.ip_address.empty() ? "239.255.50.10" : generate.ip_address;
+            generate.port = generate.port.empty() ? "5010" : generate.port;
+            return generate_load<DcsBiosLoadGenerator>(generate);
+        }
+        if (generate.protocol == "export-script") {
+            generate.ip_address = generate.ip_address.empty() ? "127.0.0.1" : generate.ip_address;
+            generate.port = generate.port.empty() ? "1725" : generate.port;
+            return generate_load<ExportScriptLoadGenerator>(generate);
+        }
+        std::cout << "Unknown protocol: " << generate.protocol << std::endl;
+        return 1;
+    }
+
+    if (capture_path.empty()) {
+        return dump_dcs_bios_hex();
+    }
+    if (protocol != "dcs-bios" && protocol != "export-script" && protocol != "both") {
+        std::cout << "Unknown protocol: " << protocol << std::endl;
+        return 1;
+    }
+    return record_capture(capture_path, protocol != "export-script", protocol != "dcs-bios");
+}